@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include <esphome.h>
+
+#include "price.h"
+#include "priceindex.h"
+#include "prices.h"
+
+
+// The cheapest time to run something that takes a few hours, like a
+// washing machine: the contiguous window of "Cheapest window length"
+// hours with the lowest mean price, starting no earlier than the
+// current slot and ending by the next "Cheapest window deadline"
+// o'clock (-1 = by the end of the prices).
+//
+// It's found when prices are received, the settings change or the
+// current slot changes (see poll_cheapest_window() in scheduler.h), not
+// in draw(), so that the hourly redraw doesn't get any slower.
+
+PriceWindow cheapest_window = {-1, 0, PRICE_MISSING};
+// absolute slot (see PriceStore) of the time cheapest_window was found
+// for, INT32_MIN if the clock wasn't set
+int32_t cheapest_window_found_slot = INT32_MIN;
+
+
+// Find cheapest_window for the current prices and settings, as of now.
+// price_index must be up to date.
+inline void update_cheapest_window(const ESPTime& now) {
+  const PriceStore& prices = id(price_store);
+  const float hours = id(cheapest_window_hours).state;
+  const int length =
+    std::isnan(hours) ? 0 : int(hours * prices.slots_per_hour() + 0.5f);
+
+  int first = 0, last = prices.size();
+  cheapest_window_found_slot =
+    now.is_valid() ? prices.slot_at(now.timestamp) : INT32_MIN;
+  if (now.is_valid()) {
+    first = std::max(first, price_slot_at(now.timestamp));
+
+    const float deadline = id(cheapest_window_deadline).state;
+    if (!std::isnan(deadline) && deadline >= 0) {
+      // next time it's deadline o'clock
+      ESPTime end = now;
+      end.hour = int(deadline);
+      end.minute = end.second = 0;
+      end.recalc_timestamp_local(false);
+      if (end.timestamp <= now.timestamp) {
+        // tomorrow, which isn't 24 hours away when the clocks change
+        end.increment_day();
+        end.recalc_timestamp_local(false);
+      }
+      last = std::min(last, price_slot_at(end.timestamp));
+    }
+  }
+
+  cheapest_window = price_index.cheapest_window(first, last, length);
+
+  if (cheapest_window.start >= 0)
+    ESP_LOGD("cheapest", "Cheapest %d slots start at slot %d, mean %d",
+             length, cheapest_window.start, cheapest_window.mean);
+  else
+    ESP_LOGD("cheapest", "No window of %d slots in slots %d...%d",
+             length, first, last);
+}
+
+inline void update_cheapest_window() {
+  update_cheapest_window(id(homeassistant_time).now());
+}
+
+
+// Start of cheapest_window in ISO 8601 UTC, for a timestamp text
+// sensor (a float sensor can't hold Unix time to the second), or ""
+// if none.
+inline std::string cheapest_window_start_iso() {
+  return slot_start_iso(cheapest_window.start);
+}
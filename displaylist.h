@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <esphome.h>
+
+#include "framebuffer.h"
+#include "gradient.h"
+#include "dither.h"
+
+
+// A frame as a list of drawing operations, produced by lay_out_frame()
+// in draw.h and drawn by rasterize(). Laying out (fonts measured,
+// prices scaled, ticks chosen) is separate from setting pixels, so a
+// list can be kept while nothing it depends on changes, compared with
+// the previous frame's list to find what changed, and each half can be
+// timed on its own (render_host -n).
+//
+// Operations are drawn in list order, black or red, on a cleared frame.
+
+enum class DisplayOpKind : uint8_t {
+  TEXT,        // text aligned at (x, y)
+  IMAGE,       // image aligned at (x, y)
+  RECT,        // filled, width x height from (x, y)
+  DOTS_H,      // every step-th pixel of width from (x, y) right
+  DOTS_V,      // every step-th pixel of height from (x, y) down
+  TRIANGLE,    // rows 1, 3, 5... px wide from the tip at (x, y), height
+               // rows down (or -height rows up)
+  BARS,        // the list's bar columns from x, with BlackRedBars of
+               // base y, y limit height and bar width width
+};
+
+struct DisplayOp {
+  DisplayOpKind kind;
+  uint8_t align;  // TextAlign or ImageAlign
+  uint8_t step;
+  bool red;
+  int16_t x, y;
+  int16_t width, height;
+  uint16_t text;  // offset of the text in the list
+  esphome::display::BaseFont* font;
+  esphome::display::BaseImage* image;
+  // area drawn, [left, right) x [top, bottom)
+  int16_t left, top, right, bottom;
+
+  // Same drawing (the text is compared by the list)
+  bool same_as(const DisplayOp& other) const {
+    return kind == other.kind && align == other.align &&
+      step == other.step && red == other.red &&
+      x == other.x && y == other.y &&
+      width == other.width && height == other.height &&
+      font == other.font && image == other.image;
+  }
+};
+
+
+// Display list of a frame with a bar graph of N columns. Fixed size,
+// with room for everything lay_out_frame() adds (at most 62
+// operations); operations that don't fit are dropped with an error.
+template<int N>
+class DisplayList {
+public:
+  static constexpr int MAX_OPS = 64;
+  static constexpr int MAX_TEXT = 192;  // bytes of text, with NULs
+
+  BarColumns<N> bars;
+  // RednessTable::build_count() of the table to draw bars with
+  uint32_t redness_builds = 0;
+
+  void clear() {
+    size_ = 0;
+    text_size_ = 0;
+    bars = BarColumns<N>();
+    redness_builds = 0;
+  }
+
+  int size() const { return size_; }
+  const DisplayOp& operator[](int i) const { return ops_[i]; }
+  const char* text(const DisplayOp& op) const { return text_ + op.text; }
+
+  template<typename T>
+  void text(T& it, int x, int y, esphome::display::BaseFont* font,
+            TextAlign align, const char* str, bool red = false)
+  {
+    const int length = strlen(str) + 1;
+    if (text_size_ + length > MAX_TEXT) {
+      ESP_LOGE("displaylist", "No room for text \"%s\".", str);
+      return;
+    }
+    int x1, y1, width, height;
+    it.get_text_bounds(x, y, str, font, align, &x1, &y1, &width, &height);
+    DisplayOp op = make(DisplayOpKind::TEXT, x, y, width, height, red);
+    op.align = uint8_t(align);
+    op.font = font;
+    op.text = text_size_;
+    set_bounds(op, x1, y1, x1 + width, y1 + height);
+    if (add(op)) {
+      memcpy(text_ + text_size_, str, length);
+      text_size_ += length;
+    }
+  }
+
+  void image(int x, int y, esphome::display::BaseImage* image,
+             ImageAlign align, bool red = false)
+  {
+    const int width = image->get_width(), height = image->get_height();
+    DisplayOp op = make(DisplayOpKind::IMAGE, x, y, width, height, red);
+    op.align = uint8_t(align);
+    op.image = image;
+    // (a pixel wider and higher when centered, whichever way it rounds)
+    const int left = x - (int(align) & int(ImageAlign::RIGHT) ? width :
+                          int(align) & int(ImageAlign::CENTER_HORIZONTAL)
+                          ? (width + 1) / 2 : 0);
+    const int top = y - (int(align) & int(ImageAlign::BOTTOM) ? height :
+                         int(align) & int(ImageAlign::CENTER_VERTICAL)
+                         ? (height + 1) / 2 : 0);
+    set_bounds(op, left, top, left + width + 1, top + height + 1);
+    add(op);
+  }
+
+  void rect(int x, int y, int width, int height, bool red = false) {
+    DisplayOp op = make(DisplayOpKind::RECT, x, y, width, height, red);
+    set_bounds(op, x, y, x + width, y + height);
+    add(op);
+  }
+
+  void dots_h(int x, int y, int width, int step, bool red = false) {
+    DisplayOp op = make(DisplayOpKind::DOTS_H, x, y, width, 1, red);
+    op.step = step;
+    set_bounds(op, x, y, x + width, y + 1);
+    add(op);
+  }
+
+  void dots_v(int x, int y, int height, int step, bool red = false) {
+    DisplayOp op = make(DisplayOpKind::DOTS_V, x, y, 1, height, red);
+    op.step = step;
+    set_bounds(op, x, y, x + 1, y + height);
+    add(op);
+  }
+
+  void triangle(int x, int y, int height, bool red = false) {
+    DisplayOp op = make(DisplayOpKind::TRIANGLE, x, y, 0, height, red);
+    const int rows = std::abs(height);
+    set_bounds(op, x - (rows - 1), height > 0 ? y : y - (rows - 1),
+               x + rows, height > 0 ? y + rows : y + 1);
+    add(op);
+  }
+
+  // Draw bars (set with BlackRedBars::set_column()) from x
+  void bar_graph(int x, int base_y, int y_limit, int bar_width) {
+    DisplayOp op = make(DisplayOpKind::BARS, x, base_y, bar_width, y_limit,
+                        false);
+    set_bounds(op, x, 0, x + N, y_limit);
+    add(op);
+  }
+
+  // Bounding box of what is drawn differently from previous: the
+  // operations that only one of the lists has, and the bar columns
+  // that differ. Empty (width 0) if the lists draw the same frame.
+  FrameBuffer::Rect changed_area(const DisplayList& previous) const {
+    int left = INT_MAX, top = INT_MAX, right = INT_MIN, bottom = INT_MIN;
+    auto add_area = [&](int l, int t, int r, int b) {
+      left = std::min(left, l);
+      top = std::min(top, t);
+      right = std::max(right, r);
+      bottom = std::max(bottom, b);
+    };
+
+    for (const DisplayList* list : {this, &previous}) {
+      const DisplayList* other = list == this ? &previous : this;
+      for (int i = 0; i < list->size_; ++i) {
+        const DisplayOp& op = list->ops_[i];
+        if (!other->has(*list, op))
+          add_area(op.left, op.top, op.right, op.bottom);
+        else if (op.kind == DisplayOpKind::BARS)
+          add_bars_area(previous, op, add_area);
+      }
+    }
+
+    if (left >= right || top >= bottom)
+      return {0, 0, 0, 0};
+    return {left, top, right - left, bottom - top};
+  }
+
+private:
+  DisplayOp ops_[MAX_OPS];
+  char text_[MAX_TEXT];
+  int size_ = 0;
+  int text_size_ = 0;
+
+  static DisplayOp make(DisplayOpKind kind, int x, int y,
+                        int width, int height, bool red)
+  {
+    DisplayOp op = {};
+    op.kind = kind;
+    op.red = red;
+    op.x = x;
+    op.y = y;
+    op.width = width;
+    op.height = height;
+    return op;
+  }
+
+  static void set_bounds(DisplayOp& op, int left, int top,
+                         int right, int bottom)
+  {
+    op.left = left;
+    op.top = top;
+    op.right = right;
+    op.bottom = bottom;
+  }
+
+  bool add(const DisplayOp& op) {
+    if (size_ == MAX_OPS) {
+      ESP_LOGE("displaylist", "More than %d operations.", MAX_OPS);
+      return false;
+    }
+    ops_[size_++] = op;
+    return true;
+  }
+
+  // True if this list has op of list
+  bool has(const DisplayList& list, const DisplayOp& op) const {
+    for (int i = 0; i < size_; ++i)
+      if (ops_[i].same_as(op) &&
+          (op.kind != DisplayOpKind::TEXT ||
+           strcmp(text(ops_[i]), list.text(op)) == 0))
+        return true;
+    return false;
+  }
+
+  // Add columns of bar graph op (in both lists) that differ from
+  // previous
+  template<typename AddArea>
+  void add_bars_area(const DisplayList& previous, const DisplayOp& op,
+                     AddArea add_area) const
+  {
+    const bool redness_changed = redness_builds != previous.redness_builds;
+    for (int i = 0; i < N; ++i) {
+      const uint32_t bit = uint32_t(1) << (i % 32);
+      const bool same = !redness_changed &&
+        bars.tops[i] == previous.bars.tops[i] &&
+        bars.bottoms[i] == previous.bars.bottoms[i] &&
+        !((bars.red[i / 32] ^ previous.bars.red[i / 32]) & bit) &&
+        !((bars.grayed_out[i / 32] ^ previous.bars.grayed_out[i / 32]) & bit);
+      if (!same)
+        add_area(op.x + i, op.top, op.x + i + 1, op.bottom);
+    }
+  }
+};
+
+
+// Number of frames drawn from display lists, and the area changed
+// since the previous one (see DisplayList::changed_area()). Set by
+// draw().
+uint32_t display_list_frames = 0;
+FrameBuffer::Rect display_list_changed = {0, 0, 0, 0};
+
+
+// Draw list on it, whose frame must be cleared. Bars are drawn with
+// redness (the table of list.redness_builds).
+template<typename Layout, typename T>
+void rasterize(T& it, const DisplayList<Layout::GRAPH_WIDTH>& list,
+               const RednessTable<Layout::SCREEN_HEIGHT>& redness)
+{
+  const Color color_red = id(red);
+  for (int i = 0; i < list.size(); ++i) {
+    const DisplayOp& op = list[i];
+    const Color color = op.red ? color_red : esphome::display::COLOR_ON;
+    switch (op.kind) {
+    case DisplayOpKind::TEXT:
+      it.print(op.x, op.y, op.font, color, TextAlign(op.align),
+               list.text(op));
+      break;
+    case DisplayOpKind::IMAGE:
+      it.image(op.x, op.y, op.image, ImageAlign(op.align), color);
+      break;
+    case DisplayOpKind::RECT:
+      if (op.width == 1)
+        it.vertical_line(op.x, op.y, op.height, color);
+      else
+        for (int y = op.y; y < op.y + op.height; ++y)
+          it.horizontal_line(op.x, y, op.width, color);
+      break;
+    case DisplayOpKind::DOTS_H:
+      for (int x = op.x; x < op.x + op.width; x += op.step)
+        it.draw_pixel_at(x, op.y, color);
+      break;
+    case DisplayOpKind::DOTS_V:
+      for (int y = op.y; y < op.y + op.height; y += op.step)
+        it.draw_pixel_at(op.x, y, color);
+      break;
+    case DisplayOpKind::TRIANGLE: {
+      const int rows = std::abs(op.height), dy = op.height > 0 ? 1 : -1;
+      for (int row = 0; row < rows; ++row)
+        it.horizontal_line(op.x - row, op.y + row * dy, 2 * row + 1, color);
+      break;
+    }
+    case DisplayOpKind::BARS: {
+      BlackRedBars drawer(redness.get(), op.y, op.height, op.width);
+      // With the display rotated by 90°, bar columns are rows of the
+      // panel, and are written directly in its memory order.
+      if constexpr (Layout::ROTATION == 90) {
+        static NativeBars<Layout::SCREEN_HEIGHT> native_bars;
+        if (!native_bars.draw(op.x, list.bars, redness))
+          drawer.draw_scanlines(op.x, list.bars);
+      }
+      else {
+        drawer.draw_scanlines(op.x, list.bars);
+      }
+      break;
+    }
+    }
+  }
+}
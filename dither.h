@@ -1,13 +1,57 @@
 #pragma once
 
-#include <cmath>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <climits>
 
 #include <esphome.h>
 
 #include "dithermask.h"
+#include "ditherplanes.h"
+#include "framebuffer.h"
+#include "gradient.h"
 
 
+#if DITHER_LEVELS
+
+// horizontal period of the dither pattern
+const int DITHER_WIDTH = DITHER_PLANE_WIDTH;
+
+static uint32_t read_dither_plane_word(const uint32_t* p) {
+#ifdef USE_ESP8266
+  // ESP8266 requires special handling for PROGMEM data
+  return pgm_read_dword(p);
+#else
+  return *p;
+#endif
+}
+
+// Return red pixels of a horizontal span of n <= 32 pixels starting
+// at (x, y) as a bitmask (bit i = pixel x + i).
+static uint32_t apply_dither_mask(int x, int y, int n, uint8_t value) {
+  // round to nearest level
+  const int level = (value * DITHER_LEVELS + 0x80) >> 8;
+  if (level == 0)
+    return 0;
+
+  const uint32_t* row =
+    DITHER_PLANES[level - 1][unsigned(y) % DITHER_PLANE_HEIGHT];
+  const unsigned mask_x = unsigned(x) % DITHER_PLANE_WIDTH;
+  const unsigned word = mask_x / 32;
+  const unsigned shift = mask_x % 32;
+  uint32_t bits = read_dither_plane_word(&row[word]) >> shift;
+  // span continues in the next word (wrapping around the mask)
+  if (shift + n > 32)
+    bits |= read_dither_plane_word(
+      &row[(word + 1) % (DITHER_PLANE_WIDTH / 32)]) << (32 - shift);
+  return bits;
+}
+
+#else  // DITHER_LEVELS
+
+const int DITHER_WIDTH = DITHER_MASK_WIDTH;
+
 static bool apply_dither_mask(int x, int y, uint8_t value) {
   uint8_t threshold =
 #ifdef USE_ESP8266
@@ -19,66 +63,263 @@ static bool apply_dither_mask(int x, int y, uint8_t value) {
   return value > threshold;
 }
 
+static uint32_t apply_dither_mask(int x, int y, int n, uint8_t value) {
+  uint32_t bits = 0;
+  if (value != 0)
+    for (int i = 0; i < n; ++i)
+      if (apply_dither_mask(x + i, y, value))
+        bits |= uint32_t(1) << i;
+  return bits;
+}
+
+#endif  // DITHER_LEVELS
 
-class BlackRedBars {
-  esphome::display::Display& display;
 
-  const esphome::Color color_red;
-  const esphome::Color color_black;
+// Columns of a whole bar graph, for BlackRedBars::draw_scanlines().
+// Filled with BlackRedBars::set_column().
+template<int N>
+struct BarColumns {
+  static constexpr int COLUMNS = N;
+  static constexpr int WORDS = (N + 31) / 32;
 
-  const int gradient_top;
-  const int gradient_bottom;
+  int16_t tops[N];     // rows covered, inclusive;
+  int16_t bottoms[N];  // top > bottom if none
+  // bit i % 32 of word i / 32 is column i
+  uint32_t red[WORDS];
+  uint32_t grayed_out[WORDS];
+
+  BarColumns() {
+    std::fill(tops, tops + N, INT16_MAX);
+    std::fill(bottoms, bottoms + N, INT16_MIN);
+    std::fill(red, red + WORDS, 0);
+    std::fill(grayed_out, grayed_out + WORDS, 0);
+  }
+};
+
+
+class BlackRedBars {
+  FrameBuffer frame_buffer;
+
+  const uint8_t* const row_redness;
   const int base_y;
   const int y_limit;
   const int bar_width;
 
 public:
+  // row_redness is the redness of each row 0 ... y_limit - 1, from a
+  // RednessTable.
   BlackRedBars(
-    float gradient_top, float gradient_bottom,
+    const uint8_t* row_redness,
     int base_y, int y_limit,
     int bar_width)
-    : display(id(epaper))
-    , color_red(id(red))
-    , color_black(esphome::display::COLOR_ON)
-    , gradient_top(std::isfinite(gradient_top)
-                   ? (int) std::round(gradient_top)
-                   : INT_MAX)
-    , gradient_bottom(std::isfinite(gradient_bottom)
-                      ? (int) std::round(gradient_bottom)
-                      : INT_MAX)
+    : frame_buffer(id(epaper))
+    , row_redness(row_redness)
     , base_y(base_y)
     , y_limit(y_limit)
     , bar_width(bar_width)
-  {}
+  {
+    assert(bar_width <= 32);
+  }
+
+  // Height of a column that is not drawn
+  static constexpr int NO_BAR = INT16_MIN;
 
   void draw_bar(int x0, int h, bool red, bool grayed_out) {
-    int y0;
-    if (h == 0) {
-      y0 = base_y;
-      h = 1;
+    int heights[32];
+    for (int i = 0; i < bar_width; ++i)
+      heights[i] = h;
+    const uint32_t all = full_mask(bar_width);
+    draw_columns(x0, heights, bar_width, red ? all : 0, grayed_out ? all : 0);
+  }
+
+  // Draw n <= 32 adjacent columns starting at x0, each with its own
+  // height (or NO_BAR). Bit i of red_columns and grayed_out_columns
+  // is column x0 + i.
+  void draw_columns(int x0, const int* heights, int n,
+                    uint32_t red_columns, uint32_t grayed_out_columns)
+  {
+    assert(n <= 32);
+
+    int tops[32], bottoms[32];
+    int top = INT_MAX, bottom = INT_MIN;
+    for (int i = 0; i < n; ++i) {
+      column_rows(heights[i], &tops[i], &bottoms[i]);
+      top = std::min(top, tops[i]);
+      bottom = std::max(bottom, bottoms[i]);
+    }
+
+    for (int y = std::max(top, 0); y <= bottom; ++y) {
+      uint32_t columns = 0;
+      for (int i = 0; i < n; ++i)
+        if (tops[i] <= y && y <= bottoms[i])
+          columns |= uint32_t(1) << i;
+      write_row(x0, y, n, columns, red_columns, grayed_out_columns,
+                redness(y));
+    }
+  }
+
+  // Set column i of a graph to be drawn with draw_scanlines()
+  template<int N>
+  void set_column(BarColumns<N>& columns, int i, int height,
+                  bool red, bool grayed_out) const
+  {
+    int top, bottom;
+    column_rows(height, &top, &bottom);
+    // (NO_BAR rows are INT_MAX...INT_MIN, still empty when clamped)
+    columns.tops[i] = std::min(std::max(top, int(INT16_MIN)), int(INT16_MAX));
+    columns.bottoms[i] =
+      std::min(std::max(bottom, int(INT16_MIN)), int(INT16_MAX));
+    const uint32_t bit = uint32_t(1) << (i % 32);
+    if (red)
+      columns.red[i / 32] |= bit;
+    if (grayed_out)
+      columns.grayed_out[i / 32] |= bit;
+  }
+
+  // Draw all columns of a graph, starting at x0, row by row: the
+  // redness of each row is looked up once, and the dither mask is
+  // read once per 32 columns, instead of once per bar.
+  template<int N>
+  void draw_scanlines(int x0, const BarColumns<N>& columns) {
+    int top = INT_MAX, bottom = INT_MIN;
+    for (int i = 0; i < N; ++i) {
+      top = std::min(top, int(columns.tops[i]));
+      bottom = std::max(bottom, int(columns.bottoms[i]));
+    }
+
+    for (int y = std::max(top, 0); y <= bottom; ++y) {
+      const uint8_t redness_y = redness(y);
+      for (int word = 0; word < BarColumns<N>::WORDS; ++word) {
+        const int first = word * 32;
+        const int n = std::min(32, N - first);
+        uint32_t covered = 0;
+        for (int i = 0; i < n; ++i)
+          if (columns.tops[first + i] <= y && y <= columns.bottoms[first + i])
+            covered |= uint32_t(1) << i;
+        write_row(x0 + first, y, n, covered,
+                  columns.red[word], columns.grayed_out[word], redness_y);
+      }
+    }
+  }
+
+private:
+  static uint32_t full_mask(int n) {
+    return n >= 32 ? ~uint32_t(0) : (uint32_t(1) << n) - 1;
+  }
+
+  // rows covered by a column of height h, inclusive
+  void column_rows(int h, int* top, int* bottom) const {
+    if (h == NO_BAR) {
+      *top = INT_MAX;
+      *bottom = INT_MIN;
+    }
+    else if (h == 0) {
+      *top = *bottom = base_y;
     }
     else if (h < 0) {
-      h = std::min(-h, y_limit - (base_y + 1));
-      y0 = base_y + h;
+      *top = base_y + 1;
+      *bottom = base_y + std::min(-h, y_limit - (base_y + 1));
     }
     else { // h > 0
-      y0 = base_y - 1;
+      *top = base_y - h;
+      *bottom = base_y - 1;
     }
+  }
+
+  uint8_t redness(int y) const {
+    assert(y >= 0 && y < y_limit);
+    return row_redness[y];
+  }
 
-    for (int y = y0; y >= 0 && y > y0 - h; --y) {
-      uint8_t redness =
-        y >= gradient_bottom ? 0 :
-        y <= gradient_top ? 0xff :
-        0xff - ((y - gradient_top)*0xff) / (gradient_bottom - gradient_top);
+  // Draw n <= 32 pixels of row y starting at x0: pixels of columns
+  // in black and dithered red, or in red if red_columns
+  void write_row(int x0, int y, int n, uint32_t columns,
+                 uint32_t red_columns, uint32_t grayed_out_columns,
+                 uint8_t redness)
+  {
+    // if grayed out, draw every 2nd pixel
+    const uint32_t checkerboard =
+      (x0 ^ y) & 1 ? 0x55555555u : 0xAAAAAAAAu;
+    const uint32_t draw_mask =
+      columns & (~grayed_out_columns | checkerboard);
+    if (draw_mask == 0)
+      return;
+
+    uint32_t red_mask = draw_mask & red_columns;
+    if (draw_mask & ~red_columns) {
       ESP_LOGVV("dither", "y=%d: redness=%u", y, redness);
+      red_mask |= apply_dither_mask(x0, y, n, redness) & ~red_columns;
+    }
+
+    frame_buffer.write_span(x0, y, n, draw_mask, red_mask);
+  }
+};
+
+
+// Bars for a display rotated by 90°, drawn in the panel's memory
+// order. Columns of the graph are rows of the panel, so each bar
+// column is a run of adjacent bits, written a byte at a time instead
+// of a bit per row. The dithered red comes from a pattern in the same
+// bit order, rebuilt only when the redness table changes. HEIGHT is
+// the screen height, i.e. the native width of the panel.
+template<int HEIGHT>
+class NativeBars {
+  static_assert(HEIGHT % 8 == 0, "native rows must be whole bytes");
+  static constexpr int ROW_BYTES = HEIGHT / 8;
+
+  // red pixels of native rows x % DITHER_WIDTH at full height
+  uint8_t red_pattern[DITHER_WIDTH][ROW_BYTES];
+  bool built = false;
+  uint32_t redness_builds = 0;
+
+public:
+  // Draw all columns of a graph, starting at x0, like
+  // BlackRedBars::draw_scanlines(). Returns false, without drawing,
+  // if the display is not rotated by 90° or is not HEIGHT high.
+  template<int N>
+  bool draw(int x0, const BarColumns<N>& columns,
+            const RednessTable<HEIGHT>& redness)
+  {
+    FrameBuffer frame_buffer(id(epaper));
+    if (frame_buffer.get_rotation() !=
+          esphome::display::DISPLAY_ROTATION_90_DEGREES ||
+        frame_buffer.get_native_width() != HEIGHT)
+      return false;
+
+    if (!built || redness_builds != redness.build_count())
+      build(redness.get());
+    redness_builds = redness.build_count();
+
+    for (int i = 0; i < N; ++i) {
+      const int top = std::max(int(columns.tops[i]), 0);
+      const int bottom = std::min(int(columns.bottoms[i]), HEIGHT - 1);
+      const int x = x0 + i;
+      if (top > bottom || x < 0 || x >= frame_buffer.get_native_height())
+        continue;
+
+      const uint32_t bit = uint32_t(1) << (i % 32);
+      // if grayed out, draw every 2nd pixel, where x + y is odd
+      // (native bit HEIGHT - 1 - y)
+      const uint8_t draw_bits = !(columns.grayed_out[i / 32] & bit) ? 0xff :
+        (x + HEIGHT - 1) & 1 ? 0xAA : 0x55;
+      frame_buffer.write_native_run(
+        x, HEIGHT - 1 - bottom, HEIGHT - top, draw_bits,
+        columns.red[i / 32] & bit ? nullptr : red_pattern[x % DITHER_WIDTH]);
+    }
+    return true;
+  }
 
-      for (int x = x0; x < x0 + bar_width; ++x)
-        // if grayed_out, draw every 2nd pixel
-        if (!grayed_out || (x & 1) ^ (y & 1))
-          display.draw_pixel_at(
-            x, y,
-            red ? color_red :
-            apply_dither_mask(x, y, redness) ? color_red : color_black);
+private:
+  void build(const uint8_t* row_redness) {
+    for (int x = 0; x < DITHER_WIDTH; ++x) {
+      std::fill(red_pattern[x], red_pattern[x] + ROW_BYTES, 0);
+      for (int y = 0; y < HEIGHT; ++y) {
+        if (apply_dither_mask(x, y, 1, row_redness[y]) & 1) {
+          const int native_bit = HEIGHT - 1 - y;
+          red_pattern[x][native_bit / 8] |= 0x80 >> (native_bit % 8);
+        }
+      }
     }
+    built = true;
   }
 };
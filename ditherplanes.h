@@ -0,0 +1,4276 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef USE_ESP8266
+#include <pgmspace.h>
+#endif
+
+// Number of redness steps used for the dithered gradient of the bars.
+// This can be set as a build option (-DDITHER_LEVELS=n), to any power
+// of two up to DITHER_PLANES_MAX_LEVELS. Each level takes 2 kB of
+// flash. 0 uses the unquantized DITHER_MASK in dithermask.h instead
+// (256 steps, 16 kB, but a flash read and comparison per pixel).
+#ifndef DITHER_LEVELS
+#define DITHER_LEVELS 16
+#endif
+
+// Number of levels in DITHER_PLANES below. Change by regenerating the
+// table with scripts/make_dither_mask.py --levels N.
+#define DITHER_PLANES_MAX_LEVELS 32
+
+#if DITHER_LEVELS
+
+#if DITHER_LEVELS < 0 || DITHER_LEVELS > DITHER_PLANES_MAX_LEVELS || \
+  (DITHER_LEVELS & (DITHER_LEVELS - 1)) != 0
+#error "DITHER_LEVELS must be 0 or a power of two up to DITHER_PLANES_MAX_LEVELS"
+#endif
+
+#define DITHER_PLANE_SELECTED(level) \
+  ((level) % (DITHER_PLANES_MAX_LEVELS / DITHER_LEVELS) == 0)
+
+// The blue noise dither mask of dithermask.h pre-thresholded for each
+// redness level: bit (x % 32) of DITHER_PLANES[level - 1][y][x / 32] is
+// set if the pixel at (x, y) is red at that level. Level n represents
+// redness n * 256 / DITHER_LEVELS (but at most 255).
+
+static const uint32_t DITHER_PLANES[DITHER_LEVELS][128][4]
+#ifdef USE_ESP8266
+// ESP8266 requires special handling to keep this in flash and not to
+// waste RAM (without this, the whole array would be copied to RAM)
+PROGMEM
+#endif
+= {
+#if DITHER_PLANE_SELECTED(1)
+  {  // level 1: redness 8
+    {0x00000101, 0x10000000, 0x00020000, 0x00000000},
+    {0x00040000, 0x00200000, 0x00000000, 0x08004000},
+    {0x00000000, 0x00004000, 0x00000000, 0x00400208},
+    {0x08400010, 0x00000081, 0x10000010, 0x00000000},
+    {0x00004000, 0x00000000, 0x00000000, 0x00000000},
+    {0x00000000, 0x80000000, 0x00840000, 0x00040000},
+    {0x00040000, 0x00000000, 0x00000400, 0x10002000},
+    {0x00000000, 0x04000000, 0x00000020, 0x00000080},
+    {0x00000420, 0x00040808, 0x00000000, 0x00000001},
+    {0x10000001, 0x00000000, 0x00000000, 0x00400000},
+    {0x00200000, 0x00000000, 0x04080000, 0x00010000},
+    {0x00000000, 0x20000000, 0x00000104, 0x00000000},
+    {0x00004100, 0x00000000, 0x00004000, 0x00000010},
+    {0x00000000, 0x00104080, 0x40000000, 0x08000800},
+    {0x00000004, 0x00000001, 0x00200000, 0x00840000},
+    {0x04000000, 0x02000000, 0x00000000, 0x00000000},
+    {0x00000000, 0x80000000, 0x00000800, 0x00000004},
+    {0x00100100, 0x00000000, 0x02000080, 0x00004080},
+    {0x00004000, 0x00000410, 0x40000000, 0x00000000},
+    {0x00000008, 0x00010000, 0x00008000, 0x00800000},
+    {0x20000000, 0x08000000, 0x00000000, 0x00000800},
+    {0x00040000, 0x00400000, 0x00400001, 0x40020010},
+    {0x00000000, 0x00000002, 0x80000000, 0x00000000},
+    {0x00804080, 0x00001040, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000000, 0x00020800, 0x00000000},
+    {0x00000000, 0x10040000, 0x04000020, 0x00000800},
+    {0x00040000, 0x00000000, 0x00000000, 0x40800000},
+    {0x10000400, 0x00800104, 0x80400001, 0x00008000},
+    {0x00000008, 0x00002000, 0x00002000, 0x00000080},
+    {0x00400000, 0x00000000, 0x00040000, 0x00080000},
+    {0x00000000, 0x00000000, 0x00000200, 0x10000000},
+    {0x00001000, 0x10020000, 0x02000004, 0x00000000},
+    {0x08020080, 0x00000081, 0x20000000, 0x01008000},
+    {0x00000000, 0x00400000, 0x00100000, 0x80000084},
+    {0x00200000, 0x00000000, 0x00008040, 0x00100000},
+    {0x00000008, 0x00000000, 0x00000000, 0x00000800},
+    {0x02000800, 0x00020808, 0x00000400, 0x00000000},
+    {0x00000000, 0x00000000, 0x21000004, 0x10000000},
+    {0x00020000, 0x08000000, 0x00080000, 0x00000000},
+    {0x00000000, 0x00000000, 0x00000000, 0x00000020},
+    {0x80400080, 0x00200080, 0x00004000, 0x00820800},
+    {0x00000002, 0x00000000, 0x00000000, 0x00000001},
+    {0x00001000, 0x00000000, 0x00000200, 0x00000000},
+    {0x00040000, 0x00004008, 0x08200010, 0x00000000},
+    {0x21000000, 0x20000000, 0x00000000, 0x00000080},
+    {0x00000000, 0x00000000, 0x00004000, 0x04021000},
+    {0x00000000, 0x00200100, 0x00000000, 0x80200004},
+    {0x00004040, 0x00000000, 0x00040200, 0x00000000},
+    {0x00000000, 0x04000004, 0x20800000, 0x00000000},
+    {0x10000000, 0x00000000, 0x00000010, 0x00000000},
+    {0x00000004, 0x00000000, 0x00000000, 0x00010400},
+    {0x00200000, 0x40020840, 0x00010000, 0x04200000},
+    {0x00008000, 0x00000000, 0x00000200, 0x00000020},
+    {0x00000200, 0x00800000, 0x40200000, 0x00000000},
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000},
+    {0x08000002, 0x10000004, 0x00000000, 0x00100800},
+    {0x00200000, 0x00002100, 0x00000040, 0x00008000},
+    {0x00010800, 0x00400000, 0x02041002, 0x08000010},
+    {0x00000040, 0x00020000, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000001, 0x00000000, 0x00000000},
+    {0x00400000, 0x04000000, 0x00000000, 0x00200800},
+    {0x00000000, 0x00000020, 0x00000000, 0x00010001},
+    {0x20002000, 0x00201000, 0x00000041, 0x00000080},
+    {0x00000101, 0x00000000, 0x00082000, 0x01000000},
+    {0x01000000, 0x00000000, 0x01000000, 0x00000000},
+    {0x00040000, 0x00000000, 0x20000000, 0x00000008},
+    {0x00000010, 0x00000010, 0x00000000, 0x00080000},
+    {0x00002000, 0x80810000, 0x00000000, 0x20002000},
+    {0x00000000, 0x00000101, 0x00000020, 0x00000000},
+    {0x02000100, 0x08000000, 0x08420400, 0x00000082},
+    {0x00080000, 0x00002000, 0x00000000, 0x00000000},
+    {0x00000004, 0x00000000, 0x00000000, 0x02040000},
+    {0x00004000, 0x00000000, 0x00000000, 0x00000800},
+    {0x20000000, 0x00040000, 0x00002002, 0x40000000},
+    {0x00000000, 0x04000408, 0x00200000, 0x00000000},
+    {0x00200080, 0x00000000, 0x08000080, 0x00100002},
+    {0x00000000, 0x00000000, 0x00000000, 0x00004040},
+    {0x00000000, 0x00000000, 0x00000000, 0x08000000},
+    {0x00020002, 0x00000000, 0x00008400, 0x00000000},
+    {0x10001000, 0x08202000, 0x00000020, 0x00400000},
+    {0x00000080, 0x00000000, 0x80000001, 0x00000400},
+    {0x00000000, 0x00000042, 0x00080000, 0x00000000},
+    {0x00100000, 0x00040000, 0x01002000, 0x00000000},
+    {0x00008004, 0x00000000, 0x00000100, 0x01008010},
+    {0x00000040, 0x84000000, 0x00000000, 0x20000000},
+    {0x00000000, 0x00004000, 0x00000000, 0x00000000},
+    {0x04000400, 0x00000100, 0x00020000, 0x00000000},
+    {0x00100000, 0x00100004, 0x40001010, 0x00100400},
+    {0x00004002, 0x00000000, 0x00000000, 0x02000000},
+    {0x00000000, 0x80000000, 0x00800000, 0x00008020},
+    {0x00000000, 0x02000000, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000840, 0x00040200, 0x00000000},
+    {0x00400420, 0x00020000, 0x00000010, 0x00400000},
+    {0x20000000, 0x00000000, 0x00000000, 0x10000802},
+    {0x00020000, 0x00200000, 0x04004000, 0x00000000},
+    {0x00000002, 0x04000010, 0x00100000, 0x00020000},
+    {0x00000000, 0x00000000, 0x00000008, 0x00000000},
+    {0x01001080, 0x40000800, 0x00000100, 0x00800080},
+    {0x00000000, 0x00040000, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000000, 0x20800000, 0x20000000},
+    {0x20000008, 0x01000000, 0x00021000, 0x00001004},
+    {0x00100000, 0x00000008, 0x00000000, 0x00000000},
+    {0x00004000, 0x80000000, 0x00000000, 0x00040000},
+    {0x00000000, 0x00100100, 0x00000000, 0x00000000},
+    {0x00000000, 0x00008000, 0x00200040, 0x01000040},
+    {0x00000108, 0x00000000, 0x10000000, 0x40000002},
+    {0x02100000, 0x10800021, 0x00000000, 0x00002000},
+    {0x00000000, 0x00000000, 0x00004200, 0x00080000},
+    {0x00008000, 0x00000000, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000400, 0x00200001, 0x02000004},
+    {0x00000004, 0x04200000, 0x00000000, 0x00000100},
+    {0x00000000, 0x00010020, 0x04000080, 0x00000000},
+    {0x10200000, 0x00000000, 0x00000000, 0x10200000},
+    {0x00000200, 0x00000002, 0x00041000, 0x00004000},
+    {0x00008000, 0x00000200, 0x00800000, 0x00000000},
+    {0x00000000, 0x10200000, 0x20000004, 0x00040008},
+    {0x00000004, 0x00000000, 0x00000000, 0x00000000},
+    {0x00000000, 0x00002000, 0x00000080, 0x01000200},
+    {0x80000000, 0x00040000, 0x00040000, 0x00000000},
+    {0x02041000, 0x00000040, 0x00801000, 0x20004000},
+    {0x00000080, 0x00000000, 0x80000000, 0x00080000},
+    {0x00000000, 0x01000000, 0x00000010, 0x00000000},
+    {0x00000000, 0x40000000, 0x00000200, 0x00000000},
+    {0x00000004, 0x00020000, 0x04020000, 0x00000020},
+    {0x00000400, 0x00000400, 0x00000000, 0x02000000},
+    {0x10208000, 0x00000008, 0x00000000, 0x00001000},
+    {0x00000000, 0x01000000, 0x80000042, 0x00040000},
+    {0x00000000, 0x00000000, 0x00801000, 0x00000000},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(2)
+  {  // level 2: redness 16
+    {0x00001111, 0x10000000, 0x00020000, 0x00000000},
+    {0x00040000, 0x00200408, 0x00000000, 0x08004000},
+    {0x00000000, 0x00004000, 0x02200201, 0x00440208},
+    {0x08400010, 0x02000081, 0x10004010, 0x00000001},
+    {0x00004200, 0x10040000, 0x00000000, 0x00000040},
+    {0x00000001, 0x80000410, 0x00840000, 0x01040400},
+    {0x00040000, 0x00404000, 0x00000400, 0x10002008},
+    {0x81000000, 0x04000000, 0x10004020, 0x00000080},
+    {0x00004420, 0x00040888, 0x00000001, 0x00000001},
+    {0x10000001, 0x00000000, 0x00400000, 0x04400400},
+    {0x00220000, 0x00208001, 0x04080800, 0x00010000},
+    {0x00000010, 0x21000400, 0x00000104, 0x00100002},
+    {0x21004100, 0x00000008, 0x00004000, 0x40000010},
+    {0x00040000, 0x00104080, 0x40000020, 0x08004880},
+    {0x00000004, 0x00000801, 0x04200000, 0x00840000},
+    {0x04400820, 0x12020000, 0x00010000, 0x00000000},
+    {0x20010000, 0x80000080, 0x00000808, 0x40000404},
+    {0x00100100, 0x00102000, 0x02000080, 0x00004080},
+    {0x00004000, 0x01000411, 0x40080000, 0x08080000},
+    {0x01000008, 0x00010000, 0x00008000, 0x00800002},
+    {0x20000040, 0x08000080, 0x00000400, 0x00000800},
+    {0x00040400, 0x00400000, 0x08400021, 0x40020010},
+    {0x00000000, 0x00010002, 0x80004000, 0x00200000},
+    {0x08804080, 0x02001040, 0x00000000, 0x04004080},
+    {0x00000004, 0x00200000, 0x00120804, 0x00000000},
+    {0x80000000, 0x10040000, 0x04000020, 0x00080800},
+    {0x01040000, 0x00000000, 0x00000100, 0x40800008},
+    {0x10004440, 0x00810104, 0x80400001, 0x04008000},
+    {0x00000008, 0x00002000, 0x08002000, 0x00000080},
+    {0x80440000, 0x00100000, 0x00040020, 0x80480000},
+    {0x00000000, 0x02000010, 0x00400200, 0x10000811},
+    {0x00001004, 0x90020000, 0x02010004, 0x00000000},
+    {0x09020080, 0x00001081, 0x20001000, 0x01008000},
+    {0x00000000, 0x00400000, 0x00100000, 0x80000084},
+    {0x00200000, 0x04008000, 0x04008040, 0x08100000},
+    {0x00008008, 0x40000000, 0x00000000, 0x00000800},
+    {0x42000880, 0x00020888, 0x00000400, 0x01010010},
+    {0x00100001, 0x00800000, 0x21004004, 0x10000102},
+    {0x00020000, 0x08000000, 0x00080000, 0x00102000},
+    {0x00002010, 0x00044008, 0x00000440, 0x00000020},
+    {0x88400080, 0x00200080, 0x10004000, 0x00820800},
+    {0x00000002, 0x10000000, 0x01000001, 0x10000101},
+    {0x00001000, 0x00000400, 0x00020200, 0x00104010},
+    {0x00040000, 0x02044008, 0x08200010, 0x01000000},
+    {0x21008210, 0x20000000, 0x40000000, 0x00000080},
+    {0x00000000, 0x00000001, 0x00004000, 0x04021000},
+    {0x00000000, 0x00200100, 0x04000040, 0x80200004},
+    {0x00104044, 0x00048820, 0x00040201, 0x00000000},
+    {0x01000000, 0x04000004, 0x20800000, 0x11002040},
+    {0x10020400, 0x00000000, 0x00002010, 0x00000000},
+    {0x00000044, 0x00200000, 0x00100000, 0x00010402},
+    {0x00200000, 0x40020840, 0x00010000, 0x04200000},
+    {0x82008000, 0x04000008, 0x04000240, 0x40002020},
+    {0x00000220, 0x00804000, 0x40200004, 0x00020100},
+    {0x00042000, 0x00080000, 0x00004000, 0x00000000},
+    {0x08000002, 0x10000004, 0x00000000, 0x21100802},
+    {0x41200000, 0x00002100, 0x00400240, 0x00008000},
+    {0x00010800, 0x02400020, 0x02041002, 0x08000110},
+    {0x00000044, 0x00020000, 0x20000000, 0x00040000},
+    {0x04000000, 0x40000001, 0x00000010, 0x81000000},
+    {0x00400400, 0x04004200, 0x00410200, 0x00200800},
+    {0x00040010, 0x00000020, 0x08000000, 0x00010011},
+    {0x20002000, 0x00201000, 0x00000041, 0x10000080},
+    {0x00000101, 0x01020002, 0x00082000, 0x01100000},
+    {0x01000000, 0x08000100, 0x01010000, 0x00008000},
+    {0x00040000, 0x00100000, 0x20000208, 0x00000409},
+    {0x10000410, 0x00001010, 0x00100000, 0x04080040},
+    {0x00202000, 0x80810000, 0x00004000, 0x20802000},
+    {0x00010001, 0x00000101, 0x00000020, 0x00010000},
+    {0x02000100, 0x08080000, 0x08420404, 0x00000082},
+    {0x10080000, 0x00002010, 0x00000000, 0x10200000},
+    {0x00400804, 0x40000000, 0x00000000, 0x02040000},
+    {0x00004040, 0x00400081, 0x42000220, 0x00008810},
+    {0x20000000, 0x00040000, 0x00002002, 0x40000100},
+    {0x02020000, 0x04004408, 0x00220000, 0x00000000},
+    {0x00200888, 0x00000000, 0x08000080, 0x01100002},
+    {0x10004000, 0x40800000, 0x00000008, 0x40004440},
+    {0x00000000, 0x00020081, 0x40080000, 0x08000000},
+    {0x00020002, 0x00000410, 0x00808400, 0x00000000},
+    {0x10801010, 0x08202000, 0x08000020, 0x00420008},
+    {0x00000080, 0x01000000, 0x80000001, 0x22002480},
+    {0x00000000, 0x00000042, 0x00080000, 0x00000000},
+    {0x02100400, 0x00044400, 0x01002000, 0x00000000},
+    {0x00008004, 0x00400000, 0x20010108, 0x01088012},
+    {0x40000040, 0x84000010, 0x00000000, 0x20001100},
+    {0x00800000, 0x00004000, 0x00200000, 0x00000000},
+    {0x04020400, 0x00020100, 0x04020000, 0x00010000},
+    {0x00100000, 0x11100804, 0x40001110, 0x00100404},
+    {0x00004042, 0x00000020, 0x00100000, 0x02000000},
+    {0x40800400, 0x80008000, 0x00800000, 0x20008020},
+    {0x04040000, 0x02200000, 0x04004000, 0x00000202},
+    {0x00000000, 0x00000840, 0x20040200, 0x00040000},
+    {0x00404421, 0x10020002, 0x00000010, 0x02404000},
+    {0x20000000, 0x80000000, 0x00800000, 0x10000842},
+    {0x02020000, 0x00200100, 0x04004080, 0x00000000},
+    {0x00000002, 0x04004010, 0x00100800, 0x00020000},
+    {0x10100010, 0x00000000, 0x80000008, 0x08102008},
+    {0x01001080, 0x40400801, 0x04010100, 0x00800480},
+    {0x00020001, 0x08040080, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000000, 0x20800002, 0x20010000},
+    {0x20000008, 0x01004000, 0x00121010, 0x02201024},
+    {0x00100200, 0x00020808, 0x00000100, 0x00000100},
+    {0x02004041, 0x88000001, 0x82000000, 0x00040000},
+    {0x00000000, 0x00100100, 0x00004000, 0x08008000},
+    {0x20020000, 0x00008000, 0x00220840, 0x01000440},
+    {0x00001108, 0x00000800, 0x10000004, 0x40000002},
+    {0x02100000, 0x10800021, 0x00000000, 0x00002000},
+    {0x00000000, 0x00040000, 0x02004200, 0x08480200},
+    {0x20008000, 0x00004000, 0x00000000, 0x00000020},
+    {0x00000440, 0x00000404, 0x00220011, 0x42000004},
+    {0x01040004, 0x04200000, 0x40000800, 0x00011100},
+    {0x00002000, 0x00010020, 0x04000080, 0x00000000},
+    {0x10200000, 0x40000000, 0x00008004, 0x10200010},
+    {0x00000222, 0x01002002, 0x00041000, 0x01004001},
+    {0x00008000, 0x00020200, 0x00800020, 0x00000880},
+    {0x01001000, 0x10200000, 0x20000004, 0x40040008},
+    {0x10100044, 0x00000010, 0x04208400, 0x08000000},
+    {0x00008200, 0x02002000, 0x00000080, 0x01200201},
+    {0x80000000, 0x80040000, 0x00040008, 0x00000000},
+    {0x02041008, 0x10000440, 0x08801000, 0x20004010},
+    {0x00000081, 0x00200008, 0x80008000, 0x04080000},
+    {0x10408000, 0x01002000, 0x00000010, 0x00801000},
+    {0x00000000, 0x40000001, 0x00000202, 0x00000200},
+    {0x02040004, 0x00020040, 0x24222000, 0x00010022},
+    {0x00000400, 0x08200400, 0x00000000, 0x22200000},
+    {0x10208020, 0x00000008, 0x00000000, 0x00001000},
+    {0x00000000, 0x01004000, 0x80100242, 0x00040208},
+    {0x82000000, 0x00040080, 0x08801000, 0x00800040},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(3)
+  {  // level 3: redness 24
+    {0x00201111, 0x12000020, 0x00020010, 0x00100802},
+    {0x20048000, 0x00220408, 0x40000080, 0x08004000},
+    {0x01000882, 0x00004000, 0x02200201, 0x00440208},
+    {0x08400010, 0x02400081, 0x10024810, 0x44001001},
+    {0x00024200, 0x10041000, 0x00000000, 0x00008040},
+    {0x40001041, 0x80000414, 0x40840080, 0x01040400},
+    {0x08240000, 0x00414080, 0x00000404, 0x10202008},
+    {0x81000004, 0x04000000, 0x12104020, 0x00000080},
+    {0x00004420, 0x21040888, 0x00000101, 0x00040001},
+    {0x10000081, 0x00000000, 0x00410000, 0x24402420},
+    {0x02220000, 0x00208021, 0x24080820, 0x00010000},
+    {0x00000810, 0x21000400, 0x00000104, 0x01100102},
+    {0x21004102, 0x04020008, 0x00804000, 0x40000010},
+    {0x00240000, 0x00104080, 0x40041021, 0x08004880},
+    {0x00004104, 0x00000801, 0x04200200, 0x00840000},
+    {0x04400820, 0x12420008, 0x00010000, 0x00000021},
+    {0x20010000, 0x80000080, 0x10000808, 0x42210404},
+    {0x00100100, 0x00102000, 0x02402080, 0x00004080},
+    {0x08044801, 0x01000411, 0x40080020, 0x08080010},
+    {0x01000008, 0x40010000, 0x00008004, 0x00800002},
+    {0x20208040, 0x08081080, 0x02000400, 0x00004900},
+    {0x02040402, 0x00400210, 0x08440021, 0x42020010},
+    {0x00000000, 0x00010002, 0x80004100, 0x00200000},
+    {0x48804090, 0x42001040, 0x01000000, 0x04004484},
+    {0x00110804, 0x00200208, 0x20120804, 0x20820000},
+    {0x80000100, 0x10044000, 0x04000020, 0x00080840},
+    {0x01040002, 0x02000820, 0x00008100, 0x40800008},
+    {0x10204440, 0x00810104, 0x80480809, 0x04008400},
+    {0x00000008, 0x10002000, 0x08002000, 0x00000084},
+    {0x84440000, 0x00100080, 0x20040020, 0x80484000},
+    {0x00008200, 0x02408410, 0x00400200, 0x12000811},
+    {0x20101024, 0x90020000, 0x02010044, 0x00000100},
+    {0x09020080, 0x00081081, 0x20001000, 0x01248000},
+    {0x00000400, 0x00400008, 0x00100200, 0x80001084},
+    {0x00202000, 0x04008200, 0x84008044, 0x08100000},
+    {0x10048008, 0x40100000, 0x00440000, 0x00000800},
+    {0x42000880, 0x00024888, 0x00000420, 0x01010010},
+    {0x00100001, 0x00800001, 0x21004004, 0x10000102},
+    {0x10020000, 0x88000000, 0x04080000, 0x00102000},
+    {0x01002410, 0x00044408, 0x00020440, 0x44000020},
+    {0x88480080, 0x01200080, 0x10204008, 0x00820804},
+    {0x00010002, 0x10010000, 0x01000001, 0x10000101},
+    {0x04001000, 0x00000401, 0x00022200, 0x00104010},
+    {0x00240040, 0x02444048, 0x08200090, 0x41000400},
+    {0x21008212, 0x20000000, 0x41000802, 0x00000080},
+    {0x00000000, 0x08001001, 0x00024000, 0x04021010},
+    {0x08420800, 0x01200100, 0x04200048, 0x80208004},
+    {0x00104044, 0x00048820, 0x00040201, 0x00000201},
+    {0x81000000, 0x24000004, 0x20808000, 0x11082040},
+    {0x10020400, 0x00000100, 0x04002490, 0x80000010},
+    {0x00002044, 0x01204000, 0x00100002, 0x00010402},
+    {0x00240000, 0x40020840, 0x20810000, 0x04200000},
+    {0x92008002, 0x04000008, 0x04001240, 0x40802020},
+    {0x00400220, 0x00804200, 0x40200004, 0x08020108},
+    {0x00042000, 0x80080020, 0x01044000, 0x00000000},
+    {0x08000002, 0x10010004, 0x08000010, 0x21100842},
+    {0x41200110, 0x00002100, 0x40400240, 0x00008000},
+    {0x00010800, 0x02400020, 0x02049002, 0x08401110},
+    {0x00080044, 0x00020800, 0x20000000, 0x00040002},
+    {0x24004000, 0x40100009, 0x00000090, 0x81004080},
+    {0x00400480, 0x04804200, 0x00491200, 0x08200800},
+    {0x00040012, 0x10040020, 0x09000000, 0x00010011},
+    {0x24002000, 0x00201000, 0x20000049, 0x10000080},
+    {0x00200921, 0x01020002, 0x00082400, 0x01101000},
+    {0x01008000, 0x48004120, 0x01410000, 0x20008000},
+    {0x80040002, 0x00100000, 0x20000248, 0x00400409},
+    {0x10000490, 0x04001010, 0x00120800, 0x04080040},
+    {0x01202000, 0x80810000, 0x02004000, 0x20802000},
+    {0x00010001, 0x00000101, 0x40000020, 0x00010000},
+    {0x02000120, 0x08080004, 0x08420484, 0x00000492},
+    {0x10080000, 0x01002410, 0x00004000, 0x90202000},
+    {0x00420804, 0x40010000, 0x00080000, 0x02040000},
+    {0x02004040, 0x00400081, 0x52400220, 0x00008812},
+    {0x20100200, 0x10040000, 0x00002002, 0x40400100},
+    {0x02020002, 0x04004448, 0x00220400, 0x08001000},
+    {0x00200888, 0x00100001, 0x09008080, 0x01120002},
+    {0x10004000, 0x40802000, 0x00001008, 0x40004448},
+    {0x02000020, 0x04020081, 0x40080000, 0x08000000},
+    {0x00120202, 0x00000410, 0x00808402, 0x00000000},
+    {0x10801010, 0x08202000, 0x08000020, 0x00420008},
+    {0x80004080, 0x01010000, 0x80011101, 0x22102480},
+    {0x00020001, 0x00000042, 0x00480008, 0x00000000},
+    {0x12100420, 0x20044400, 0x01002000, 0x08000000},
+    {0x00008004, 0x00400000, 0x24010108, 0x01088012},
+    {0x40080040, 0x84100892, 0x00080840, 0x20201100},
+    {0x00802000, 0x00004000, 0x80200000, 0x00000000},
+    {0x04020408, 0x00020100, 0x04820002, 0x88812040},
+    {0x20100000, 0x11100804, 0x40009110, 0x00100404},
+    {0x00004042, 0x00000020, 0x10100000, 0x02040000},
+    {0x40800400, 0x80048100, 0x00800400, 0x20409020},
+    {0x04040008, 0x02200008, 0x04004044, 0x00000202},
+    {0x00000080, 0x00000840, 0x20240200, 0x00040000},
+    {0x00404421, 0x10024002, 0x00001010, 0x02404010},
+    {0x20100000, 0x81000000, 0x00800000, 0x10100842},
+    {0x02020000, 0x00200901, 0x24024082, 0x00000100},
+    {0x00004202, 0x04044010, 0x00100800, 0x41020000},
+    {0x10100010, 0x00000000, 0x80800008, 0x08102008},
+    {0x01001080, 0x40408801, 0x04092100, 0x00800480},
+    {0x00220001, 0x08040088, 0x00000040, 0x00040001},
+    {0x04004040, 0x00000200, 0x20800402, 0x20010000},
+    {0x20800808, 0x21204000, 0x00121010, 0x02201024},
+    {0x00120200, 0x00020848, 0x00000100, 0x00000100},
+    {0x02004041, 0x88000001, 0x92400004, 0x20040000},
+    {0x00000000, 0x01102100, 0x00004000, 0x08009008},
+    {0x28420000, 0x00008008, 0x00220840, 0x01200440},
+    {0x00001108, 0x04000800, 0x11000004, 0x40000002},
+    {0x02100020, 0x90900221, 0x00080000, 0x00012010},
+    {0x00020002, 0x00040000, 0x42004240, 0x08480200},
+    {0x20409000, 0x01004080, 0x08000000, 0x00000020},
+    {0x08000440, 0x20000404, 0x00220011, 0x42000004},
+    {0x01040004, 0x04200000, 0x41004800, 0x00891100},
+    {0x80012080, 0x00011120, 0x04000080, 0x00000000},
+    {0x10200000, 0x40080000, 0x00208004, 0x90200210},
+    {0x02000222, 0x09002002, 0x10041200, 0x01024001},
+    {0x40048000, 0x00020240, 0x00800020, 0x00000880},
+    {0x01001000, 0x90200800, 0x20000004, 0x40040008},
+    {0x10100044, 0x00008012, 0x0420a400, 0x08008020},
+    {0x00008200, 0x02402100, 0x00000080, 0x81201201},
+    {0x80400000, 0x80040000, 0x00040008, 0x00000000},
+    {0x12041008, 0x10000440, 0x08801000, 0x20024090},
+    {0x00000481, 0x00210008, 0x80108080, 0x04080004},
+    {0x10408010, 0x09002000, 0x00000010, 0x00801000},
+    {0x00001000, 0x40080201, 0x01000202, 0x10000200},
+    {0x02040084, 0x00024040, 0x24222080, 0x00090022},
+    {0x80000400, 0x08200400, 0x00000010, 0x22200080},
+    {0x10209021, 0x00000008, 0x01000000, 0x00001000},
+    {0x00040000, 0x41004000, 0x80108242, 0x04048208},
+    {0x82000000, 0x00040880, 0x08801000, 0x20800040},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(4)
+  {  // level 4: redness 32
+    {0x08201111, 0x12004020, 0x00020410, 0x00100802},
+    {0x20048000, 0x00220408, 0x40884084, 0x09014040},
+    {0x01000882, 0x40084000, 0x02200201, 0x00440208},
+    {0x08500010, 0x024000a1, 0x10024810, 0x44001001},
+    {0x00024200, 0x10041000, 0x00200004, 0x00208040},
+    {0x41001049, 0x82000414, 0x44841080, 0x01040402},
+    {0x08240100, 0x00514080, 0x00010404, 0x10202008},
+    {0x81010004, 0x04000000, 0x12104020, 0x42010480},
+    {0x00084420, 0x2104088a, 0x00001101, 0x00040001},
+    {0x10801081, 0x08000000, 0x00410008, 0x24402428},
+    {0x02220004, 0x8028a121, 0xa4080820, 0x00010000},
+    {0x00000810, 0x21000400, 0x00210104, 0x09101102},
+    {0x21004102, 0x04020009, 0x08804000, 0x40020010},
+    {0x08240020, 0x20904080, 0x40041021, 0x08204884},
+    {0x00004104, 0x00000821, 0x04200204, 0x00840200},
+    {0x04440821, 0x12420208, 0x00814040, 0x10000021},
+    {0x20010000, 0x80008081, 0x10040808, 0x42210404},
+    {0x01100110, 0x08142000, 0x02402080, 0x00005080},
+    {0x08044801, 0x01000451, 0x40080221, 0x08080010},
+    {0x01000108, 0x40010000, 0x00008004, 0x00810002},
+    {0x20208040, 0x09081082, 0x22101400, 0x10104940},
+    {0x02041402, 0x00404210, 0x08440021, 0x42020010},
+    {0x00100000, 0x10090002, 0x80004108, 0x00200000},
+    {0x48804090, 0x42001040, 0x01000000, 0x84004484},
+    {0x00110804, 0x00a00208, 0x20522884, 0x20820000},
+    {0x84000100, 0x90044000, 0x04000020, 0x00080841},
+    {0x01040012, 0x02000820, 0x10008100, 0x40802008},
+    {0x90214440, 0x00890104, 0x81480809, 0x14108400},
+    {0x00001008, 0x10002000, 0x08012080, 0x000200a4},
+    {0x85440080, 0x80100080, 0x20040020, 0x80484000},
+    {0x00008201, 0x02408414, 0x00404a00, 0x12000811},
+    {0x20101024, 0x90020000, 0x0a090044, 0x00000100},
+    {0x09020080, 0x01081081, 0x20001010, 0x11248000},
+    {0x00000400, 0x20400008, 0x00900200, 0x800010a4},
+    {0x02202022, 0x04009221, 0x84008045, 0x09100200},
+    {0x10048008, 0x40100000, 0x10441000, 0x40004802},
+    {0x42800880, 0x12024888, 0x00010420, 0x01450050},
+    {0x00104101, 0x00900001, 0x21004104, 0x10000102},
+    {0x10020004, 0x88000120, 0x04480000, 0x00102400},
+    {0x01002410, 0x20044408, 0x80021440, 0x44008020},
+    {0x88480080, 0x01200080, 0x10204008, 0x00920804},
+    {0x00010012, 0x10011010, 0x01000041, 0x10000141},
+    {0x24001200, 0x00000401, 0x20022200, 0x04104010},
+    {0x00240040, 0x82544048, 0x08280090, 0x41020402},
+    {0x2100a212, 0x20000200, 0x41000802, 0x00400080},
+    {0x00000000, 0x08011009, 0x00024000, 0x14021010},
+    {0x08420800, 0x01200100, 0x24201048, 0x80208084},
+    {0x20104144, 0x00048820, 0x00040201, 0x00000201},
+    {0x81000010, 0x24400004, 0x20808000, 0x11092040},
+    {0x10120400, 0x00001120, 0x04002490, 0x80400010},
+    {0x01002044, 0x01284002, 0x00100002, 0x10012502},
+    {0x00240100, 0x50020840, 0x20850000, 0x04280000},
+    {0x92008802, 0x04000008, 0x04001250, 0x40802021},
+    {0x00400228, 0x00804280, 0x40200004, 0x08020508},
+    {0x00052080, 0x80080020, 0x01054900, 0x00004000},
+    {0x08000002, 0x12210805, 0x08000012, 0x21100842},
+    {0x41204110, 0x00002100, 0x40400240, 0x00048000},
+    {0x08010800, 0x22480020, 0x02049002, 0x48401110},
+    {0x00080044, 0x00028800, 0x20200000, 0x00040002},
+    {0x25004000, 0x40100089, 0x84000090, 0x81004088},
+    {0x00400480, 0x04804200, 0x00491202, 0x08200800},
+    {0x00050012, 0x10040021, 0x09004000, 0x41012011},
+    {0x24002000, 0x00201208, 0x20000049, 0x10040280},
+    {0x00280921, 0x01020002, 0x00082400, 0x01101004},
+    {0x09008000, 0x48004120, 0x01410000, 0x24008020},
+    {0x80042002, 0x00900404, 0x28000248, 0x00420409},
+    {0x10000490, 0x04041010, 0x00120802, 0x04080140},
+    {0x01282000, 0x80810000, 0x02004100, 0x20802004},
+    {0x08010009, 0x20004941, 0x40100020, 0x00090000},
+    {0x42401120, 0x08280004, 0x08420484, 0x02000492},
+    {0x10088000, 0x01002410, 0x81005001, 0x90202000},
+    {0x00420804, 0x44010000, 0x00080000, 0x02040100},
+    {0x02004040, 0x00501089, 0x524102a8, 0x00008812},
+    {0x20100210, 0x11040000, 0x00002002, 0x40480140},
+    {0x02022002, 0x84004448, 0x00220400, 0x08001000},
+    {0x00200888, 0x00110001, 0x490080a0, 0x01120002},
+    {0x10844000, 0x40802208, 0x00201008, 0x40004448},
+    {0x42000020, 0x04020081, 0x400a0080, 0x08880000},
+    {0x00120202, 0x00000410, 0x02808402, 0x40009100},
+    {0x10801010, 0x48282000, 0x08100020, 0x0042000a},
+    {0x84004084, 0x01010100, 0x80011101, 0x22102480},
+    {0x00020001, 0x0020104a, 0x10480048, 0x00010020},
+    {0x12500520, 0x24044400, 0x01002400, 0x08400400},
+    {0x00009004, 0x00400000, 0x2401010a, 0x01088012},
+    {0x48080041, 0x84110892, 0x00080840, 0x24201100},
+    {0x00802100, 0x20804000, 0x80204000, 0x00040008},
+    {0x04020408, 0x00020121, 0x04820402, 0x88812040},
+    {0x20100000, 0x11100804, 0x40009150, 0x00100404},
+    {0x02004142, 0x00002020, 0x10100000, 0x02040000},
+    {0x40800400, 0x90848101, 0x00820400, 0x204090a0},
+    {0x04151008, 0x02200008, 0x84004044, 0x88000202},
+    {0x40000080, 0x00000840, 0x20240201, 0x00040800},
+    {0x08404421, 0x10124202, 0x02009010, 0x02404010},
+    {0x20100008, 0x81000010, 0x00900000, 0x10100842},
+    {0x02021040, 0x00200901, 0x24024282, 0x00008100},
+    {0x00804202, 0x24044010, 0x00100820, 0x41020002},
+    {0x10110010, 0x00000040, 0x80800008, 0x08102008},
+    {0x01001080, 0x41508801, 0x14092101, 0x008004a0},
+    {0x20220205, 0x08042088, 0x00000040, 0x04044001},
+    {0x04004040, 0x00000201, 0x20800402, 0x20010200},
+    {0x20800808, 0x21204000, 0x04129010, 0x82201024},
+    {0x00120200, 0x00020848, 0x00000100, 0x00808100},
+    {0x12004041, 0x88000001, 0x92480824, 0x20040040},
+    {0x00100808, 0x01502100, 0x00004000, 0x08009008},
+    {0x28420000, 0x40028049, 0x40220a40, 0x01240440},
+    {0x00009109, 0x04000800, 0x11000004, 0x40000002},
+    {0x02100020, 0x90908221, 0x00090000, 0x02012090},
+    {0x00020102, 0x00041008, 0x42405248, 0x28480201},
+    {0xa2409000, 0x09204080, 0x08000000, 0x00004820},
+    {0x08100450, 0x20020404, 0x00220111, 0x42000004},
+    {0x01040004, 0x04200000, 0x41084800, 0x08891100},
+    {0x80012080, 0x00811120, 0x04000080, 0x00000042},
+    {0x10200800, 0x40080008, 0x00208025, 0x90200210},
+    {0x02000222, 0x09002002, 0x12041200, 0x01024001},
+    {0x40448008, 0x00020240, 0x00800020, 0x04000880},
+    {0x01001100, 0x92200800, 0x20040104, 0x40240009},
+    {0x14100044, 0x00088012, 0x0420a400, 0x08008020},
+    {0x00029200, 0x12402100, 0x010000a0, 0x81241201},
+    {0x80400020, 0x80040000, 0x20040008, 0x04000000},
+    {0x12041008, 0x11002442, 0x08801402, 0x20424490},
+    {0x00000481, 0x00210008, 0x80108080, 0x04080004},
+    {0x11508010, 0x09002080, 0x10042010, 0x00801040},
+    {0x00001000, 0x40080201, 0x01000202, 0x90004200},
+    {0x12048084, 0x01024048, 0xa4222080, 0x0009082a},
+    {0x80000400, 0x08201400, 0x00000811, 0x22a00080},
+    {0x10a09021, 0x00020088, 0x11040000, 0x00001000},
+    {0x00040104, 0x49204000, 0x80108242, 0x04048208},
+    {0x82008000, 0x00040882, 0x08801000, 0x20800040},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(5)
+  {  // level 5: redness 40
+    {0x08a01131, 0x92804020, 0x00020410, 0x00100912},
+    {0x20048000, 0x00220408, 0x48884084, 0x49014040},
+    {0x81004882, 0x48085004, 0x02200201, 0x00440208},
+    {0x08500010, 0x024002a1, 0x10024850, 0x44081001},
+    {0x10024200, 0x10049000, 0x00200004, 0x10208150},
+    {0x41001049, 0x82000414, 0x44841080, 0x01040402},
+    {0x08240900, 0x20514080, 0x00010404, 0x10202008},
+    {0x81010004, 0x04000420, 0x52504020, 0x42010480},
+    {0x04084420, 0x2144488a, 0x00041181, 0x00944001},
+    {0x30801081, 0x08000000, 0x01410008, 0x244024a8},
+    {0x02220104, 0x8028a121, 0xa4082820, 0x00010000},
+    {0x00090810, 0x21000408, 0x00210104, 0x09101102},
+    {0x21004102, 0x04021009, 0x08804440, 0x40020010},
+    {0x08240820, 0x20904080, 0x42041021, 0x4a204884},
+    {0x21004104, 0x00080821, 0x04200204, 0x00840200},
+    {0x04440821, 0x12420208, 0x40914040, 0x10002021},
+    {0x20012000, 0x80009081, 0x10040808, 0x42250404},
+    {0x01100154, 0x08142004, 0x02402080, 0x00805080},
+    {0x08444801, 0x21400451, 0x48090221, 0x48080211},
+    {0x41000108, 0x40010000, 0x00808004, 0x00810002},
+    {0x20208040, 0x09081082, 0x22101480, 0x10104940},
+    {0x0a041412, 0x00404210, 0x08450021, 0x42820012},
+    {0x00120000, 0x10090402, 0x80004108, 0x00201000},
+    {0x48804290, 0x42001040, 0x09000401, 0x84084484},
+    {0x00110804, 0x00a10208, 0x20522884, 0x20828010},
+    {0x94402100, 0x90044082, 0x04040020, 0x04080841},
+    {0x01040012, 0x02200820, 0x10008100, 0x40802108},
+    {0x90214441, 0x20890104, 0x81480809, 0x14108400},
+    {0x00081008, 0x14002020, 0x08012080, 0x010200a4},
+    {0x95440080, 0x80120880, 0x21240024, 0x80484200},
+    {0x00008201, 0x02408414, 0x00404a00, 0x12000811},
+    {0x20101024, 0x90020000, 0x0a090044, 0x00011104},
+    {0x09424088, 0x010852a1, 0xa0001010, 0x11248000},
+    {0x20080400, 0x20400008, 0x00922200, 0x800010a4},
+    {0x02202222, 0x04049221, 0x84008145, 0x09120200},
+    {0x10048008, 0x40900000, 0x12441000, 0x40004802},
+    {0x42800880, 0x12024888, 0x00110420, 0x09450050},
+    {0x00104121, 0x00900001, 0xa1004104, 0x10000102},
+    {0x14230004, 0x88011120, 0x04480010, 0x01142408},
+    {0x01002410, 0x2084440a, 0x80021442, 0x44008120},
+    {0x88480480, 0x01200080, 0x12204008, 0x00920804},
+    {0x00014012, 0x14091010, 0x01080441, 0x90000141},
+    {0x24801200, 0x00000501, 0x20022204, 0x04104010},
+    {0x00240040, 0x82544048, 0x08288090, 0x41022402},
+    {0x2100a212, 0x21000200, 0x41000802, 0x00400280},
+    {0x00080088, 0x08011049, 0x00024100, 0x140a1011},
+    {0x0a420800, 0x41282102, 0x25201048, 0x81208084},
+    {0x20104144, 0x00048820, 0x00040201, 0x00000a01},
+    {0x81001011, 0x24400004, 0x20908004, 0x15092040},
+    {0x10128400, 0x08011120, 0x84022490, 0x80400010},
+    {0x45002044, 0x01284202, 0x02100102, 0x1001250a},
+    {0x00240110, 0x50020840, 0x20854001, 0x04280040},
+    {0x92008802, 0x04200008, 0x04001250, 0x4080a021},
+    {0x00400228, 0x20825282, 0x40200004, 0x080a0508},
+    {0x22152080, 0x80080020, 0x11054900, 0x80404000},
+    {0x08000802, 0x12210805, 0x08100012, 0x2510094a},
+    {0x41204110, 0x00002100, 0x40400240, 0x00048000},
+    {0x08410801, 0xa2480224, 0x02049002, 0x48401110},
+    {0x000a0244, 0x08028800, 0x21204408, 0x02050402},
+    {0x25105010, 0x40100089, 0x84000090, 0x81004088},
+    {0x10400480, 0x04805200, 0x00491202, 0x08280840},
+    {0x00050012, 0x10040021, 0x09004000, 0x41012011},
+    {0x24802000, 0x42209288, 0x20220149, 0x10440280},
+    {0x00280921, 0x01120002, 0x84082400, 0x01101004},
+    {0x49008208, 0x48004120, 0x01410022, 0x24008020},
+    {0x80442002, 0x00908404, 0x28002248, 0x00424409},
+    {0x10010490, 0x14041090, 0x00120802, 0x84080140},
+    {0x01282000, 0x80a10004, 0x02804100, 0x20802804},
+    {0x08010409, 0x22004941, 0x50110020, 0x08290020},
+    {0x42401120, 0x082a0004, 0x08420494, 0x02000492},
+    {0x10088000, 0x01002450, 0x81005001, 0x90212000},
+    {0x80420914, 0x44010000, 0x00080000, 0x02840100},
+    {0x02004041, 0x00509289, 0x52410aa8, 0x10008812},
+    {0x28900210, 0x11040000, 0x00082002, 0x40480140},
+    {0x02032002, 0x84004448, 0x04220400, 0x0a009008},
+    {0x00200888, 0x00110001, 0x490080a0, 0x01120202},
+    {0x10844201, 0x50902a08, 0x0020120a, 0x40004448},
+    {0x42001020, 0x04020081, 0x500a0080, 0x08a80001},
+    {0x00128282, 0x00808410, 0x0280a402, 0x44009120},
+    {0x10c01010, 0x48282044, 0x08100028, 0x0042000a},
+    {0x84084484, 0x01010100, 0x82011101, 0x22102480},
+    {0x00020001, 0x1020104a, 0x10480048, 0x00050020},
+    {0x52500520, 0x25044400, 0x01022400, 0x48402401},
+    {0x01029004, 0x00400100, 0x2441010a, 0x01088092},
+    {0x48080041, 0x84110892, 0x00080840, 0x24201100},
+    {0x00802110, 0x20804000, 0x90204010, 0x00040008},
+    {0x04428408, 0x00020121, 0x04820402, 0x88812240},
+    {0x20101000, 0x95310804, 0x40089150, 0x20104405},
+    {0x02044152, 0x00002020, 0x12100004, 0x02040000},
+    {0x50800400, 0x90848501, 0x00821400, 0x204090a8},
+    {0x04151008, 0x02200008, 0x84004044, 0x89100202},
+    {0x40000080, 0x20042840, 0x20240201, 0x00050800},
+    {0x09424421, 0x14124202, 0x12009050, 0x02404110},
+    {0x20100108, 0x81000050, 0x80900008, 0x50100842},
+    {0x02021040, 0x00a10901, 0x24024282, 0x04048110},
+    {0x40884202, 0x24044010, 0x00100820, 0x41420802},
+    {0x14110810, 0x00000244, 0x81808008, 0x08102008},
+    {0x01001080, 0x41508801, 0x14092901, 0x208004a0},
+    {0x20220205, 0x08042088, 0x00200048, 0x04244009},
+    {0x04084040, 0x00010221, 0x20800402, 0x20010200},
+    {0x20800808, 0xa5204000, 0x84129090, 0x82281024},
+    {0x00928210, 0x000a084a, 0x00000100, 0x08808100},
+    {0x12004041, 0x88000401, 0x92490824, 0x20040442},
+    {0x00100908, 0x11502100, 0x00004000, 0x08209008},
+    {0x29420000, 0x40028049, 0x44220a52, 0x01244440},
+    {0x00089109, 0x04000800, 0x11002004, 0x48000002},
+    {0x12100420, 0x90908221, 0x00090080, 0x02012090},
+    {0x00020102, 0x00041008, 0x42485248, 0x28480201},
+    {0xa2409000, 0x09204080, 0x08000000, 0x00024820},
+    {0x08104451, 0x20020424, 0x00220115, 0x42200004},
+    {0x01040204, 0x04284002, 0x41084800, 0x08891110},
+    {0xa4412090, 0x10811120, 0x24820480, 0x02008042},
+    {0x10280800, 0x40080408, 0x00208025, 0x90201210},
+    {0x02004222, 0x0920a002, 0x12041200, 0x010a4009},
+    {0x40448008, 0x00020248, 0x00908020, 0x24000880},
+    {0x01001100, 0x92200800, 0x20040104, 0x40a42209},
+    {0x54100044, 0x00088092, 0x0420a402, 0x08008020},
+    {0x01029200, 0x12402500, 0x010000a0, 0x81241245},
+    {0x80500122, 0x80050010, 0x20250008, 0x04000000},
+    {0x12049008, 0x11002442, 0x08801402, 0x20424490},
+    {0x40000481, 0x40290008, 0x821080a0, 0x04080004},
+    {0x11528010, 0x09002890, 0x10042410, 0x00a21040},
+    {0x00001200, 0x40480201, 0x01000202, 0x94004200},
+    {0x12148094, 0x01024048, 0xa4222080, 0x0009082a},
+    {0x80000400, 0x28201402, 0x00408811, 0x22a00080},
+    {0x14a09021, 0x00020088, 0x11040100, 0x10011000},
+    {0x00040104, 0x49204010, 0x8010824a, 0x0414820a},
+    {0x82088400, 0x00040a82, 0x28801000, 0x20802040},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(6)
+  {  // level 6: redness 48
+    {0x08a01135, 0x92804020, 0x00030450, 0x04120912},
+    {0x20048000, 0x00220488, 0x48885084, 0x49014040},
+    {0x81004a82, 0x48085004, 0x02200201, 0x00440a0a},
+    {0x0a540014, 0x024102a1, 0x50024850, 0x44081001},
+    {0x10024240, 0x10949000, 0x01288204, 0x1120a150},
+    {0x41001049, 0x82000415, 0x44841080, 0x81050402},
+    {0x08244900, 0x20514080, 0x00010414, 0x10202028},
+    {0x81210004, 0x04000420, 0x52504021, 0x4a010480},
+    {0x04084430, 0x2144488a, 0x08041581, 0x00944005},
+    {0x30801081, 0x08020000, 0x01410008, 0x244024a8},
+    {0x02224104, 0x8428a121, 0xa4082820, 0x80010000},
+    {0x08490850, 0x21400408, 0x00210105, 0x09981522},
+    {0x21004102, 0x04021109, 0x88844448, 0x40028010},
+    {0x08240820, 0x2090c080, 0x42049021, 0x4a204884},
+    {0x2101410c, 0x44080821, 0x14200204, 0x00840200},
+    {0x04540821, 0x12420208, 0x40914040, 0x101020b1},
+    {0x20012200, 0x808090a1, 0x10040a0a, 0x42250404},
+    {0x09100154, 0x08142004, 0x02402080, 0x00805080},
+    {0x08444801, 0x21400651, 0x48290221, 0x4c080211},
+    {0x41020108, 0x44014008, 0x0080900c, 0x0081100a},
+    {0x2020a041, 0x092a1082, 0x22101480, 0x10144940},
+    {0x0a841492, 0x40404210, 0x48450021, 0x42820012},
+    {0x80120000, 0x10090492, 0x80104108, 0x10201220},
+    {0x48804292, 0x46001040, 0x09000421, 0x84084484},
+    {0x00150804, 0x00a90208, 0xa052a884, 0x20828010},
+    {0x94402140, 0x90045082, 0x05040020, 0x04280841},
+    {0x01040012, 0x02200820, 0x10008104, 0x40822108},
+    {0x92214641, 0x2089010c, 0x81480c29, 0x14108400},
+    {0x00081008, 0x14806220, 0x88012080, 0x210210a4},
+    {0x95440090, 0x80120880, 0x21240024, 0x80484200},
+    {0x00018a01, 0x22408415, 0x00404a00, 0x12040811},
+    {0x22101024, 0x90220000, 0x0a090144, 0x40211144},
+    {0x09424088, 0x050852a1, 0xa0401011, 0x15248400},
+    {0x20080400, 0x20410008, 0x00922200, 0x800010a4},
+    {0x022122a2, 0x04049221, 0xa4008155, 0x09120210},
+    {0x10448008, 0x40900004, 0x12441000, 0x40204802},
+    {0x42800884, 0x12024aa8, 0x00110421, 0x09451050},
+    {0x00104921, 0x00900001, 0xa1005104, 0x90000102},
+    {0x14230004, 0x8c111120, 0x04480010, 0x01142408},
+    {0x41002410, 0x2084440a, 0x90031542, 0x54408120},
+    {0x884804c0, 0x01200080, 0x12204008, 0x00922804},
+    {0x02094012, 0x54091030, 0x01080441, 0x90000141},
+    {0x24801204, 0x00004503, 0x24022204, 0x04514010},
+    {0x00240040, 0x82544848, 0x08a88090, 0x4902240a},
+    {0x2920aa12, 0x21020200, 0x41000822, 0x00400280},
+    {0x40080088, 0x08011049, 0x080a4502, 0x540a5011},
+    {0x0a430800, 0x49282102, 0x25209048, 0x81208084},
+    {0x20104144, 0x00048a20, 0x00040221, 0x00000a11},
+    {0x81001011, 0x25400004, 0x20909004, 0x15292040},
+    {0x10528500, 0x88011120, 0x84422490, 0x80440010},
+    {0x45002044, 0x0128420a, 0x12100112, 0x1001250a},
+    {0x00240110, 0x50020840, 0x20854801, 0x85280840},
+    {0x9208a802, 0x04208008, 0x04101250, 0x4080a021},
+    {0x00400228, 0x22825282, 0x40a00004, 0x080a050a},
+    {0x22952080, 0x80080020, 0x11054940, 0x80404000},
+    {0x08000802, 0x12210805, 0x08101012, 0x2512094a},
+    {0x41244130, 0x0000a120, 0x40400240, 0x0004a001},
+    {0x08410801, 0xa2480224, 0x0a049002, 0x48401130},
+    {0x800a0244, 0x08828800, 0x21244448, 0x02250402},
+    {0x25105010, 0x401000a9, 0x84000090, 0x91004088},
+    {0x10400480, 0x84a25200, 0x20491202, 0x08280a40},
+    {0x02152116, 0x10040021, 0x09004010, 0x41012015},
+    {0x24802000, 0x42209288, 0x20220949, 0x14448280},
+    {0x00290921, 0x01120002, 0x84082400, 0x01101004},
+    {0x49008248, 0x48004920, 0x01418022, 0x24008920},
+    {0x80442002, 0x40908404, 0x28082248, 0x10524409},
+    {0x14010490, 0x14041090, 0x04120802, 0x85080140},
+    {0x41282040, 0x80a10004, 0x82804108, 0x20812804},
+    {0x08050409, 0x22004941, 0x50111020, 0x08290220},
+    {0x42405122, 0x082a0004, 0x08420494, 0x22000492},
+    {0x12088000, 0x01002450, 0x81105101, 0x90212000},
+    {0x80420914, 0x64090000, 0x08080002, 0x02841148},
+    {0x02085041, 0x00509289, 0x52418aa8, 0x10108812},
+    {0x28900210, 0x11041002, 0x80882002, 0x40480140},
+    {0x42032042, 0x84004448, 0x04220408, 0x0a009008},
+    {0x00200888, 0x00950041, 0x4904a0a0, 0x21121242},
+    {0x10944201, 0x50902a08, 0x00a0120a, 0x40004448},
+    {0x4a001028, 0x04020081, 0x500a00a0, 0x08aa0001},
+    {0x00128282, 0x22808410, 0x0280a402, 0x44009520},
+    {0x50c01010, 0x48282044, 0x08540028, 0x8042000a},
+    {0x84084484, 0x01050500, 0xa2011501, 0x2a102480},
+    {0x00020011, 0x1020104a, 0x10484048, 0x01050028},
+    {0x52502520, 0xa504c400, 0x01022420, 0x48402401},
+    {0x01029004, 0x00400111, 0x2441010a, 0x01088092},
+    {0x48080441, 0x84150892, 0x00082840, 0x24211500},
+    {0x00902110, 0x28805000, 0x91204110, 0x00040008},
+    {0x2442844a, 0x00020329, 0x04820402, 0x89a12260},
+    {0x20101000, 0x95310804, 0x40089150, 0x20104405},
+    {0x02044152, 0x000020a0, 0x12100004, 0x02040100},
+    {0x50c00400, 0x90848501, 0x20829490, 0x204290a8},
+    {0x04151108, 0x0220000c, 0x84404044, 0x89100202},
+    {0x40002084, 0x20842840, 0x20240201, 0x10050808},
+    {0x09424421, 0x14124202, 0x12029450, 0x02404110},
+    {0x20100108, 0x81000050, 0x80900008, 0x50902842},
+    {0x0a021040, 0x00a10905, 0x24425282, 0x04048110},
+    {0x40884202, 0x240c5010, 0x00100821, 0x41420802},
+    {0x14110811, 0x08000244, 0xa1808088, 0x08102108},
+    {0x01401090, 0x41508801, 0x14092901, 0x208104a0},
+    {0x20228205, 0x08042088, 0x00240048, 0x05244009},
+    {0x04084040, 0x00010a21, 0x20804402, 0x20011240},
+    {0x24800888, 0xa5604000, 0x95129090, 0x82281024},
+    {0x00929210, 0x000a094a, 0x00000104, 0x08808100},
+    {0x52044043, 0x88008401, 0x92490824, 0x20040442},
+    {0x00100908, 0x11502110, 0x00084100, 0x49209008},
+    {0x29420040, 0x40029049, 0x44220a52, 0x01244550},
+    {0x0008d109, 0x04080800, 0x11402004, 0x48000002},
+    {0x52900420, 0x92908325, 0x00090080, 0x02112890},
+    {0x0002010a, 0x00051008, 0x42485648, 0x29480205},
+    {0xa2449000, 0x89204080, 0x19010000, 0x000248a0},
+    {0x08104451, 0x20020c24, 0x00222115, 0x42200005},
+    {0x01040204, 0x04284002, 0x41084820, 0x08891510},
+    {0xa4412090, 0x12811120, 0x24820480, 0x42008042},
+    {0x10280800, 0x40080488, 0x0020a025, 0x90601210},
+    {0x020042a2, 0x0920a002, 0x52041280, 0x010a4049},
+    {0x48448008, 0x40060249, 0x00908020, 0x24010880},
+    {0x01221501, 0x92a02800, 0x21040914, 0x40a42209},
+    {0x54100054, 0x00088092, 0x1420a402, 0x08008020},
+    {0x01029200, 0x12402504, 0x010800a0, 0x81241245},
+    {0x80500122, 0x80250010, 0x20252108, 0x24108000},
+    {0x12049008, 0x15002442, 0x08801402, 0x21425490},
+    {0x40000481, 0x40290108, 0x821080a2, 0x04080205},
+    {0x15528050, 0x09002891, 0x10452410, 0x20a21050},
+    {0x00001202, 0x40490201, 0x01000202, 0x94004200},
+    {0x1294a094, 0x01024048, 0xa42a20c8, 0x0009082a},
+    {0x80000400, 0x2a201402, 0x04408811, 0x22a02280},
+    {0x14a290a1, 0x000a0088, 0x11040100, 0x10011020},
+    {0x20040104, 0x49205010, 0x8010a24a, 0x8494820a},
+    {0x8208a400, 0x00050a82, 0x2a901000, 0x20802040},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(7)
+  {  // level 7: redness 56
+    {0x08a01135, 0x92904021, 0x80430450, 0x04120912},
+    {0x24068040, 0x02220488, 0x48885084, 0x49214040},
+    {0xa1004a82, 0x48085004, 0x02200209, 0x10448a4a},
+    {0x0a541014, 0x024102b1, 0x50024850, 0x44081001},
+    {0x10224240, 0x90949000, 0x09288204, 0x1120a150},
+    {0x41011049, 0x8a000515, 0x448430c0, 0x81050402},
+    {0x0a244900, 0x20555080, 0x00010414, 0x10a82129},
+    {0xa1210106, 0x04000420, 0x52584021, 0x4a011480},
+    {0x040a4430, 0x2154498a, 0x08049589, 0x00944005},
+    {0x30801081, 0x28020008, 0x01410008, 0x244224a8},
+    {0x82224104, 0x8428a921, 0xb4082920, 0x90010000},
+    {0x08490c50, 0x21400448, 0x01210105, 0x09981522},
+    {0x21004102, 0x04061109, 0x88944448, 0x40028010},
+    {0x48242820, 0x2090c080, 0x42049121, 0x4a204884},
+    {0x2101418d, 0x44080c25, 0x14200204, 0x00840a02},
+    {0x04540821, 0x12422208, 0x40915040, 0x1410a0b1},
+    {0x21012200, 0xa09090a1, 0x12040a2a, 0x42250404},
+    {0x49108154, 0x08152004, 0x02402080, 0x20805080},
+    {0x08444801, 0x21400651, 0x582b0221, 0x4c2a0251},
+    {0x45120528, 0x44014008, 0x0080900c, 0x0081100a},
+    {0x2020a041, 0x092a1882, 0x22101580, 0x14144940},
+    {0x0a841492, 0x40404210, 0x48450025, 0x42828012},
+    {0xa0124000, 0x10890492, 0x82125108, 0x10201220},
+    {0x4a804292, 0x46005040, 0x09000421, 0x85084484},
+    {0x00150814, 0x00a90218, 0xa052a884, 0x20828010},
+    {0x94402940, 0x98045282, 0x05040220, 0x14282a41},
+    {0x01148012, 0x02210820, 0x3020a104, 0x4082210c},
+    {0xd2214641, 0xa089010c, 0x814a0c29, 0x14108420},
+    {0x00081008, 0x14806220, 0x88012080, 0x214210a4},
+    {0x95442094, 0x801a0880, 0x25240024, 0x8448c200},
+    {0x00218a01, 0x22408495, 0x40404a10, 0x12040815},
+    {0x22101124, 0x90221000, 0x0a098144, 0x40211144},
+    {0x09424088, 0x050852a5, 0xa0401011, 0x15248400},
+    {0x20080402, 0x20410008, 0x029a2a00, 0x808050a4},
+    {0x822132a2, 0x142492a1, 0xa4008155, 0x29120210},
+    {0x18448008, 0x40900004, 0x12445000, 0x40204902},
+    {0x42840884, 0x12024aa8, 0x005104a9, 0x0b451050},
+    {0x00104921, 0x40904001, 0xa5045104, 0x90008102},
+    {0x14a30104, 0x8c111124, 0x04480010, 0x01142448},
+    {0x41002412, 0x2084440a, 0x90031542, 0x54408120},
+    {0x884a24c0, 0x01210280, 0x12604008, 0x0096280c},
+    {0x22094012, 0x54091030, 0x01080451, 0x92000541},
+    {0x24801284, 0x00404503, 0xa4033204, 0x04514010},
+    {0x00250040, 0x8a544848, 0x08a88090, 0x490a244a},
+    {0x2920aa13, 0x21020200, 0x41000822, 0x00400280},
+    {0x40080088, 0x08211049, 0x084a4502, 0x548a5811},
+    {0x0ac32820, 0x49282112, 0x25209048, 0x81208084},
+    {0x20104544, 0x00048a20, 0x00040221, 0x20040a11},
+    {0x85041011, 0x25404004, 0x28909084, 0x15296142},
+    {0x10528508, 0x88091161, 0x84422490, 0x82440010},
+    {0x45002044, 0x0128420a, 0x12100112, 0x1001250a},
+    {0x00a50510, 0x50821840, 0x20854801, 0x85280840},
+    {0x9a08a842, 0x04208008, 0x0c109250, 0x4080a021},
+    {0x40400228, 0x228a5292, 0x40a00005, 0x180a050a},
+    {0x22952080, 0x80080220, 0x51054940, 0x81404820},
+    {0x08000a06, 0x1aa10805, 0x0a101012, 0x2512094a},
+    {0x41244130, 0x0004a120, 0x40410248, 0x0004a001},
+    {0x2a412801, 0xa2480224, 0x0a249102, 0x68501130},
+    {0x800a0244, 0x08829800, 0x21244448, 0x02250402},
+    {0x25105012, 0x421000a9, 0x84001090, 0x91006088},
+    {0x10410480, 0x84a25204, 0x20491202, 0x082a0a40},
+    {0x02152556, 0x10040421, 0x09084090, 0x41012015},
+    {0xa4802000, 0x42209288, 0x21220949, 0x14448280},
+    {0x10290921, 0x09120022, 0x84082404, 0x81141024},
+    {0x49008248, 0x48444920, 0x21418022, 0x24008922},
+    {0x81542802, 0x40908404, 0x28082248, 0x10524409},
+    {0x14010494, 0x16043091, 0x04520882, 0x85080140},
+    {0x41282040, 0x80a90204, 0x82804508, 0x2081280c},
+    {0x08050409, 0x22004951, 0x50111021, 0x08290220},
+    {0x424051a2, 0x082a4004, 0x0a420494, 0x22844492},
+    {0x12288400, 0x01802652, 0x81125101, 0x90212002},
+    {0x90420914, 0x6c090000, 0x08080022, 0x02841148},
+    {0x02095041, 0x005092a9, 0x52418aa8, 0x54108c12},
+    {0x28900214, 0x11441002, 0x80882002, 0x404a0140},
+    {0x42432442, 0xa4004548, 0x24220508, 0x0a009008},
+    {0x04200888, 0x04950041, 0x4904a0a0, 0x21521242},
+    {0x10954201, 0x5090aa08, 0x00a0120a, 0x40004448},
+    {0x4a001028, 0x040200a5, 0x540a08a1, 0x0aaa0009},
+    {0x00128a82, 0x2290a410, 0x0280a402, 0x440095a0},
+    {0x52c01010, 0x48282044, 0x885400a8, 0x8042000a},
+    {0x84094484, 0x01050500, 0xa2011501, 0x2a106480},
+    {0x00220011, 0x1020106a, 0x1048404a, 0x01250128},
+    {0x5a5025a2, 0xa514c400, 0x01022420, 0x48402401},
+    {0x01029004, 0x00400111, 0x6451010a, 0x01088092},
+    {0x48090441, 0x84150892, 0x04082840, 0x34211520},
+    {0x00902110, 0x29805000, 0x91224114, 0x0004000a},
+    {0x2642844a, 0x00024329, 0x04820402, 0x89a12260},
+    {0x20101000, 0x95310805, 0x4048b150, 0x20104c05},
+    {0x02054952, 0x400820a0, 0x12100004, 0x0a040100},
+    {0x50c00401, 0x94849501, 0x20829490, 0x204290a8},
+    {0x04151128, 0x0221002c, 0x84484044, 0x89302202},
+    {0x42002084, 0x20842940, 0x22240201, 0x10050848},
+    {0x894a4421, 0x14324202, 0x12029552, 0x02424111},
+    {0x20108909, 0x81002050, 0x80900008, 0x50902842},
+    {0x0a421048, 0x20a10905, 0x24425282, 0x04048510},
+    {0x40884202, 0x240c5010, 0x04140821, 0x51420842},
+    {0x14110891, 0x084002c4, 0xa1808088, 0x08186108},
+    {0x01441090, 0x41528801, 0x14092911, 0x208104a2},
+    {0x62228a05, 0x2a042088, 0x02240048, 0x05244009},
+    {0x04084040, 0x00090a29, 0x20804602, 0x30011240},
+    {0x2480088a, 0xa5604000, 0x95329090, 0x82281224},
+    {0x00929210, 0x000a294a, 0x00000104, 0x08a2a108},
+    {0x52444043, 0xca008401, 0x92492824, 0x20040442},
+    {0x04100d08, 0x11542110, 0x01084100, 0x49209008},
+    {0x29420044, 0x40029249, 0x54220a52, 0x01244551},
+    {0x0008d109, 0x04480800, 0x1140a004, 0x48020002},
+    {0x52900420, 0xb2908325, 0x000900a0, 0x02112890},
+    {0x0802110a, 0x00051008, 0x4248564a, 0xa9480205},
+    {0xa2649080, 0x89204080, 0x19010000, 0x000248a0},
+    {0x08104451, 0x20820d34, 0x00222115, 0x52204005},
+    {0x81040204, 0x04284002, 0x41084920, 0x08891510},
+    {0xa4412090, 0x92831120, 0x2c920480, 0x42048042},
+    {0x112a0804, 0x40080488, 0x0020a02d, 0x90601210},
+    {0x020052a2, 0x0920a802, 0x52041280, 0x090a424b},
+    {0x48448008, 0x44060269, 0x04908020, 0x24010880},
+    {0x01221501, 0x92a02800, 0x21050914, 0x42a42209},
+    {0x54104054, 0x000a8092, 0x1420a402, 0x080088a0},
+    {0x01029200, 0x52402504, 0x010800a0, 0x81241245},
+    {0x88500122, 0x80250050, 0x64252118, 0x24108008},
+    {0x12449408, 0x15006442, 0x08801402, 0x21425490},
+    {0x40082485, 0x40290108, 0x821080a2, 0x04080205},
+    {0x15528050, 0x09002891, 0x30452410, 0x20a29050},
+    {0x00001202, 0x50490201, 0x01000202, 0x95004280},
+    {0x5294a094, 0x01024048, 0xa42a20c9, 0x000d082a},
+    {0x80000400, 0x2a209522, 0x04408c11, 0xa2a02284},
+    {0x14a294a9, 0x008a0088, 0x91040100, 0x10011020},
+    {0x20040104, 0x49205010, 0x8012a24a, 0x8494820a},
+    {0x8248a400, 0x20050a82, 0x2a901002, 0x20802440},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(8)
+  {  // level 8: redness 64
+    {0x08a01535, 0x92904021, 0x80434650, 0x0412091a},
+    {0x24168040, 0x02231588, 0x4c885084, 0x49214040},
+    {0xa1004a8a, 0x68885004, 0x02240209, 0x91448a4a},
+    {0x0a541014, 0x024102b1, 0x50824850, 0x44081001},
+    {0x10224640, 0x90949000, 0x09288206, 0x1120a558},
+    {0x41091049, 0x8a000555, 0x448430c0, 0x85050402},
+    {0x0a244910, 0x20555084, 0x10010614, 0x10a82129},
+    {0xa1210106, 0x05000420, 0x53584021, 0x4a011480},
+    {0x048a5430, 0x2154c98a, 0x08049589, 0x40944025},
+    {0x30901081, 0x28020008, 0x81610028, 0x244226a8},
+    {0x82224104, 0x8528a921, 0xb40a2920, 0x92210000},
+    {0x08490c58, 0x21408448, 0x01210105, 0x09985526},
+    {0x23084102, 0x0c061109, 0x88945448, 0x40028090},
+    {0x48642820, 0x20d0c0a0, 0x42049121, 0x4a244884},
+    {0x2101458d, 0x44080c25, 0x14a0020d, 0x20840a02},
+    {0x0c540821, 0x12422208, 0x40935040, 0x1490a0b1},
+    {0x21052200, 0xa09091a1, 0x12040a2a, 0x42250604},
+    {0x49109156, 0x0a152004, 0x82402080, 0x20805088},
+    {0x08444801, 0x21401651, 0x582b4621, 0x4c2a4251},
+    {0x45120528, 0x44094088, 0x0280902d, 0x0181140a},
+    {0x2020a041, 0x092a1883, 0x22101580, 0x54144940},
+    {0x0a851496, 0x44404210, 0x48c54025, 0x42828012},
+    {0xa0124400, 0x108b0492, 0x92125108, 0x103012a4},
+    {0x4ac04292, 0x46205042, 0x090004a1, 0x850a5484},
+    {0x00150814, 0x20a90218, 0xa052a88c, 0x20828010},
+    {0xb4402940, 0x99045282, 0x05040220, 0x94282a41},
+    {0x01148012, 0x02210860, 0x3420a104, 0x4182210c},
+    {0xd2a14641, 0xa089090c, 0x814a0c29, 0x14188420},
+    {0x00081008, 0x14806222, 0x88012080, 0x214218a4},
+    {0x954420d4, 0x841a0880, 0x25241126, 0x8448c200},
+    {0x08218a01, 0x22c0c4b5, 0x40484a10, 0x12840895},
+    {0x62141124, 0x90221000, 0x0a098144, 0x40211144},
+    {0x09424888, 0x050c52a5, 0xa8401051, 0x15248410},
+    {0x20088412, 0x20410008, 0x029a2a04, 0x808050a5},
+    {0x833132a2, 0x15249aa1, 0xa4008155, 0x29160210},
+    {0x18448008, 0x40900004, 0x12445000, 0x40204906},
+    {0x428408a4, 0x12064aa8, 0x405104a9, 0x0b451050},
+    {0x48106921, 0x40d04401, 0xa5045504, 0xb0108502},
+    {0x14ab0104, 0x8c111124, 0x04480030, 0x01142448},
+    {0x41002412, 0x2084444a, 0x91035542, 0x54408121},
+    {0x884a24c0, 0x03211280, 0x12684009, 0x0096a80c},
+    {0x22294012, 0x540d1034, 0x21080551, 0xd2000541},
+    {0x24801a94, 0x20404503, 0xa4033204, 0x04515010},
+    {0x00250040, 0x8a544848, 0x08a88090, 0x490a244a},
+    {0x2b24aa13, 0x21020241, 0x41002822, 0x00400282},
+    {0x40080188, 0x48219449, 0x084a450a, 0x548a5831},
+    {0x0ac32820, 0x4b282112, 0x65209048, 0x85208084},
+    {0x20104546, 0x00048a20, 0x00040621, 0x20040a11},
+    {0x85041011, 0x6562480c, 0x29929084, 0x15296142},
+    {0x30528548, 0x88091161, 0x84422490, 0x82440850},
+    {0x45003044, 0x0128420a, 0x92100112, 0x3001250a},
+    {0x00a50510, 0x58821940, 0x20c54841, 0x852a0848},
+    {0x9a08a842, 0x0420800a, 0x0c109258, 0x4080a121},
+    {0x40400229, 0x228a5292, 0x40a40205, 0x182a050a},
+    {0x22952880, 0x80080220, 0x51054940, 0x8140c820},
+    {0x08008a06, 0x5aa12885, 0x0a103012, 0x2512094a},
+    {0x41344130, 0x0004a120, 0x40490248, 0x0004a001},
+    {0x2a412889, 0xa2580226, 0x2a249102, 0x69501330},
+    {0x800a0244, 0x08829900, 0x21244448, 0x02250402},
+    {0x25505012, 0x521080a9, 0x84801092, 0x910060aa},
+    {0x10410480, 0x84a25204, 0x24499202, 0x486a0a40},
+    {0x02152556, 0x108c0421, 0x49084090, 0x41012015},
+    {0xa4802000, 0x4220d288, 0x21220949, 0x14448a80},
+    {0x10290929, 0x09120022, 0x84282404, 0x81141024},
+    {0x49028248, 0x48444928, 0x21418922, 0x24808922},
+    {0x81542802, 0x40908484, 0x28082248, 0x10524409},
+    {0x14014594, 0x16053091, 0x84520892, 0xc5082140},
+    {0x41282040, 0x80a90204, 0x82844508, 0x2081288c},
+    {0x18850409, 0x22004951, 0x50115021, 0x0c290220},
+    {0x424051aa, 0x282a4004, 0x0a420494, 0x22844c92},
+    {0x12288400, 0x01803652, 0xa1125101, 0x90212002},
+    {0x90420914, 0x6c090000, 0x08480022, 0x02841148},
+    {0x020950c1, 0x005292a9, 0x52419aa8, 0x54108c12},
+    {0x28900214, 0x11441002, 0x80882003, 0x40ca4140},
+    {0x424b2442, 0xa4004558, 0x24220528, 0x0a00901a},
+    {0x44202888, 0x04951041, 0x4904a0a0, 0x21561342},
+    {0x10954223, 0x5090aa08, 0x00b0120a, 0x40004448},
+    {0x4a801028, 0x040200a5, 0x540a88a1, 0x1aaa2009},
+    {0x001a8a82, 0x2290a510, 0x0280a40a, 0x440095a0},
+    {0x52c01050, 0x48292045, 0x885400a8, 0x80ca000a},
+    {0x84094484, 0x45050500, 0xa2011501, 0x2a1064a0},
+    {0x01221011, 0x10a0106a, 0x1458404a, 0x2125092c},
+    {0x5a5025a2, 0xa514c500, 0x01022420, 0x48402401},
+    {0x01029004, 0x00401115, 0x6451850a, 0x010c8092},
+    {0x68490449, 0xa4150892, 0x04082840, 0x35213520},
+    {0x00903110, 0x29a05040, 0xb1224154, 0x0004000a},
+    {0x2642854a, 0x00064329, 0x04820402, 0xc9a52260},
+    {0x20101000, 0x95310805, 0x4848b150, 0x20104c05},
+    {0x0a15495a, 0x408820a8, 0x12120206, 0x0a848110},
+    {0x50c04401, 0x94849501, 0x20829490, 0x204290a9},
+    {0x04151128, 0x0221002c, 0x84484054, 0x89302602},
+    {0x52402484, 0x60842940, 0x22242201, 0x52050848},
+    {0x894a4421, 0x1432420a, 0x12829552, 0x02424111},
+    {0x20108909, 0x81012050, 0x90900008, 0x50902842},
+    {0x0a4210c8, 0x24a10d05, 0x2442d292, 0x04248518},
+    {0x40884202, 0x240c5010, 0x04140821, 0x51420842},
+    {0x14114891, 0x084002c5, 0xa1a08488, 0x0a186108},
+    {0x09441090, 0x4152c811, 0x14092913, 0xa0810ca2},
+    {0x62228a05, 0x2a042088, 0x02242048, 0x05244009},
+    {0x04084260, 0x00090b29, 0xa0804602, 0x30811240},
+    {0xa492088a, 0xb5604000, 0x95369090, 0x82281224},
+    {0x00929210, 0x000a294a, 0x00000124, 0x08a2a108},
+    {0x52444043, 0xca408421, 0xb2492c24, 0x220404c2},
+    {0x04108d28, 0x11542110, 0x01084100, 0x49289008},
+    {0x29420044, 0x4402924b, 0x54220a53, 0x01244551},
+    {0x0028d109, 0x04480800, 0x1144a004, 0x58020002},
+    {0x52920460, 0xb290a365, 0x440908a0, 0x02516a90},
+    {0x0802110a, 0x00051008, 0x4248564a, 0xa9480205},
+    {0xa2649080, 0x8d284080, 0x19210000, 0x000248b0},
+    {0x09104451, 0x20820d34, 0x00222115, 0x53304005},
+    {0x91048a06, 0x04284002, 0xc1084924, 0x08891590},
+    {0xa44120d0, 0x92835124, 0x2c920480, 0x42048042},
+    {0x112a0804, 0x50280488, 0x0022a02d, 0x90603210},
+    {0x021052a2, 0x0920a802, 0x52441680, 0x090a424b},
+    {0x68448028, 0x44060369, 0x0490a022, 0xa4010880},
+    {0x01221501, 0x92a0a800, 0x21050954, 0x42b42219},
+    {0x54904054, 0x000a8092, 0x9460a402, 0x0800c8a0},
+    {0x01069204, 0x5a502504, 0x010804a0, 0x91a61245},
+    {0xc8500162, 0x80250850, 0x6425a118, 0x24108008},
+    {0x12449408, 0x15806442, 0x08801402, 0xa14254d0},
+    {0x40082485, 0xc02b0108, 0x821881a2, 0x0c080205},
+    {0x15528050, 0x09002895, 0x32453418, 0x20a29052},
+    {0x00001602, 0x54590a01, 0x01000202, 0x95204a80},
+    {0x5295a0d4, 0x01024048, 0xa42a60c9, 0x000d082a},
+    {0x80100400, 0x2a209522, 0x14408c11, 0xa2a02284},
+    {0x16a294a9, 0x008a0489, 0x91440100, 0x14011020},
+    {0x20040124, 0x4d205010, 0x8012a26a, 0x849c828a},
+    {0xa248a400, 0x20050a8a, 0x2a901002, 0x30806440},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(9)
+  {  // level 9: redness 72
+    {0x09a01535, 0x92904021, 0x80434650, 0x0416091a},
+    {0x24168040, 0x022315a8, 0x6c985085, 0x49215040},
+    {0xa1004a8a, 0x68885004, 0x02250249, 0x91448b4a},
+    {0x0a549094, 0x064906b3, 0x50825a50, 0x442a1001},
+    {0x10a24640, 0x9094b000, 0x89288206, 0x1120a558},
+    {0x6109104b, 0x8a400555, 0x44a530d0, 0xa5050442},
+    {0x0a244910, 0x20575084, 0x10010614, 0x10a82129},
+    {0xa1210146, 0x15000420, 0x53584021, 0x4a219484},
+    {0x048a5430, 0x2154d9ab, 0x08049589, 0x40944025},
+    {0x34909289, 0x28020008, 0x8161202a, 0x244226a8},
+    {0x82224104, 0x8528a921, 0xb60a2d20, 0x92211000},
+    {0x28490c59, 0x21508448, 0x01210105, 0x09985526},
+    {0x23094142, 0x4c06150b, 0x98945468, 0x48028090},
+    {0x48642820, 0x20d0c0a0, 0x42049121, 0x4a644894},
+    {0x2101458d, 0x460a0c25, 0x14a0060d, 0x20850a02},
+    {0x8c540821, 0x12422208, 0x409350c0, 0x1490b0b1},
+    {0x21052248, 0xa09091a9, 0x1a148a2a, 0x42250604},
+    {0x49509156, 0x0a152004, 0x82c02084, 0x20805088},
+    {0x08444801, 0x21401651, 0x582b4621, 0x4c2a4251},
+    {0x45120528, 0x44494088, 0x0288902d, 0x01a1148a},
+    {0x3020a141, 0x292a58a3, 0xa2101580, 0x54144940},
+    {0x0a951496, 0x44404210, 0x48c54025, 0x42828012},
+    {0xa0124400, 0x108b0492, 0x92125508, 0x103012a4},
+    {0x4ac052d2, 0x46205842, 0x091004a1, 0x8d4a5484},
+    {0x02170814, 0x20a90218, 0xa0d3a88d, 0x20828012},
+    {0xb4402940, 0x99045282, 0x05041220, 0x94282a61},
+    {0x01148016, 0x02214860, 0x3420a144, 0x4182a10c},
+    {0xdaa15741, 0xa0a9090c, 0x815a0c29, 0x14188520},
+    {0x000a1009, 0x14826222, 0x8801a080, 0x214218a6},
+    {0x954420d4, 0x841a0880, 0x35241126, 0x9448c200},
+    {0x08218a01, 0x22c0c4b5, 0x40c84a10, 0x12840895},
+    {0x62941124, 0x98221200, 0x0a098544, 0x40293144},
+    {0x094248c8, 0x050c52a5, 0xa8401051, 0x95248410},
+    {0x28088412, 0x60410008, 0x029b2a04, 0x808054a5},
+    {0x833132a2, 0x15249ab1, 0xa4808555, 0x2d168210},
+    {0x18448209, 0x40904004, 0x12545000, 0x40204946},
+    {0x428508a4, 0x16064aaa, 0x485104a9, 0x0b453050},
+    {0x48106921, 0x40d04441, 0xa5055506, 0xb010850a},
+    {0x14ab0114, 0x8c131124, 0x04480030, 0x01142448},
+    {0x41002412, 0x3084444a, 0x91035542, 0x56408921},
+    {0x8a4a26c2, 0x03211280, 0x12684809, 0x0096a80c},
+    {0x22294012, 0x544d1034, 0x21080551, 0xd2400561},
+    {0x64801a94, 0x20404583, 0xa4433204, 0x04515110},
+    {0x00254040, 0x8a544848, 0x08a88092, 0x690a244a},
+    {0x2b24aa13, 0x21022249, 0x650228a2, 0x00410282},
+    {0x40080188, 0x48a99449, 0x084a450a, 0x549a5831},
+    {0x1ac32820, 0x4b282112, 0x65209048, 0x85208284},
+    {0xa0104546, 0x00048aa0, 0x00140621, 0x20840a19},
+    {0x85249011, 0x6562480c, 0x29929084, 0x15296142},
+    {0x30528548, 0x88091161, 0x84426494, 0x82440850},
+    {0x45003046, 0x0328420a, 0x92180512, 0x3021250a},
+    {0x00a50510, 0x58831960, 0x20c54841, 0x852a4848},
+    {0x9a28a942, 0x0420840a, 0x8e109258, 0x4280a121},
+    {0x40420229, 0x32aa5292, 0x40a40205, 0x182a150a},
+    {0x269528a0, 0x80090220, 0x51054950, 0x8148c820},
+    {0x88008a06, 0x5aa1288d, 0x0a903012, 0xad12094a},
+    {0x41b44130, 0x0204a920, 0x40490649, 0x0044a085},
+    {0x2a412889, 0xa2580226, 0x2a249122, 0x69501330},
+    {0x800a8644, 0x08829910, 0x21244448, 0x02258402},
+    {0x2d505032, 0x521080a9, 0x84821092, 0x910068aa},
+    {0x50450480, 0x84a25204, 0x24699602, 0x4c6a0a40},
+    {0x02152556, 0x108c04a5, 0x490840b0, 0x41012015},
+    {0xa5a02000, 0x6220d288, 0x21224949, 0x14548a88},
+    {0x10292929, 0x09120822, 0x8c2a2404, 0x911450a4},
+    {0x49028248, 0x4a444928, 0x21418922, 0x24808922},
+    {0xa1542802, 0x40908484, 0x29082249, 0x10524409},
+    {0x140145b4, 0x16053091, 0x84528892, 0xc50a2150},
+    {0x41282040, 0x88a90a24, 0x92844508, 0x20a1288c},
+    {0x18950c09, 0x22004951, 0x50315061, 0x0c290220},
+    {0x424251aa, 0x286b4004, 0x0a420494, 0xa2844c92},
+    {0x12288420, 0x018036d2, 0xa1125509, 0x90312122},
+    {0xd1422914, 0x6c090004, 0x08480022, 0x0a851148},
+    {0x020950c1, 0x025292a9, 0x52459aa8, 0x54108c12},
+    {0x28900214, 0x11449402, 0x82882003, 0x40ca4140},
+    {0x4a4b2442, 0xa4104558, 0x24228d28, 0x8a00901a},
+    {0x44202888, 0x04951043, 0x4904a0a0, 0x29561342},
+    {0x10954323, 0xd090aa08, 0x02b0120a, 0x4000c448},
+    {0x4a801028, 0x0c4600a5, 0x540a88a1, 0x1aaa200b},
+    {0x001aca82, 0x2290a510, 0x2280a60a, 0x44009da0},
+    {0x52c01054, 0x48292845, 0x885400a8, 0x80ca000a},
+    {0x94094684, 0x45050508, 0xa2835501, 0x2a1164a0},
+    {0x01261011, 0x10a0306a, 0x1458404a, 0x2125092c},
+    {0x5a50a5a2, 0xa516c500, 0x810224a8, 0x4c402481},
+    {0x01029024, 0x04401115, 0x64d1850a, 0x812c8092},
+    {0x6c490449, 0xa4150c92, 0x04082840, 0x35213524},
+    {0x00943110, 0x29a05040, 0xb1224955, 0x0004800a},
+    {0xa642854a, 0x00064329, 0x04920402, 0xcda522e0},
+    {0x20901000, 0x95310c05, 0xc848b150, 0x20104c05},
+    {0x0a15495a, 0x408820a8, 0x13120206, 0x8a948110},
+    {0x50c04481, 0x9484d501, 0x20929490, 0x204290a9},
+    {0x04151128, 0x0231002d, 0x8c484854, 0x89302602},
+    {0x52412484, 0x64842d40, 0x22252201, 0x520548cc},
+    {0x894a4431, 0x1432420a, 0x12829552, 0x024a4111},
+    {0x20108909, 0x81092050, 0x90980008, 0x54902842},
+    {0x4b4610c8, 0x24a10d45, 0x2442d292, 0x04258518},
+    {0x40884602, 0x650c5010, 0x84140921, 0x51420842},
+    {0x14114895, 0x084102c5, 0xa1a08488, 0x0a186108},
+    {0x09441090, 0x4152cc11, 0x14092913, 0xa0810ca2},
+    {0x62228a05, 0x2a142088, 0x02652048, 0x052c4109},
+    {0x04886260, 0x00890b29, 0xa8804642, 0x30811250},
+    {0xa492088a, 0xb5604040, 0x95369891, 0x86289224},
+    {0x10929210, 0x000b294e, 0x00000124, 0x48a2a90a},
+    {0x52444143, 0xca408c21, 0xb2c9ac24, 0x220404c2},
+    {0x04148d28, 0x11542110, 0x01084100, 0x49299008},
+    {0x69421045, 0x4402924b, 0x54220a5b, 0x01245551},
+    {0x0228d109, 0x044a0800, 0x1164a104, 0x5a02000a},
+    {0x52920460, 0xb290a375, 0x440908a0, 0x02556ad0},
+    {0x0802550a, 0x00451408, 0x4248564a, 0xa9480205},
+    {0xa2649088, 0xad284081, 0x19250040, 0x000248b0},
+    {0x09104451, 0x20822d34, 0x2422a915, 0x53324805},
+    {0x91148a06, 0x04284002, 0xc1884924, 0x08891590},
+    {0xa44120d0, 0x92835564, 0x2c920480, 0x6204804a},
+    {0x112a0a04, 0x50280488, 0x0022a02d, 0x90683210},
+    {0x8210d2a2, 0x09a0a802, 0x52441680, 0x098a424b},
+    {0x6c448028, 0x440e0369, 0x1490a022, 0xa4010880},
+    {0x01221581, 0xb2a0a800, 0x21050954, 0x42b42219},
+    {0x54904854, 0x000a84b3, 0x9464a402, 0x0800c8a0},
+    {0x01069204, 0x5b502504, 0x010814a2, 0x91a61245},
+    {0xc8502162, 0x80250854, 0x6525a118, 0x2410820a},
+    {0x13459408, 0x15806442, 0x08801402, 0xa14254d0},
+    {0x40082595, 0xc02b0308, 0x825881a2, 0x0c0c2205},
+    {0x55528050, 0x090068b5, 0x32453418, 0x20a29052},
+    {0x08001602, 0x54590a01, 0x81010242, 0xd5204a80},
+    {0x52d5a0d4, 0x01424048, 0xa4aa60c9, 0x080d082a},
+    {0x80100400, 0x2a249522, 0x14488c11, 0xa2a0a284},
+    {0x16a2b4a9, 0x808a4489, 0x91441104, 0x14011830},
+    {0x20040124, 0x4d305050, 0x8212a36a, 0x84dc828a},
+    {0xa249a401, 0x20050a8a, 0x2a901002, 0x30806440},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(10)
+  {  // level 10: redness 80
+    {0x09a01535, 0x9a946023, 0x80434658, 0x0616091a},
+    {0x2416a040, 0x022315a8, 0x6c985085, 0x69215040},
+    {0xa1404a8a, 0x68885004, 0x02250249, 0x91448b5a},
+    {0x4a549094, 0x064906b3, 0x50825a50, 0x442a1001},
+    {0x14a24650, 0xb094b000, 0x8d288206, 0x1120a558},
+    {0x6109104b, 0x8a40055d, 0x44a530d0, 0xa5051442},
+    {0x0a646d10, 0xa0575284, 0x10010614, 0x10ac2129},
+    {0xb1210146, 0x15000420, 0x535a50a1, 0x4a219684},
+    {0x048a5431, 0x2574d9ab, 0x28049589, 0x42944025},
+    {0x34949289, 0x28020208, 0x8161202a, 0x244226a8},
+    {0x82224104, 0x852aa965, 0xb60a2d20, 0x92259044},
+    {0x28491c59, 0x21508448, 0x01210107, 0x29985526},
+    {0x23094142, 0x4c06150b, 0x98d4d468, 0x48028290},
+    {0x48642828, 0x20d0e0a0, 0x42049121, 0x4b644894},
+    {0x2311458d, 0x460a0ca5, 0x94a8060d, 0x20850a02},
+    {0x8c544821, 0x1262a208, 0x409350c0, 0x1490b0b1},
+    {0x21052248, 0xa09091a9, 0x1a148a2a, 0xca2d0644},
+    {0x49509556, 0x9a172404, 0x82c03084, 0x2180508a},
+    {0x48454801, 0x21401651, 0x582b46a1, 0x4c2a4251},
+    {0x451a2528, 0x44494088, 0x0288902d, 0x11a1148a},
+    {0x30a0a149, 0x292a5aa7, 0xaa121580, 0x54144948},
+    {0x0a951496, 0x45404210, 0x48c54035, 0x4282a412},
+    {0xa0124400, 0x108b2492, 0x92125508, 0x103112a4},
+    {0x5ac052d2, 0x462058c2, 0x091004a1, 0xcd4a5484},
+    {0x02170814, 0x20ad0218, 0xe4d3a88d, 0x20828112},
+    {0xb4606b40, 0x9904528b, 0x05041220, 0x94282a61},
+    {0x01148016, 0x06214860, 0x3420a144, 0x45a2a10c},
+    {0xdaa15761, 0xa0a9090c, 0x815a0c29, 0x14188520},
+    {0x000a1009, 0x14826322, 0x8901a288, 0x214218a6},
+    {0xd55424d4, 0xc41a0888, 0x35241126, 0x9458c210},
+    {0x0821ca01, 0x22c0c4b5, 0x40ca4a10, 0x12850a95},
+    {0x62941126, 0x98221200, 0x8a29a546, 0x44293144},
+    {0x094248c8, 0x051cd2a7, 0xa8401051, 0x95248410},
+    {0x280c8412, 0x61410008, 0x129b2a04, 0xa0a054a5},
+    {0xc33132a2, 0x15249bb1, 0xa4808555, 0x2d168210},
+    {0x1844a209, 0x40924004, 0x12545040, 0x40204946},
+    {0x428508a4, 0x36064aaa, 0x485124a9, 0x0b453251},
+    {0x48506921, 0x40d05441, 0xa5055506, 0xb450850a},
+    {0x14ab0914, 0x8d131124, 0x04680130, 0x01162448},
+    {0x5100a452, 0x3094445b, 0xd1035542, 0x564089a1},
+    {0x8a4a26c2, 0x03215280, 0x1268480d, 0x1096a80c},
+    {0x22294012, 0x544d1434, 0x25088571, 0xd2400561},
+    {0x64881a94, 0x22404583, 0xa4433204, 0x04595114},
+    {0x08a54041, 0x8a554848, 0x08a88492, 0x6b0a244a},
+    {0x2b24aa33, 0x21022249, 0x651228a2, 0x00410282},
+    {0x4008098c, 0x48a99449, 0x084a450a, 0x549a5831},
+    {0x1acb2820, 0x4b282112, 0x65a19148, 0x9520a2c4},
+    {0xa0104546, 0x10048aa0, 0x80142623, 0x20850a19},
+    {0x87249211, 0x6562480c, 0x399290a4, 0x55296142},
+    {0x30528548, 0x88091161, 0x84426494, 0x82440850},
+    {0x45083046, 0x0328620a, 0x92180512, 0x3029270a},
+    {0x20a50510, 0xd88b1961, 0x20c54841, 0x8d2a4848},
+    {0x9b28a94a, 0x0420840a, 0x8e10b258, 0x4280a121},
+    {0x40424229, 0x33aa52d2, 0x50a40205, 0x382a154e},
+    {0x269528a0, 0x80090220, 0x512549d0, 0x8148c820},
+    {0x88008a06, 0x5aa1288d, 0x0a913012, 0xad12094a},
+    {0x51b65130, 0x0244a920, 0x48490649, 0x0045a885},
+    {0x2a41288b, 0xb2580226, 0xaa24b122, 0x6d501330},
+    {0x810a8644, 0x0882d910, 0x21244448, 0x0225840a},
+    {0x2d505132, 0xd21484a9, 0x94821192, 0x910868aa},
+    {0x50452480, 0x84a25204, 0x24699602, 0x4c6a0b40},
+    {0x02152557, 0x148c04a5, 0x490840b4, 0x41012015},
+    {0xada02000, 0x6220d288, 0x21224949, 0x15548a89},
+    {0x102d2d69, 0x09530822, 0x8c2a2404, 0x911450a4},
+    {0x49028248, 0x4a444b29, 0x21498932, 0x24828922},
+    {0xa5542803, 0x60908484, 0x29082249, 0x12524409},
+    {0x144145b4, 0x16253091, 0x84529892, 0xc50a2550},
+    {0x4128a244, 0x88a90a24, 0x92844508, 0x30a1288c},
+    {0x98950c09, 0x22004951, 0x50315061, 0x0c294222},
+    {0x424251aa, 0xaa6b4004, 0x0a4a0494, 0xa2844c92},
+    {0x12288420, 0x018836d2, 0xe312d509, 0x91312122},
+    {0xd9462916, 0x6c090004, 0x084800a2, 0x0a851148},
+    {0x022950c1, 0x025292e9, 0x52459aa8, 0x5410ac13},
+    {0x28900614, 0x51449402, 0x82982003, 0x40ea41c0},
+    {0x4a4ba452, 0xa4104558, 0x34228d28, 0x8a00941a},
+    {0x45202888, 0x05951043, 0xc904a0a4, 0x29561342},
+    {0x10954323, 0xd090ab08, 0x02b2120a, 0x4000c448},
+    {0x6a821028, 0x0c4600a5, 0x540aa8a1, 0x1bba202b},
+    {0x043aca82, 0x2290a510, 0x22a0a64a, 0xc4009da0},
+    {0x52c01054, 0x48a92865, 0x885400a9, 0x90ca000a},
+    {0x94094684, 0x45050508, 0xa2835501, 0x2a1164a0},
+    {0x01261019, 0x10a0306a, 0x1458484a, 0x2125092c},
+    {0xda50a5a2, 0xb516c500, 0x890224a8, 0x4c406481},
+    {0x01129024, 0x04c01155, 0x64d5850a, 0x812c8092},
+    {0x6c490649, 0xa41d8c92, 0x04082840, 0x35213524},
+    {0x00943112, 0x29a05044, 0xb3224955, 0x0024880a},
+    {0xb642c54a, 0x42064329, 0x04928512, 0xcda522e0},
+    {0x20921020, 0x95310c05, 0xc848b150, 0x20104c0d},
+    {0x0a154d5a, 0x508820e8, 0x13120206, 0x8a949190},
+    {0x52c04481, 0x9486d501, 0x20929490, 0x244690a9},
+    {0x041d1128, 0x0231002d, 0x8c4848d4, 0x89302602},
+    {0x52412486, 0x64842d40, 0x62252205, 0x528548cc},
+    {0x894a4531, 0x14b2428a, 0x12a29552, 0x024a4111},
+    {0x2810a909, 0x91092052, 0x90980848, 0x54902a42},
+    {0x4b4610c8, 0x24a12d45, 0x2642d292, 0x44258518},
+    {0x40a94622, 0x651c5010, 0x84142925, 0x51422842},
+    {0x34114895, 0x084102d5, 0xa1a48488, 0x0a186128},
+    {0x09441190, 0x4952cc11, 0x34092913, 0xa8c30ca2},
+    {0x622a8a05, 0xaa14208a, 0x02652048, 0x052c610d},
+    {0x04886268, 0x00892b29, 0xa880464a, 0xb0811250},
+    {0xa492088a, 0xb5604040, 0x95369891, 0x86289224},
+    {0x12929210, 0x040b294e, 0x00000124, 0x48aaa90a},
+    {0x52446143, 0xca508c21, 0xb6edac24, 0x220404e2},
+    {0x04148d28, 0x11542190, 0x81084140, 0x59299008},
+    {0x69421045, 0x6502d24b, 0x54221a5b, 0x01645751},
+    {0x0228d319, 0x044a0800, 0x1164a104, 0x5a02000a},
+    {0x52920460, 0xb290a375, 0x450908a0, 0x02556ad1},
+    {0x2882550b, 0x0045140a, 0x4248564e, 0xa9488205},
+    {0xa2649088, 0xad284081, 0x19250040, 0x080248b4},
+    {0x09124551, 0x20832db4, 0x2422a915, 0x53324a05},
+    {0x95148a06, 0x46384002, 0xc1884964, 0x08c91590},
+    {0xa44130d1, 0x92835564, 0x2c922480, 0x6204804a},
+    {0x112a0a14, 0x50280488, 0x8222a02d, 0x94683210},
+    {0x8290d2a2, 0x09a1a80a, 0x524c1691, 0x098acacb},
+    {0x6c44802c, 0x440e0369, 0x1490a122, 0xa4010880},
+    {0x012a1581, 0xb2a0a800, 0x21050954, 0x52b4221d},
+    {0x5490c854, 0x000aa4b3, 0x9c64a40a, 0x0804c8a0},
+    {0x09069205, 0x5b502504, 0x012814a2, 0x91a61a45},
+    {0xc8502162, 0x80250954, 0x6525a158, 0x2610820a},
+    {0x13459408, 0x15886442, 0x18821402, 0xa16254d0},
+    {0x40282595, 0xd02b0308, 0x825881a2, 0x0c0c2205},
+    {0x5552a050, 0x0b0068b5, 0x32453418, 0x20a2905a},
+    {0x0a041602, 0xd4590a01, 0x89110642, 0xd5204b80},
+    {0x52d5a0d4, 0x0142414c, 0xa4aa60c9, 0x088d082a},
+    {0xa0100504, 0x3a249522, 0x14488c11, 0xa2a4a284},
+    {0x16a2b4a9, 0x808a4489, 0x91451104, 0x14011930},
+    {0x20140124, 0x4d305050, 0xa212a36a, 0x84dc828a},
+    {0xaa49a481, 0x20450e8a, 0x2a901802, 0x30806442},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(11)
+  {  // level 11: redness 88
+    {0x09a01535, 0x9a946023, 0x804346d8, 0x06360b1a},
+    {0x2416a040, 0x022315a8, 0x6d985085, 0x69215040},
+    {0xa9424e8a, 0x68a85004, 0x02252249, 0x91448b5a},
+    {0x4a549095, 0x064906f3, 0x50825a54, 0x442a5003},
+    {0x14a24650, 0xb095b000, 0xad388206, 0x1568a558},
+    {0x6109104b, 0x8b40055d, 0x44a534d0, 0xa5051442},
+    {0x0a6ced10, 0xa05f7285, 0x10014614, 0x10ac2129},
+    {0xb1210146, 0x15000420, 0x53da50a5, 0x4a219694},
+    {0x048a5431, 0x2574d9ab, 0x2c049589, 0x52945025},
+    {0x749492c9, 0x68020208, 0x8169202a, 0x24c226a8},
+    {0x82a24104, 0x852aa965, 0xb60a6d20, 0x92259044},
+    {0x28491c59, 0x3150a448, 0x01210187, 0x29985526},
+    {0x2b094142, 0x4d06150b, 0xd8d4d468, 0x48028290},
+    {0x48642a29, 0x20d8e0a8, 0x42049121, 0x4b746894},
+    {0x2313458d, 0x560a0ca5, 0x96a8260d, 0x20850a8a},
+    {0xac544821, 0x1262a208, 0x409350c0, 0x1490b0b1},
+    {0x21252248, 0xa09091a9, 0x3a148a3a, 0xca2d0644},
+    {0x49509556, 0x9b172426, 0x82c03084, 0x2180588a},
+    {0x4a454841, 0x21501651, 0x582b46a1, 0x4c2b4251},
+    {0x451a2529, 0x4c494088, 0x0288902d, 0x11a1148a},
+    {0x30a0a949, 0x292b5aa7, 0xaa321580, 0x54144948},
+    {0x8a951496, 0x45404210, 0x48c56075, 0x4a8aa413},
+    {0xa2124420, 0x109b249a, 0x9212550a, 0x113112a4},
+    {0x5ac852d2, 0x562058c2, 0x091004a1, 0xcd4a5494},
+    {0x02170816, 0x20ad8218, 0xe4d3aa8d, 0x208a8912},
+    {0xb4606b40, 0x9984568b, 0x050c1230, 0x94282a61},
+    {0x01148016, 0x46294860, 0x34a0a146, 0x45a2a10e},
+    {0xdaa15761, 0xa0a9092c, 0xc15a4c29, 0x141a8520},
+    {0x004a9009, 0x15826322, 0x8901a288, 0x614238a6},
+    {0xd75424d4, 0xd41a1888, 0x35241166, 0x9458c210},
+    {0x0821ca11, 0x22c4c4b5, 0x40ca4a10, 0x12850a95},
+    {0x62941126, 0x98221200, 0x8a29a546, 0x44a93144},
+    {0x09426ac8, 0x051cd2e7, 0xaa401051, 0x95248494},
+    {0x2c4c8412, 0x69410808, 0x129b6b14, 0xa0a254a5},
+    {0xc33132a2, 0x15249bb1, 0xa4808555, 0x2d169210},
+    {0x1844a289, 0x40b24004, 0x12565041, 0x40284946},
+    {0x428d08ac, 0x36064aaa, 0x495124a9, 0x0b453251},
+    {0x4a506921, 0x40d05449, 0xa5055506, 0xb450852a},
+    {0x14ab0914, 0x8d131324, 0x14680130, 0x81166448},
+    {0x5100a452, 0x7094445b, 0xd1035542, 0x565089a5},
+    {0x8a6a26c2, 0x03215280, 0x126c480d, 0x1096a80c},
+    {0x2229c01a, 0x544d1434, 0x250885f1, 0xd2400561},
+    {0x64881a94, 0x22504583, 0xa4433204, 0x04595114},
+    {0x08a54141, 0x9a555858, 0x89a8a492, 0x6b4a6c4a},
+    {0xab24aa33, 0x21022249, 0x651228b2, 0x0041038a},
+    {0x4048898c, 0xc8a99549, 0x084a450a, 0x549a5831},
+    {0x1acb2820, 0x4b282112, 0x65a19148, 0x9520a2c4},
+    {0xa0104556, 0x1005aaa4, 0x84142623, 0x20950a19},
+    {0x87a69211, 0x6762480c, 0x399290a4, 0x5d296942},
+    {0x30529548, 0x88491361, 0x84436494, 0x82440854},
+    {0x4d08b066, 0x2328620a, 0xb3180512, 0xb0a9a74a},
+    {0x20a50510, 0xd88b1969, 0x20c54941, 0x8d2a4848},
+    {0x9b28a94a, 0x0420840a, 0x8e12b258, 0x4282a121},
+    {0x40424a29, 0x33aa72d2, 0x50a40207, 0x382a154e},
+    {0x36b528a4, 0x80090224, 0x51254dd0, 0x8348ca20},
+    {0x88008a86, 0x5ab12c8d, 0x8a913012, 0xad12095a},
+    {0x51b65130, 0x0246a920, 0x48490649, 0x0045a885},
+    {0x2a41288b, 0xb25802a6, 0xab24b12a, 0x6d581330},
+    {0x811a8644, 0x0a82d911, 0x2124c448, 0x0225840a},
+    {0x2d505132, 0xd25484a9, 0x948a1192, 0xb18868aa},
+    {0x50452480, 0x84a25204, 0x24699602, 0x4c6a0b40},
+    {0x4215255f, 0x148d14b5, 0x490840b4, 0x41016035},
+    {0xada0a000, 0x6220d288, 0x21a25949, 0x15548a89},
+    {0x102d2d69, 0x09530822, 0x8c2a2505, 0xd11452a4},
+    {0x49428248, 0x4a446b29, 0x65498932, 0x24a28922},
+    {0xa5542803, 0x609484a4, 0x29282249, 0x1252544d},
+    {0x144555b4, 0x16253095, 0x84539892, 0xc50a2550},
+    {0x4128a244, 0xc9a94a24, 0x9384450c, 0x31a1288c},
+    {0x9a950c09, 0x22044b51, 0x50315261, 0x0c2d4222},
+    {0x424251aa, 0xaa6b400c, 0x0a4a0494, 0xa2844c9a},
+    {0x1228c420, 0x018836d2, 0xe352d509, 0xd1312522},
+    {0xd9462b16, 0x6c290404, 0x084820a2, 0x0a851148},
+    {0x022950c1, 0x0252b2e9, 0x5a459aac, 0x5414ac1b},
+    {0xa8900614, 0x59449402, 0x82982043, 0x42ea41c0},
+    {0x4a4ba4d2, 0xa4124558, 0x34228d28, 0xaa00941a},
+    {0x45282888, 0x05951043, 0xc944a1a4, 0x29563342},
+    {0x10954327, 0xd090eb18, 0x02b2120a, 0x4000c448},
+    {0x6a821428, 0x0c4608a5, 0x540aa8a1, 0x1bba202b},
+    {0x043aca82, 0x2290a512, 0x2aa4a64a, 0xc4019da0},
+    {0x52c21074, 0x58a92865, 0x885410a9, 0x90ca020a},
+    {0x94096684, 0x45058708, 0xa3835511, 0x2a1164a2},
+    {0x21a61019, 0x10b0306a, 0x3458494a, 0xa1ad192c},
+    {0xda50a7a2, 0xb516c500, 0x890224a8, 0x4c406481},
+    {0x01129024, 0x04c01155, 0x64d5a50b, 0x912e82b2},
+    {0x6d494649, 0xa41d8c92, 0x04082850, 0x35213524},
+    {0x00943112, 0x29a05044, 0xb3624955, 0x0024880b},
+    {0xb642c54a, 0x420643a9, 0x04968512, 0xdda522e0},
+    {0x20b21020, 0x95312c05, 0xd848b150, 0x20914c0d},
+    {0x0a154d5a, 0x50c820e8, 0x13122626, 0x8a949190},
+    {0x72c04485, 0x9686d703, 0x20929490, 0x644690a9},
+    {0x041d3128, 0x8231002d, 0x8d4848d4, 0x89302602},
+    {0x53412486, 0x6484ad50, 0x62252205, 0x528548ec},
+    {0x896a4531, 0x14b24a8a, 0x12a29552, 0x124a5111},
+    {0x2810a909, 0x91092052, 0x90980849, 0x54902a42},
+    {0x4b4610ca, 0x24a32d45, 0x2643d292, 0x452d855c},
+    {0x40a94622, 0x651c5210, 0x94542925, 0x51422842},
+    {0x35116895, 0x084102d5, 0xa1a484a8, 0x0a186328},
+    {0x094411b0, 0x4952dc11, 0x34092913, 0xa8c30ca2},
+    {0x622a8a05, 0xab1420ca, 0x03652148, 0x052c610d},
+    {0x14a8e268, 0x00892b29, 0xa888464a, 0xb0811250},
+    {0xa4920c8a, 0xb5624440, 0xd536d891, 0x862892a4},
+    {0x12929250, 0x040b294e, 0x00000124, 0x48aaa90a},
+    {0xd244614b, 0xca508c21, 0xb6edad26, 0x228424e2},
+    {0x04548d28, 0x11542194, 0x81084140, 0x5929900c},
+    {0x69431045, 0x6502d24b, 0x54231a5b, 0x01645751},
+    {0x0a28d319, 0x045a0c40, 0x1164a104, 0x5a02000a},
+    {0x52920460, 0xb290a375, 0x550988b0, 0x22556ad1},
+    {0x288a550b, 0x8445540a, 0x4248564e, 0xa9589205},
+    {0xa26490a8, 0xad284081, 0x19a50040, 0x080248b4},
+    {0x09126551, 0x20832db4, 0x2422ab15, 0x53324a05},
+    {0xd5548a06, 0x46b8400a, 0xc1984966, 0x08c955b0},
+    {0xa44130d1, 0x92835564, 0x3c922480, 0x6204804a},
+    {0x112a0a14, 0x50280488, 0x8222a42d, 0x946a3210},
+    {0x9292d2a2, 0x0da1b80a, 0x524c9691, 0x098acacb},
+    {0x6c44a42c, 0x440e03e9, 0x14d0a122, 0xa42108a0},
+    {0x012a1581, 0xb2e0a804, 0xa1050954, 0x52b4221d},
+    {0x5490c854, 0x040aa4b3, 0x9c64e40a, 0x0c04c9a0},
+    {0x49269315, 0xdb542504, 0x012814a2, 0x91a65a45},
+    {0xc8502162, 0x80258954, 0x6525a358, 0x2610822a},
+    {0x1b459408, 0x15887453, 0x98821402, 0xa16254d0},
+    {0x40292595, 0xd06b0308, 0x8258c1aa, 0x4c0d2605},
+    {0x5552a052, 0x0b0068b5, 0x32453418, 0x22a2905a},
+    {0x0a041622, 0xd45d0a01, 0x89110642, 0xd5304ba0},
+    {0x52d5a8d4, 0x0142516c, 0xa4aa61cd, 0x088d282a},
+    {0xa0100504, 0x3a249522, 0x14488c31, 0xa2a4a285},
+    {0x17a6f4a9, 0x818a4489, 0x91451104, 0x54011930},
+    {0xa0140124, 0x4d315058, 0xa652a36a, 0x86dc828a},
+    {0xaa49a489, 0xa0450e8a, 0x2a981802, 0x30816462},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(12)
+  {  // level 12: redness 96
+    {0x09a01535, 0x9a946023, 0x804346d8, 0x06360b1a},
+    {0x6416a042, 0x232315a8, 0xed995485, 0x69295040},
+    {0xa9524eaa, 0x68a8d00c, 0x0a652249, 0x95448b5a},
+    {0x4a54b095, 0x06490ef3, 0x50825a54, 0x442a5483},
+    {0x14a24650, 0xb095b000, 0xad388286, 0x1568a558},
+    {0x6109114b, 0x8b40055d, 0x45a534d0, 0xe5051442},
+    {0x0e6ced18, 0xa85f72a5, 0x10094614, 0x10aca129},
+    {0xb1210146, 0x15000420, 0x53da50a5, 0x4a219695},
+    {0x048a5431, 0x2575d9ab, 0x2c0495a9, 0x52945025},
+    {0x749496cd, 0x68820608, 0x8169242a, 0x24ca27a8},
+    {0x82a24104, 0x852aa965, 0xb64a6d20, 0x92259044},
+    {0x28595c59, 0x3150a448, 0x0121018f, 0x29985526},
+    {0xab094142, 0x4d06150b, 0xdcd4dc68, 0x48028ab1},
+    {0x48e42a29, 0x20d8e1a8, 0x42069121, 0x4b746894},
+    {0x231345cd, 0x560a0ca5, 0x96a8261d, 0x24850a8a},
+    {0xac545821, 0x1262aa0a, 0x409351c1, 0x1491b0b1},
+    {0x21252348, 0xa49091a9, 0x3a548a3a, 0xca2d0644},
+    {0x49549556, 0x9b1724a6, 0x82c43084, 0x21a0599a},
+    {0x5a454849, 0x21505651, 0x5a2b46a9, 0x4c2f4251},
+    {0x451a2529, 0x4c494088, 0x2288d02d, 0x11a1348a},
+    {0x30a0a949, 0x292b5aa7, 0xaa321780, 0x54544968},
+    {0x8a951496, 0xc5404250, 0x49c56075, 0x4a8aa513},
+    {0xa252c420, 0x129b269a, 0x9216550a, 0x913112a4},
+    {0x5ac853d2, 0x562058c2, 0x295004a1, 0xcd4a5494},
+    {0x82170816, 0x20ad8218, 0xe4d3ea8d, 0x228ac912},
+    {0xb5606b40, 0x9984568b, 0x050c1230, 0x94282a61},
+    {0x0114905e, 0x46296860, 0x34a2a1c6, 0x65a2a51e},
+    {0xdaa55761, 0xa8a9092c, 0xc95a4c29, 0x141a8520},
+    {0x104a9009, 0x15a26322, 0x8909aa88, 0x634238e6},
+    {0xd75425d4, 0xd41a988a, 0x35241166, 0x9458c211},
+    {0x0821ca11, 0x22c4c6b5, 0x50ca4a10, 0x12850a95},
+    {0x62961126, 0x98a21200, 0x8a29a556, 0x64a97544},
+    {0x49526ac8, 0x451cd2f7, 0xaa441051, 0x95248494},
+    {0x2c4c841a, 0x69410808, 0x12bb6b14, 0xa0a254a5},
+    {0xc33132a2, 0x152cbbb3, 0xe4808555, 0x2d169298},
+    {0x1844a289, 0x40b24044, 0x12565441, 0x60a84946},
+    {0x628d0cac, 0x3e064aaa, 0x495124a9, 0x0b453251},
+    {0x4a50e921, 0x40d0d449, 0xa50d5516, 0xb452852a},
+    {0x94ab0994, 0x8d131324, 0x14689130, 0x81167448},
+    {0x5104a452, 0x70d4445b, 0xd1835542, 0x565089a5},
+    {0x8a6a26c2, 0x0b215280, 0x126c480d, 0x9196aa0c},
+    {0x2aa9c81a, 0x544d14b6, 0x250885f1, 0xd2410561},
+    {0x64881ad4, 0xa2514583, 0xa4533204, 0x04595114},
+    {0x08a74141, 0x9a555858, 0x99a8a692, 0x7b4a6c6a},
+    {0xab24aa33, 0x25022249, 0x651228b2, 0x0041038a},
+    {0x4048898c, 0xc8ed9549, 0x084a450a, 0x569e5831},
+    {0x1ecb2821, 0x4b282512, 0x65a99948, 0x9520a2c6},
+    {0xe01065d6, 0x1005aae4, 0x84142633, 0x20950a19},
+    {0x87a69211, 0x676a480c, 0x399291a5, 0x5d296942},
+    {0x30529548, 0x88491361, 0x84636494, 0x82440854},
+    {0x4d28b266, 0x2328e20a, 0xb3181512, 0xb0a9a74a},
+    {0x20a50510, 0xd8cb1969, 0x20c54965, 0x8d2a484a},
+    {0x9b28a94a, 0x0424850a, 0x8e12b258, 0x4282a921},
+    {0x40464a29, 0x73aa72d2, 0x50a44207, 0x386a154e},
+    {0xb6b528a4, 0x88090224, 0x53254dd0, 0x8348ca20},
+    {0x88008a86, 0x5ab12c8d, 0x8a993016, 0xad12095a},
+    {0x55b65330, 0x4246e930, 0x484906c9, 0x2045a885},
+    {0x2a4128ab, 0xb25802a6, 0xab24b12a, 0x6d583330},
+    {0x811aa644, 0x0a82d911, 0x2124cc48, 0x0225848a},
+    {0x2d525133, 0xd25484a9, 0x948a11b6, 0xb18868aa},
+    {0x51452480, 0xa4a25284, 0x26699602, 0x4c6b0b41},
+    {0x42152d5f, 0x148d14b5, 0x490844b4, 0x41116835},
+    {0xada0a000, 0x6328d28a, 0x31a35949, 0x1d548a89},
+    {0x102d2d69, 0x195308a2, 0x8c2a2525, 0xd11452a4},
+    {0x4b42c34c, 0x4a446b29, 0x6549a932, 0x24a28922},
+    {0xa5542803, 0x609484a4, 0x29282249, 0x1a52544d},
+    {0x144555b4, 0x16253095, 0x845398d2, 0xc51aa550},
+    {0x6128a244, 0xc9a94a24, 0xb384450c, 0xb1a1288d},
+    {0x9a950c49, 0x22044b51, 0x54355261, 0x0c2d42a2},
+    {0x425251aa, 0xaa6b404d, 0x0a4a1494, 0xa2844c9a},
+    {0x1228c420, 0x0988b6d2, 0xe352d529, 0xd9716522},
+    {0xd9462b16, 0xec290404, 0x084820a2, 0x0a851148},
+    {0x032950c9, 0x0352b2e9, 0x5a479eac, 0x5414ac1b},
+    {0xa8920614, 0x59449406, 0x83982043, 0x42ea45c0},
+    {0x4a4bb4d3, 0xa45245d8, 0x3422cd28, 0xaa01941a},
+    {0x55282888, 0x05951043, 0xc94ca1a5, 0x2d763352},
+    {0x10d54327, 0xf290eb18, 0x12b2161a, 0x4000c448},
+    {0xea8234a8, 0x0c6608a5, 0xd48aa8a1, 0x1bbe212b},
+    {0x043aca82, 0x2294a512, 0x2aa4a64a, 0xc401bda0},
+    {0x52c21076, 0x58a928e5, 0x885410a9, 0x92ea021a},
+    {0x94196684, 0x47058708, 0xa3835511, 0x2a1164a2},
+    {0x25a61059, 0x90b0306a, 0x3459494a, 0xa1ad192c},
+    {0xda50a7a2, 0xb516c504, 0x892224a8, 0x4c406481},
+    {0x0116902c, 0x04c03155, 0x64d5a50b, 0x912e82ba},
+    {0xed494649, 0xa41d8e92, 0x14082a50, 0x37213524},
+    {0x00943952, 0x39e05044, 0xb362c955, 0x802ca90b},
+    {0xb642c54a, 0x420743a9, 0x04968512, 0xdda522e0},
+    {0x22b21020, 0x95312c15, 0xd848b152, 0x20914c0d},
+    {0x0a154d5a, 0x50c820e8, 0x17522626, 0x8a9491b0},
+    {0x72c14485, 0x9686d703, 0x60929490, 0x644694ab},
+    {0x041d3528, 0x9239002d, 0x8d4c48d4, 0x89302602},
+    {0x534124a6, 0x6484ad50, 0x62252215, 0x52a548ec},
+    {0xc96a4531, 0x14b24a8a, 0x1aa2d552, 0x124b5111},
+    {0x2811a909, 0x95092052, 0x90980a49, 0x54902a42},
+    {0x4b4614ca, 0x24a32d55, 0xa643d292, 0x452d855c},
+    {0x44a94622, 0x659c5212, 0x94542925, 0x51422842},
+    {0x35156895, 0x084102d5, 0xa1a484a8, 0x4a18e328},
+    {0x094411b0, 0x6952dc11, 0x3409a913, 0xa8c30ca3},
+    {0xe22a8a05, 0xab1520ca, 0x0b652948, 0x072c612d},
+    {0x14a8f26a, 0x00892b29, 0xa888464a, 0xb0a31650},
+    {0xa4920c8a, 0xb5724440, 0xd5b6d891, 0x962892a4},
+    {0x12939250, 0x248b295e, 0x00000124, 0x48aaa90a},
+    {0xd244614b, 0xca50ad21, 0xb6edbd36, 0x228424e2},
+    {0x05548d28, 0x11552194, 0x85084140, 0xdd29920c},
+    {0x694b1045, 0x6d02d24b, 0x54231a5b, 0x01755751},
+    {0x8a28f399, 0x04da0c40, 0x1164a105, 0x5a02004a},
+    {0x52920464, 0xb290a375, 0x55198ab0, 0x22556ad1},
+    {0x288b550b, 0x8445540a, 0x4248564e, 0xa9d89205},
+    {0xa66490a8, 0xad2c44a1, 0x59a52040, 0x080249b4},
+    {0x09126551, 0x20832db4, 0x2422ab15, 0xd3364a05},
+    {0xd5548a0e, 0x56b8400a, 0xc19a4976, 0x0cc955b2},
+    {0xa449b1d1, 0x92835564, 0x3c922480, 0x6204844a},
+    {0x132a0a14, 0x502c46a9, 0x8222a4ad, 0x956a3210},
+    {0x9292d2a2, 0x2da1b80a, 0x524c9691, 0x498acacf},
+    {0x6c44a42c, 0x440e03e9, 0x14d0a922, 0xa42128a0},
+    {0x012a15a1, 0xb2e0ac04, 0xa1050954, 0x52b5221d},
+    {0x5690c854, 0x040aa4b3, 0x9e66e48a, 0x4c84c9a0},
+    {0x49269315, 0xdb542504, 0x212814a2, 0x91a65a4d},
+    {0xc8582962, 0x80258954, 0x6525a35a, 0x2618822a},
+    {0x1b459408, 0x37887453, 0x98921402, 0xa96254d0},
+    {0x40292595, 0xd06b0308, 0x8658c9ea, 0x4c8d2685},
+    {0x55d2a152, 0x0b0068f5, 0x32453418, 0x22a2905a},
+    {0x8a041622, 0xd45d8a01, 0x89110642, 0xd5314ba0},
+    {0x52d5a8d5, 0x0142516c, 0xe5aa71cd, 0x088d282a},
+    {0xa8100514, 0x3a349522, 0x14488c31, 0xb2a4a68d},
+    {0x17a6f4a9, 0xa18a4489, 0x91455104, 0x54211930},
+    {0xa0540124, 0x4d315158, 0xa652a36a, 0x86dc828a},
+    {0xaa4bac89, 0xa0450e8a, 0x2a981812, 0x30817462},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(13)
+  {  // level 13: redness 104
+    {0x09a055b5, 0x9a946023, 0x804346da, 0x06360b9e},
+    {0x6516a042, 0x232b17a8, 0xed995485, 0x69a97040},
+    {0xa9524eaa, 0x68a8d00c, 0x0a652269, 0x95448b5a},
+    {0x4a54b095, 0x8e490ef3, 0x50825a54, 0x642b5483},
+    {0x14a64650, 0xb095b100, 0xad3a8286, 0x1568a55c},
+    {0xe189114b, 0x8b60455d, 0x45a534d8, 0xe5051442},
+    {0x0e6ced58, 0xa85f72a5, 0x58094614, 0x19aca9a9},
+    {0xb1211146, 0x95000420, 0x53da50a5, 0xca319695},
+    {0x04ab5431, 0x2575d9af, 0x2c0595a9, 0x52955025},
+    {0x749496cd, 0x688a2648, 0xa169242a, 0x24ca27a8},
+    {0x86a24124, 0x852aa965, 0xb64a6d20, 0x9625904c},
+    {0x28595d59, 0x3550a448, 0x0129018f, 0xa9d85526},
+    {0xab0b4142, 0xcd27152b, 0xdcd4dc68, 0x48038ab1},
+    {0x48e43a29, 0x20d8e1a8, 0x522691a1, 0x4b7c6894},
+    {0x231345cd, 0x568a0ca5, 0x96a8261d, 0x24850a8a},
+    {0xac545825, 0x1262ea2a, 0x4093d1c1, 0x34d1b2b1},
+    {0x23252348, 0xa49491a9, 0x3a548a3a, 0xca2d2645},
+    {0x4954d556, 0x9b1724a6, 0x82c43484, 0x21a0599a},
+    {0x5a454849, 0x21505651, 0x5a2b46e9, 0x4e2f4251},
+    {0x455a2729, 0x4cc9488c, 0x22c8d02d, 0x51a1348e},
+    {0x34a2a949, 0x292b5aa7, 0xaa321782, 0x54544968},
+    {0x8a951496, 0xd5444250, 0x49c56875, 0x4a8ba513},
+    {0xa252d428, 0x129b269a, 0x9216550a, 0x913112a4},
+    {0x5ac853d2, 0x566058c2, 0x2d5004b1, 0xdd4a5496},
+    {0x82170816, 0x60ad8258, 0xe4d3ea8d, 0x228ac992},
+    {0xbd616b41, 0x9984568b, 0x050c1a30, 0x946a2a61},
+    {0x0114905e, 0x462b6962, 0x34a2a1c6, 0x65a2a51e},
+    {0xdaa55761, 0xa8a9092c, 0xc95a4c29, 0x141aa520},
+    {0x104a9009, 0x15a26322, 0x8929aa98, 0x634238e6},
+    {0xd7542dd6, 0xd41a98aa, 0x35241167, 0x947ac211},
+    {0x08a1ca31, 0x22d4d6b5, 0x52caca10, 0x12850a95},
+    {0x6a961126, 0x9aa21200, 0x8a29add6, 0x64a97564},
+    {0x49526ac8, 0x451dd2f7, 0xaa441051, 0x952c8494},
+    {0x2c4d845a, 0x69410808, 0x12bb6b14, 0xa4a254a5},
+    {0xc3313aa2, 0x152cbbb3, 0xe4808555, 0x2d169298},
+    {0x1944a289, 0x40b24244, 0x1a565445, 0x60a8cd46},
+    {0x62ad0cae, 0x3f064aaa, 0x495124a9, 0x0b453251},
+    {0x4a50e921, 0x40d0d449, 0xa50d5596, 0xb452852a},
+    {0x94ab0994, 0x8d1713a4, 0x14689131, 0x81967448},
+    {0x5304b45a, 0x70d4545b, 0xd583574a, 0x5e5089a5},
+    {0x8a6a26c2, 0x0b215280, 0x126c480d, 0x9196aa2d},
+    {0x6aa9c81a, 0x544d14be, 0x250a95f1, 0xd2492561},
+    {0x64881ad4, 0xa2d14583, 0xa453320c, 0x04595114},
+    {0x08a76145, 0x9a555a58, 0x99a8a692, 0x7b4a6c6a},
+    {0xbb24ae33, 0x25022249, 0x651328b2, 0x0061038a},
+    {0x4058898c, 0xc8edd54d, 0x084a454a, 0x569ed831},
+    {0x1ecb2821, 0x5b282512, 0x75e9d948, 0xd520aac6},
+    {0xe01065d6, 0x1085aae4, 0x84142633, 0x20d50b19},
+    {0x87a69211, 0x676a480c, 0x399291a5, 0x5d29e952},
+    {0x3052954c, 0x98491b71, 0x84636494, 0x82440854},
+    {0xcd28b266, 0x2328e20a, 0xb31c1512, 0xb2a9a74a},
+    {0x24a72510, 0xdacb1969, 0x28c54965, 0xad2a494a},
+    {0x9b28a94b, 0x0424850a, 0x8e32b258, 0x4292a931},
+    {0x40464aa9, 0x73aafad2, 0x50a44a07, 0x386a154e},
+    {0xb7b568b4, 0x88890224, 0x53254df0, 0x8349ea20},
+    {0x88008a86, 0x5ab12ccd, 0xaa993016, 0xad12095a},
+    {0x55be5330, 0x4246e930, 0x484906c9, 0xa0c5a8c5},
+    {0x2a4128ab, 0xba5a02a6, 0xab26b12a, 0x6d583732},
+    {0xa11aa644, 0x0a92d915, 0x2964cc48, 0x0227848a},
+    {0x2d52513b, 0xd25494a9, 0xd48a11b6, 0xb58868aa},
+    {0x51452480, 0xa4a25284, 0x2669b602, 0x4c6b0b49},
+    {0x4a352ddf, 0x148d14b5, 0x490c44b4, 0x41116935},
+    {0xada0a000, 0xe328d28a, 0x31a35949, 0x1d548a89},
+    {0x502d2d69, 0x195308aa, 0x8c2a2525, 0xd19672b4},
+    {0x4b42cb4c, 0x4a546b29, 0x65c9a932, 0x24a28923},
+    {0xa55c2813, 0x649584a4, 0x292c2649, 0x1a52544d},
+    {0x144555b4, 0x16653295, 0x845398d2, 0xc51aa750},
+    {0x6128a244, 0xc9a94a24, 0xb384450c, 0xb1a128ad},
+    {0x9a951c49, 0x32145b51, 0x54b55263, 0x0c2d52a2},
+    {0x4ad353ae, 0xaa6b404d, 0x0a4a9594, 0xa2844c9a},
+    {0x1228c420, 0x0988b6d2, 0xe352d529, 0xd9796522},
+    {0xd9462b56, 0xec290414, 0x284820a2, 0x0a851148},
+    {0x232950c9, 0x0352b2e9, 0x5a679eac, 0x7414ac5b},
+    {0xa8d24614, 0x594c9406, 0x8398204b, 0x42ea45c2},
+    {0x4a4bb4d3, 0xb45265d8, 0x3422cd28, 0xaa09941a},
+    {0x55282888, 0x05951443, 0xc94ca1a5, 0x2df63352},
+    {0x10d54337, 0xf292eb38, 0x12b2961a, 0x4000cc48},
+    {0xea8234a8, 0x0c6608a5, 0xd48aa8a1, 0x3bbe212b},
+    {0x153aca82, 0x6294e512, 0x2aa4a74a, 0xc401bda4},
+    {0x52c21276, 0x58a928e5, 0x885490ad, 0x92ea021a},
+    {0x94196684, 0x47058709, 0xa7935511, 0x2a1164e2},
+    {0x25a69859, 0x90f4386a, 0x3459494a, 0xa5ad192c},
+    {0xda50a7a2, 0xb516c524, 0x892224a8, 0x4c416481},
+    {0x0156902c, 0x04c13155, 0x65d5a54b, 0x912e8aba},
+    {0xed494649, 0xa61d8e92, 0x940c2a54, 0x37a13524},
+    {0x08943952, 0x39e05054, 0xb362c955, 0x802ca90b},
+    {0xb64ac54a, 0x420f4ba9, 0x04969512, 0xdda522e8},
+    {0x22b21124, 0x95312c15, 0xd848b1d2, 0x20914c0d},
+    {0x8a156d5a, 0x50c920e8, 0x17522626, 0x8ab491b0},
+    {0x72c144a5, 0x9686d703, 0x60939492, 0x7646d4ab},
+    {0x043d3528, 0x9239106d, 0x8d6c4ad4, 0x89342602},
+    {0x5b4124a6, 0x64c4ad52, 0x62253215, 0x52a548ec},
+    {0xc96a5531, 0x14b64a8a, 0x1aa2d552, 0x924b5315},
+    {0x2811a989, 0xd5092152, 0x90980a49, 0x54902a42},
+    {0x4b5614da, 0x24a3ad55, 0xa74bd2b2, 0x452d955c},
+    {0x64a94622, 0x659c5212, 0x94542925, 0x59622842},
+    {0x35156895, 0x0a4102d5, 0xa5a4a6aa, 0x4a18e32c},
+    {0x094515b4, 0x695add11, 0x3419a913, 0xa8c30ca3},
+    {0xeaaa8a05, 0xab1520ca, 0x0b652968, 0x272c612d},
+    {0x14a8f2ea, 0x04892b2d, 0xa888464a, 0xb0a35650},
+    {0xa4920c8a, 0xb5724440, 0xd5b6d893, 0x972892a6},
+    {0x12939250, 0x248b295e, 0x08020324, 0x48aaa91a},
+    {0xda54654f, 0xca50ad21, 0xb6edbd36, 0x228424e2},
+    {0x05548d28, 0x115d2194, 0xa5084140, 0xdd29920c},
+    {0x694b1045, 0x6d02d24b, 0x54ab1a5b, 0x01755751},
+    {0x8a28f399, 0x04da1c48, 0x1164b145, 0x5a02104b},
+    {0x52d20464, 0xb292a375, 0x55198ab0, 0x22556ad9},
+    {0x288b550b, 0x9445550a, 0x424a564e, 0xadd99205},
+    {0xa66494a8, 0xad6c44a5, 0x5da520c0, 0x080249f4},
+    {0x29126551, 0x20832db4, 0x2422ab15, 0xf3364a05},
+    {0xd5548a0e, 0x56b8500a, 0xc19a4976, 0x0cc975b2},
+    {0xa449b1d1, 0x92835564, 0x3c92a480, 0x6224844a},
+    {0x132a0a14, 0x526c46a9, 0x82a2a4ad, 0x956a3290},
+    {0x9292d2a2, 0x2da1b80a, 0x764e9691, 0x498acacf},
+    {0x6c64a52e, 0x440e03e9, 0x14d0a926, 0xa42928a0},
+    {0x212a15a1, 0xb2f0ac04, 0xa1150954, 0x52b5261d},
+    {0x5692c854, 0x240ba4bb, 0x9e66e48a, 0x4c84c9a0},
+    {0x49269315, 0xdbd42544, 0x212814a2, 0x91a65a4d},
+    {0xc9586962, 0x80258954, 0x6525a35a, 0x2618822a},
+    {0x1b45942a, 0x37887453, 0x98925402, 0xa96274d0},
+    {0x60292595, 0xd06f0308, 0xa6d8c9ea, 0x4c8d2685},
+    {0x55d2a952, 0x0b206cf5, 0x32453419, 0x22a2905e},
+    {0x8a145622, 0xf45d8a05, 0x89130642, 0xd5314ba0},
+    {0x52d7a8d5, 0x0542516c, 0xe5aa71cd, 0x088d282a},
+    {0xa8100514, 0x3a349522, 0x14488c31, 0xb3a4a6cd},
+    {0x17a6f6a9, 0xa18a548b, 0x914d5544, 0x54255930},
+    {0xa0540126, 0x4d715158, 0xa652a36a, 0x86dc828a},
+    {0xae4bac89, 0xa4458eaa, 0x3a985812, 0x70817462},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(14)
+  {  // level 14: redness 112
+    {0x09b055b5, 0x9a947023, 0x814346da, 0x06370b9e},
+    {0x6516a24a, 0x236b17e8, 0xed995485, 0x69a97040},
+    {0xa9524eaa, 0x68a8d00e, 0x2a6d2369, 0x95448b5a},
+    {0x4a54b095, 0x8e4d0ef3, 0x52825a54, 0x64ab54a3},
+    {0x1ca6ce52, 0xb095b100, 0xad3ac286, 0x1568a55c},
+    {0xe189114b, 0x8b60455d, 0x45a534d8, 0xe5055442},
+    {0x0e6ced58, 0xa95f76a5, 0x58094e94, 0x19aca9b9},
+    {0xb1211146, 0x95000420, 0x53fa50a5, 0xca319695},
+    {0x45ab5531, 0x2575d9af, 0x2c0595a9, 0x52955025},
+    {0x749cb6cd, 0x6c8a2648, 0xa16924ae, 0x24ca2fa9},
+    {0x86a24124, 0x852aa965, 0xb74a6d20, 0x9625904c},
+    {0x28d95d59, 0x3550a54a, 0x0129818f, 0xa9d85526},
+    {0xab0b414a, 0xcd271d2b, 0xdcd4dc68, 0x5903abb1},
+    {0x48e43a29, 0x20d8e1a8, 0x522691a5, 0x4b7c6894},
+    {0x331bc5cd, 0x5e8a0ca5, 0x97a8261d, 0x24850a8e},
+    {0xacd45825, 0x1262ea2a, 0x4093d9c1, 0x34d1b2b1},
+    {0xa3252769, 0xa4b495a9, 0x7e5c8a3a, 0xca2d2645},
+    {0x4954d556, 0xdb1724a6, 0x82c4b484, 0x31a0599a},
+    {0x5a454849, 0x21505651, 0x5a2b46e9, 0x4e2f4251},
+    {0xc55a272b, 0x4ccd49ac, 0xa2ccd02d, 0x51a1348e},
+    {0x34a2e949, 0x292b5aa7, 0xae321782, 0x565c4d68},
+    {0x8a9d14d6, 0xd5444250, 0x49c56875, 0x4a8ba513},
+    {0xb252d428, 0x129b369a, 0x9216d58a, 0x917132a4},
+    {0x5ac853d2, 0x566158c6, 0x2d5804b1, 0xdd4a54b6},
+    {0x82170816, 0x64ad8258, 0xe4d3ea8d, 0x228ac992},
+    {0xbd696f61, 0x99a4568b, 0x052c1a32, 0x946a2a61},
+    {0x0114905e, 0x462b6962, 0x74a2a1c6, 0x65a2a51e},
+    {0xdba55761, 0xa8a90d2c, 0xcb5a4d29, 0x149aa520},
+    {0x504a9009, 0x17a26322, 0x8929aa98, 0x63423ae6},
+    {0xd7546dd6, 0xd41a98aa, 0x35263167, 0x9c7ac219},
+    {0x08a9ca31, 0x22d4d6b5, 0x52caca10, 0x52851a95},
+    {0x6a961326, 0x9aa21204, 0xaa29add6, 0x64a97564},
+    {0x49526ac8, 0x455dd6f7, 0xaac41051, 0x952c8495},
+    {0x2d4d845b, 0x69410808, 0x12bb6b15, 0xa4e274a5},
+    {0xc3313aa2, 0x1d2cbbb3, 0xe48495d5, 0x2d169298},
+    {0x1944a2a9, 0x40b34244, 0x1a565445, 0x60a8cd46},
+    {0x6aaf0cae, 0x7f265abb, 0x69d1a4a9, 0x0f553259},
+    {0x4a50eb21, 0x40d0d449, 0xa50d5596, 0xf45285ab},
+    {0x94ab0994, 0x8d1713a4, 0x14789131, 0x81967448},
+    {0x5344b45a, 0x72d4545b, 0xd583574a, 0x5e5089a5},
+    {0x8a6a26c2, 0x4b255280, 0x126c480d, 0x9196aa2d},
+    {0x6aabc91a, 0x544d54be, 0x6d4ad5f1, 0xd2492565},
+    {0x64981ad4, 0xa2d14583, 0xa453324c, 0x065b5314},
+    {0x0aa76145, 0x9a5d5a59, 0x99a8a692, 0xfb4a6c6a},
+    {0xbb24ae33, 0x25022249, 0x651b28b2, 0x0061038a},
+    {0x405889ac, 0xc8edd56d, 0x8a4a454b, 0x569ed831},
+    {0x1fcbaa21, 0x5b282512, 0x75e9d948, 0xd520aac6},
+    {0xe01065de, 0x1095aae4, 0x84142633, 0x22d50b19},
+    {0x8fae9211, 0x676a480e, 0x399a91a5, 0x5d2de952},
+    {0x3052954c, 0x984b1bf1, 0xc6636c9c, 0x82440854},
+    {0xcda8b266, 0x2328e20a, 0xb31c9512, 0xb2a9b74a},
+    {0x24a72530, 0xdacb1969, 0x28c54965, 0xad2a494a},
+    {0xbb28a94b, 0x0424851a, 0x8f32b358, 0x4292a931},
+    {0x40564ea9, 0x77aafad2, 0x50a64a07, 0x386a154e},
+    {0xb7b568b4, 0x888d0224, 0x53254df0, 0x8b49eb21},
+    {0x88008a86, 0x5ab12ccd, 0xaad97016, 0xad1a095a},
+    {0x55bf5330, 0x4246e931, 0x484906c9, 0xa0c5a8c5},
+    {0x2a4128ab, 0xbada06a6, 0xab26b32a, 0x6d583732},
+    {0xa55aa6c4, 0x0a92d915, 0x2974cc49, 0x122784aa},
+    {0x2d52553b, 0xd25494e9, 0xd48a11b6, 0xb5c878aa},
+    {0x5145a480, 0xaca25285, 0x2669b642, 0x4c6b0b49},
+    {0x4a352ddf, 0x14ad54b5, 0x492c44b4, 0x61116935},
+    {0xada4a020, 0xe328d68a, 0x33a35949, 0x1d548a89},
+    {0x502d2d6b, 0x195308aa, 0x8c2a2525, 0xd19672b4},
+    {0x4b42cb4c, 0x4a546b29, 0x65c9a9b6, 0x24aa89a3},
+    {0xa55d2893, 0x649594a4, 0x292c2649, 0x5a52544d},
+    {0x1cc555b4, 0x966532d7, 0x8c5398d2, 0xc51aa750},
+    {0x6128a244, 0xc9a94a24, 0xb394651c, 0xb1e128ad},
+    {0x9a951c59, 0x32145b51, 0x54b55263, 0x0e2d52a2},
+    {0x4ad353ae, 0xaaeb404d, 0x0a4a9594, 0xa2854c9a},
+    {0x1228c420, 0x0988b6d2, 0xe352d52d, 0xd9796533},
+    {0xd9563b57, 0xec2b1515, 0x2a4820a2, 0x0a851348},
+    {0x272950c9, 0x4352b2e9, 0x5a679eac, 0x7494ac5b},
+    {0xa8d24634, 0x594c9406, 0x839a214b, 0x42ea65c2},
+    {0x4a4bb6d3, 0xb45265d8, 0x7422dd28, 0xaa09941a},
+    {0x57282888, 0x05951443, 0xcd4ca1a5, 0x2df63356},
+    {0x10d5cb37, 0xf292eb3a, 0x12b2965a, 0xc001ccc8},
+    {0xea8a34a8, 0x0c6608a5, 0xd48aa8a5, 0x3bbe212b},
+    {0x153aca92, 0x6394e712, 0x2ab4a74a, 0xc481bda4},
+    {0x52c21276, 0x58a928ed, 0xc85490ad, 0x92ee421a},
+    {0x94596684, 0x47058709, 0xa7935731, 0x3a1164e2},
+    {0x25a6985b, 0x98f4386a, 0x3459494a, 0xa5ad1b2c},
+    {0xda50a7a2, 0xb516c724, 0x892234a8, 0x4c516483},
+    {0x1156b02c, 0x44d13155, 0x65d5a54b, 0xd12e8aba},
+    {0xed4946c9, 0xa61d8e92, 0x940c2a54, 0x37a13564},
+    {0x08b53952, 0x39e07056, 0xb372c955, 0x802ca90b},
+    {0xb64ac54a, 0x420f4ba9, 0x05969512, 0xdda722e8},
+    {0x22b21125, 0xdd312c15, 0xd848b1da, 0x24915e0d},
+    {0x9a956d5a, 0x50e922e8, 0x17522626, 0x8ab491b2},
+    {0x72c144a5, 0x9686d70b, 0x7093d492, 0x7646d4ab},
+    {0x043d3528, 0x9239106d, 0x8d6c4ad4, 0x89342682},
+    {0x5b4524a6, 0x65c4ed52, 0x63253295, 0x52a558ec},
+    {0xc96a5535, 0x14b64a8a, 0x5aa6d552, 0x9a5b5315},
+    {0x2911a989, 0xd5092152, 0x90980a4d, 0x5590aa62},
+    {0x4b5654da, 0x24b3ad55, 0xa74bd2b2, 0x452d955c},
+    {0x64a94623, 0x759c5253, 0x94542925, 0x59622942},
+    {0x35356995, 0x0a4112d5, 0xa5a4a6aa, 0x4b1ce32c},
+    {0x094515b4, 0x695add11, 0x3419a913, 0xa8c30ca3},
+    {0xeaaa8a05, 0xab5520ea, 0x4b67296c, 0x273c69ad},
+    {0x14a8f2fa, 0x44896f2d, 0xa888464a, 0xb0a35650},
+    {0xa6960c8a, 0xb5724440, 0xd7b6f8d3, 0x972892a6},
+    {0x52939250, 0x248b295e, 0x08220324, 0xc8aaa91a},
+    {0xda54654f, 0xcb50ad21, 0xb6edbd36, 0x32a62ce2},
+    {0x0554ad68, 0x915d25b4, 0xa508c148, 0xdd29d22c},
+    {0x694b1045, 0x6d02d24b, 0x54ab1e5b, 0x01755751},
+    {0xaa28f799, 0x04da1c48, 0x1564b145, 0xda82104b},
+    {0x56d20464, 0xb292a375, 0x75198ab0, 0x225d6ed9},
+    {0x288b754b, 0x9555550a, 0x424a564e, 0xadd99205},
+    {0xa66c94aa, 0xad6c44a5, 0x5da524d0, 0x080249f4},
+    {0x29126551, 0x2083adb4, 0x2432ab15, 0xf3b64a05},
+    {0xd5d48a2e, 0xd6b8510a, 0xc39a5976, 0x0cc975ba},
+    {0xa449b9d1, 0x928b5566, 0xbc92a480, 0x7225844a},
+    {0x1b2a0a15, 0x526c46a9, 0x82b2a4ad, 0x956a3690},
+    {0x9296d2e2, 0x2da1b82a, 0x764e96b1, 0x498acaef},
+    {0x6c64a52e, 0xc40e43e9, 0x14d0a926, 0xad2928a0},
+    {0x21aa35a1, 0xb3f0ac05, 0xa1152b54, 0x52b5261d},
+    {0x5692c85c, 0x240ba5bb, 0x9e66e48a, 0x4ca4c9a2},
+    {0x49269715, 0xdbd43544, 0x21a81cb2, 0xb1a65acd},
+    {0xc95869e2, 0x88358954, 0x6525a35a, 0x2619822a},
+    {0x1b45942a, 0x37887557, 0x98965402, 0xa96274d2},
+    {0x642d2595, 0xd06f8308, 0xa6d8c9ea, 0x4c8d2685},
+    {0x55d2a952, 0x0b206cf5, 0x32453519, 0x22aa985e},
+    {0x8a14562a, 0xf4dd8a05, 0x89334652, 0xdd314ba0},
+    {0x52d7a8d5, 0x0542516c, 0xedaa71cd, 0x08ad282a},
+    {0xa8500514, 0x3a359732, 0x14488c31, 0xb3a4a6cd},
+    {0x17a6f6a9, 0xa18a548b, 0x914d5546, 0x54255930},
+    {0xa0541166, 0x4d755158, 0xa652a36a, 0x86dc868b},
+    {0xee4bac89, 0xa4458eaa, 0x3aba5812, 0x78817462},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(15)
+  {  // level 15: redness 120
+    {0x09b055b5, 0xba947027, 0x814346da, 0x06370b9e},
+    {0x7517a24a, 0x236b17e8, 0xed995485, 0xe9a97451},
+    {0xa9524eaa, 0x68a8d00e, 0x2a6d2b79, 0x95548b5a},
+    {0x4b54b095, 0x8f4d2ef3, 0x52825a54, 0x6cab54a3},
+    {0x5ca6ced2, 0xb095b104, 0xad7ac286, 0x156ca55c},
+    {0xe199114b, 0xab60455d, 0x45a534da, 0xe5055643},
+    {0x0e6eed58, 0xa95f76a5, 0x5a094e94, 0x19eca9b9},
+    {0xb921114e, 0x95110530, 0x53fa50a5, 0xca319695},
+    {0x45ab5531, 0x2575d9af, 0x2c05b7a9, 0x5a955025},
+    {0x749cb6cd, 0x6c8a2648, 0xa16924ae, 0x64ca6fe9},
+    {0x96a34124, 0xc56ae965, 0xbf4e6d20, 0x9635904c},
+    {0x28d95d5b, 0x3554a55a, 0x812991af, 0xa9da5526},
+    {0xab0b454a, 0xcd271d2b, 0xdcd4de68, 0x5903abb1},
+    {0x4ce43a69, 0x20d8e1a8, 0x522691a5, 0x4b7c6894},
+    {0x331bc5cd, 0x5e8b0ca7, 0x97aa261d, 0x64850aae},
+    {0xacd45825, 0x526aeb2a, 0x4093d9e1, 0x36d1f2b1},
+    {0xab252769, 0xa4b495a9, 0x7e5c8a3a, 0xca3f2645},
+    {0x4955d556, 0xdb1724ae, 0x82c4b586, 0x31a059ba},
+    {0x5a555849, 0x2550d651, 0x5a2b46e9, 0x4e2f4651},
+    {0xc55a276b, 0x4ccd49ac, 0xa2ccd82d, 0x51a1b48e},
+    {0x35a2e949, 0x692b5aa7, 0xae321792, 0x565c4d68},
+    {0x8a9d14d6, 0xd5644250, 0x49e56875, 0x6a8ba557},
+    {0xb252d62a, 0x129b369b, 0xb216d58a, 0x917132a4},
+    {0x5ac853d2, 0x566159c6, 0x2d5814b5, 0xdd5a54b6},
+    {0x82574816, 0x64ad9258, 0xe4d3eacd, 0x228acd92},
+    {0xfd696f61, 0x99a4568b, 0x152e1a32, 0x946aaa65},
+    {0x0114905e, 0x462b6972, 0x74a2e1c6, 0xedaaa59e},
+    {0xdfb55761, 0xe8a94d2e, 0xcb5a4d29, 0x149aa520},
+    {0x504a908d, 0x17e66322, 0x8929aa98, 0x63423ae6},
+    {0xd7566dd6, 0xd41a98aa, 0x35263167, 0x9c7ac219},
+    {0x08a9ca31, 0x22d4d6b5, 0x52daca14, 0x52851ad5},
+    {0xea96132e, 0xbaa21284, 0xaa29afd6, 0x65a97564},
+    {0x4952fac8, 0x455df6f7, 0xaac41051, 0x952d8495},
+    {0x2d4d845b, 0x69490808, 0x12bbeb15, 0xb4e276a5},
+    {0xe3313ba2, 0x1d2cbbbb, 0xe68495d5, 0x2d1692b9},
+    {0x1954a2a9, 0x41b34244, 0x1a765455, 0xe1a8cd46},
+    {0x6aaf2cae, 0x7f265abb, 0x69d1a4a9, 0x0f553259},
+    {0x4a50eb21, 0x40d0d449, 0xa50d5d96, 0xf45285ab},
+    {0x94ab0996, 0x9d1713a4, 0x167a9131, 0x8196f448},
+    {0x734cb45a, 0x72f4d45b, 0xd583576a, 0x7e508bb5},
+    {0x8a6a66e2, 0x4b2556a0, 0x126c480d, 0x91b6ba2d},
+    {0x6aabc91a, 0x544d54be, 0x6d4ad5f1, 0xd2492565},
+    {0x64981ad4, 0xa2d14583, 0xa553324e, 0x165b5314},
+    {0x0ae76145, 0xba5d5a59, 0x99a8a692, 0xfb4a6cea},
+    {0xbb24ae33, 0x272222c9, 0x651b29b2, 0x00e1138a},
+    {0x4058a9ac, 0xc8eddd6d, 0x8a4a4d4b, 0x5e9ed835},
+    {0x5fcfaa21, 0x5b292512, 0x75e9d94c, 0xd524aae6},
+    {0xe03065de, 0x1095aae4, 0x84152633, 0x22d52b19},
+    {0x8fae9a11, 0x676a4a0e, 0x39da91a5, 0xdd2de952},
+    {0x305295cc, 0x9c4b1bf1, 0xc6636cdc, 0x92440a56},
+    {0xcda8b266, 0xa328e20a, 0xb31c9512, 0xb2ebb76a},
+    {0x24a7a530, 0xdadb39e9, 0x28c54965, 0xad2a494a},
+    {0xbb28a94f, 0x0424851a, 0xcf32b358, 0x4292e931},
+    {0x44564ea9, 0x77aafad3, 0x50ae4a0f, 0x396a154e},
+    {0xb7b568b4, 0x88ad0224, 0x53254df1, 0xcb49eb29},
+    {0x88408ac6, 0x5ab12dcd, 0xaed97016, 0xad3a095a},
+    {0x75bf5b34, 0x4246e931, 0x48490ee9, 0xa0c5e8c5},
+    {0x2a4128ab, 0xbada26a6, 0xab26b32a, 0x6f583732},
+    {0xa55aa6c4, 0x4a92d915, 0x2974cc49, 0x122784aa},
+    {0x2d5a553b, 0xd25696f9, 0xd58b11b6, 0xb5c87aaa},
+    {0x5145a490, 0xada25285, 0x2669b642, 0x4c6f4b49},
+    {0x4a352ddf, 0x14ad54b5, 0x492c46bd, 0xe3116937},
+    {0xada4e220, 0xe32ad6aa, 0x73a35949, 0x1d548a89},
+    {0x58ad2d6b, 0x195328aa, 0x8c3aa525, 0xd19676b4},
+    {0x4b42cb4c, 0x5b546b29, 0x65c9a9b6, 0x26aa89ab},
+    {0xe55d2893, 0x649594a4, 0x292c2649, 0x5a52d44d},
+    {0x1cc555b4, 0x966532d7, 0xcc5398d2, 0xc51aa750},
+    {0x633ae246, 0xc9a94a24, 0xb394671c, 0xb1e528ad},
+    {0x9a951d59, 0x36155bd9, 0x54b55263, 0x2e2d56a2},
+    {0x6ad353ae, 0xaaeb444d, 0x1a4a9594, 0xa2854c9a},
+    {0x1228c420, 0x2988b6d2, 0xe35ad52d, 0xd97965b3},
+    {0xd9573b57, 0xec6b1515, 0x2a4824a2, 0x0aa51348},
+    {0x272952c9, 0x4352b2e9, 0x5a67deac, 0x7495ac5b},
+    {0xa8d24634, 0x5b4c9616, 0x839a216b, 0x4aea65c2},
+    {0xca4fb6d7, 0xb45365d8, 0x7462dd2a, 0xaa09943a},
+    {0x57282888, 0x05b51443, 0xcd4ca1a5, 0x2df63356},
+    {0x10d5cb37, 0xf292ebba, 0x12b2965a, 0xc001ccc8},
+    {0xea8a34a8, 0x0c6618a5, 0xd48aa8a5, 0x3fbe212b},
+    {0x153aca92, 0x6b94e712, 0x2bb6b74a, 0xc481bda4},
+    {0x56c292f6, 0x58bb28ed, 0xc85490ad, 0x92ee4a1a},
+    {0xd4596684, 0x4705a709, 0xa7935731, 0xba1164e2},
+    {0x25a6985b, 0x98f438ea, 0xb45d494e, 0xa5ad1b3c},
+    {0xda54a7a2, 0xb516c726, 0x892234a8, 0x4cd16483},
+    {0x1156b42c, 0x45d13155, 0x6dd5a54b, 0xd12ecaba},
+    {0xef4946c9, 0xa61d8e92, 0x940caad4, 0x37a13564},
+    {0x08b5395a, 0xb9e070d6, 0xb372cd55, 0x802ca90b},
+    {0xf64ac54a, 0x420f4ba9, 0x25969512, 0xfdb722e8},
+    {0x22b29925, 0xdf312c15, 0xd848b1da, 0x24915e0d},
+    {0x9a9d6d5a, 0x50ed32e8, 0x175a2626, 0x8ab491b2},
+    {0x72c144a5, 0x9686d70b, 0x7093d4b2, 0x7646d4ab},
+    {0x053d35a9, 0xd239116d, 0x8d6c4ad4, 0x89b52692},
+    {0x7b45a4a6, 0x6dc4ed52, 0x63253295, 0x52a558ec},
+    {0xc96a5535, 0x14b64a9a, 0x5aa6d552, 0x9a5b5315},
+    {0x2915ad89, 0xd5092952, 0x90b80a4d, 0x5590aa63},
+    {0x4b5654da, 0x24f3ad55, 0xb74bdab2, 0x652d955c},
+    {0x64a94623, 0x759c5253, 0x94552925, 0x59622942},
+    {0x353569b5, 0x8a4312d5, 0xa5a4a6ea, 0x4b1deb3c},
+    {0x4b4535b4, 0x695add15, 0x3499a913, 0xa8c30ca3},
+    {0xeaaa8a05, 0xab5520ea, 0x4b672b6c, 0x2f3c69ad},
+    {0x14a8f2fa, 0x44896f2d, 0xa888464a, 0xb0a35650},
+    {0xa6960c8a, 0xb57244c1, 0xd7b6f8d3, 0x972a92a6},
+    {0x52d3b350, 0x248f695e, 0x88220324, 0xc8aaa91a},
+    {0xda54654f, 0xdb50ad21, 0xb6edbd36, 0x32a62de2},
+    {0x1554ad68, 0x915d25b6, 0xa508c1c8, 0xdd29d22c},
+    {0x694b1045, 0x6d22d24b, 0x54ab1e5b, 0x01755755},
+    {0xaa2af79d, 0x24da9cc8, 0x1564b145, 0xde82104b},
+    {0x56f20464, 0xb292a375, 0x7559aab8, 0x225d6ed9},
+    {0xa98b754b, 0x9555550a, 0x424a564f, 0xedd99225},
+    {0xa66c95aa, 0xad6c54b5, 0x5da5a4d0, 0x080259f5},
+    {0x29126551, 0x2083adb4, 0x3432ab15, 0xf3b64a05},
+    {0xd5d68a2e, 0xdeb8510a, 0xc3da5976, 0x0cd975ba},
+    {0xa449b9d1, 0x928b5566, 0xbc92a684, 0x7225844a},
+    {0x5b6a4a1d, 0x526d46a9, 0x82b2a4ad, 0x956a3690},
+    {0x9296d2e2, 0x2da1b82a, 0x764eb6b1, 0x498acaef},
+    {0x6c64ad2e, 0xcc1e4be9, 0x15d0a926, 0xad2928a0},
+    {0x25ab35a1, 0xb3f0ac05, 0xe11d2b74, 0x52b7361d},
+    {0x5692c85d, 0x240ba5bb, 0x9e66e48b, 0x4ca4c9b2},
+    {0x59269715, 0xdbd43544, 0x21a91cb2, 0xb5a65acd},
+    {0xc97869e2, 0x88358954, 0x6d25a3da, 0x2619822a},
+    {0x9b45942a, 0x77887557, 0x98965c06, 0xa9f276d2},
+    {0x642d659d, 0xd06f8308, 0xa6d8c9ea, 0x4c8d26a5},
+    {0x55d2a952, 0x0f206cf5, 0x32453519, 0x62aad85e},
+    {0x8a14572a, 0xf4dd9a85, 0x89334652, 0xdd314ba1},
+    {0x72d7a8d5, 0x0542516c, 0xedaa71cd, 0x08ad292a},
+    {0xaa501515, 0x7a359732, 0x154a8c31, 0xb3a5a6cd},
+    {0x17aff6a9, 0xa58a548b, 0xd14d554e, 0x54255930},
+    {0xa0541176, 0x4d755158, 0xa652b36a, 0x86dc869b},
+    {0xee4bac89, 0xa4458faa, 0x3aba5912, 0x78c17462},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(16)
+  {  // level 16: redness 128
+    {0x09b455b5, 0xba947027, 0x894b46da, 0x06370b9e},
+    {0xf557b24a, 0x276b97e8, 0xed995485, 0xe9a97451},
+    {0xa9524eaa, 0x68a8d40e, 0x2a6dab7b, 0x95548b5a},
+    {0x4b54b0b5, 0x8f4d2ef3, 0x52825a54, 0x6cab75a3},
+    {0x5ca6ced2, 0xb0b7b144, 0xad7aca86, 0x156ca55c},
+    {0xe199314b, 0xab60455d, 0x65a534fa, 0xe5055643},
+    {0x0e6eed59, 0xad5f76a5, 0x5a0b4e94, 0x19eca9b9},
+    {0xb921154e, 0xb5111530, 0x53fa50a5, 0xca359695},
+    {0x45eb5531, 0x25f5d9af, 0x2c25b7a9, 0x5b95502d},
+    {0x749cb6ed, 0x6c8a2649, 0xa16924bf, 0x64ca6fe9},
+    {0x96a34124, 0xc56aeb65, 0xbf4e6d20, 0x9635924c},
+    {0x28d97d5b, 0x3554a55a, 0x812991af, 0xa9da5536},
+    {0xeb2b454a, 0xdd271d2b, 0xdcd4de68, 0x5923abb1},
+    {0x4ce43a69, 0x20d8f1a8, 0x526691a5, 0x4b7c6896},
+    {0x331bc7cd, 0x5e8b0cb7, 0x97aa261f, 0x64850eae},
+    {0xacd45835, 0x536aeb2a, 0x5093f9e1, 0x36d1f2b1},
+    {0xab252769, 0xa4b495a9, 0x7e5c8a3a, 0xca3f2645},
+    {0x49d5d556, 0xdb1734ae, 0x82e4b586, 0x31a059be},
+    {0x5a555949, 0x2570d651, 0x5b2b46e9, 0x4eaf4651},
+    {0xd55a277b, 0x4ccd49ac, 0xb2ccd82d, 0x51a1b58e},
+    {0x35a2e949, 0x6b2b5aaf, 0xae331792, 0x565c4d68},
+    {0x8a9d14d6, 0xd564ca50, 0x49e56875, 0x6a8ba557},
+    {0xb272d62a, 0x129b369b, 0xb216d78a, 0x95733aa4},
+    {0x5eca5bd2, 0xd66559e6, 0xad5814b5, 0xdd5a54b6},
+    {0x8257481e, 0x65ad9258, 0xe5d3eacd, 0x238acd92},
+    {0xfd696fe1, 0x99a4568b, 0x152e1a32, 0x946aaa65},
+    {0x0115905e, 0x562b6972, 0x74a2e5d6, 0xedaaa59e},
+    {0xdfb55f61, 0xe8a94d2e, 0xcb5a4d2b, 0x149aad30},
+    {0x504a908d, 0x17e66ba2, 0x9929aa98, 0x6342bae7},
+    {0xd7566dd6, 0xd41a98aa, 0x35a631e7, 0x9d7ac319},
+    {0x28a9ca31, 0xa2d5d6bd, 0x52daca14, 0x52951ad5},
+    {0xeeb613af, 0xbea21284, 0xaa29afd6, 0x6da97564},
+    {0x4952fac8, 0x455df6f7, 0xaacc1075, 0x952d849d},
+    {0x2d4d845b, 0x69490888, 0x1abbeb15, 0xb4f276a5},
+    {0xe3333baa, 0x5d2cfbbb, 0xe68495d5, 0x2d1692b9},
+    {0x1954a2a9, 0x41b34244, 0x1a765455, 0xe1aacd46},
+    {0xeaaf2cae, 0x7f265bbb, 0x69d1a5a9, 0x1f553a59},
+    {0x4b50eb31, 0x40d8d449, 0xa50d5d96, 0xf45285ab},
+    {0x94ab8996, 0x9d1713a4, 0x367a9133, 0x81d6f44a},
+    {0x734cb65a, 0x72f4d45f, 0xd583776a, 0x7e548bb5},
+    {0x8a6a66e2, 0x4b2557a0, 0x127c4c0d, 0x95b6baad},
+    {0x6aabc91b, 0x5d4d54be, 0x6d4ad5f1, 0xd2492565},
+    {0x6c981ed4, 0xa2d35583, 0xa553324e, 0x165b5315},
+    {0x0ae7614d, 0xba5d5a5d, 0x99aca692, 0xfb4aecea},
+    {0xbb25aeb3, 0x272222c9, 0x655b69b2, 0x00f1138a},
+    {0x4058a9ac, 0xc8eddd6d, 0x9a4a4d5b, 0x5e9eda35},
+    {0x5fcfaa23, 0x5f292513, 0x75e9d94c, 0xd524aae6},
+    {0xe03065de, 0x5095aaf4, 0x86152633, 0x22d52b19},
+    {0x9faeda31, 0x676a6a0e, 0x79dab1a5, 0xdd2de952},
+    {0x305295cc, 0x9c4b1bf1, 0xc6636edc, 0x93542a56},
+    {0xcdacb266, 0xa3aae20e, 0xb31c9512, 0xb2ebb76a},
+    {0x24a7ad30, 0xdadb3de9, 0x28e56967, 0xad2a494a},
+    {0xbba8a9cf, 0x2424851a, 0xcf32b358, 0x4692ed31},
+    {0x44564ea9, 0x77aafad3, 0x58ae4a0f, 0x396e154e},
+    {0xb7b768b4, 0x88ad2234, 0x53254df1, 0xcb49eb69},
+    {0x88408ac6, 0x7ab12dcd, 0xaed97116, 0xad3a0d5a},
+    {0x77bf5b34, 0x464ee935, 0x48cb0ee9, 0xa0c7e8c5},
+    {0x2a4168ab, 0xbada26a6, 0xab26b32e, 0x6f58373a},
+    {0xa55aa6c4, 0x4a92d915, 0xa974ccc9, 0x923784aa},
+    {0x2d5a553b, 0xd25696f9, 0xd58b31b6, 0xb5c87aaa},
+    {0x7145b490, 0xadb25285, 0x3669b642, 0x4c6f4b49},
+    {0x4b352ddf, 0x14ad54b5, 0x492c46bd, 0xe3116977},
+    {0xada4e224, 0xe72ad6aa, 0x73a35949, 0x1d758a89},
+    {0x58bd2d6b, 0x195329aa, 0x8c3aa565, 0xd19676b4},
+    {0x4b42cb4c, 0x5b546b2b, 0x75c9adb6, 0x26aa89ab},
+    {0xe55d28b3, 0x649594b4, 0x2b2c664b, 0x5a52d44d},
+    {0x1cc55db4, 0x96ed76d7, 0xcc7398d2, 0xcd5ab770},
+    {0x633ae246, 0xc9a94a24, 0xb396671c, 0xb1e528af},
+    {0x9a951d59, 0x36155bd9, 0x54b55a63, 0x2e2d56a2},
+    {0xead353ae, 0xaaeb444d, 0x9a4a95d5, 0xa2854c9a},
+    {0x16acc460, 0x2988b6d2, 0xe3dbd52d, 0xdb7d75b3},
+    {0xd9573b5f, 0xec6b5515, 0x2a4824a2, 0x0aa5134c},
+    {0x272952c9, 0x435ab2e9, 0x5a67deac, 0xf495ac5b},
+    {0xa8d25634, 0x5b4c9616, 0x939a216b, 0x4aea67c2},
+    {0xdacfb6d7, 0xb45365d8, 0x746add2a, 0xab09943a},
+    {0x57282888, 0x0db51447, 0xcf4ca5a5, 0x2dfe7356},
+    {0x14f5cbb7, 0xf29aebba, 0x12b2965a, 0xe001cec9},
+    {0xea8a34aa, 0x0c6618a5, 0xd48aa8a5, 0x3fbe213b},
+    {0x553aca92, 0xeb94e732, 0x2bb6b76a, 0xc491bda4},
+    {0x56c69af6, 0x58bb28ed, 0xd85490ad, 0x92ee4a9a},
+    {0xd4596684, 0x4745a709, 0xa7937731, 0xbb1164e2},
+    {0x27a698db, 0x98f4b8ea, 0xb45d494e, 0xa5af1b3c},
+    {0xda54a7b2, 0xb516c736, 0x8b62b6a8, 0x4cd16583},
+    {0x1156b42c, 0x55d13955, 0x6dd5a55b, 0xd12ecaba},
+    {0xef4946cb, 0xa61f8e92, 0x940caad4, 0x3fa13564},
+    {0x08b5395a, 0xb9e070d6, 0xb372cd55, 0x802cad1b},
+    {0xf74ac74a, 0x424f4ba9, 0x25969512, 0xfdb7a2ea},
+    {0x22b29965, 0xdf31ac57, 0xda69b1da, 0x25915e4d},
+    {0x9a9d6d5a, 0x50ed32e8, 0x175a2e26, 0x8abc91b2},
+    {0x7ac144ad, 0x9686d70b, 0x7093d5b2, 0x7646d4ab},
+    {0x053d3da9, 0xd279116d, 0x8d6c4ad4, 0xa9b52693},
+    {0x7b45a4a6, 0x6dc5ed52, 0x6325b297, 0x56a55aec},
+    {0xc96a5535, 0x14b64a9b, 0x5ea6d552, 0x9a5b5315},
+    {0x2d55ada9, 0xd5092952, 0x90b84acd, 0x55d4aa63},
+    {0x5b5654da, 0x26f3af5d, 0xb74bdab2, 0x652db5dc},
+    {0x64a95627, 0x759c5253, 0x9455292d, 0x59622942},
+    {0x353569b5, 0x8a4352d5, 0xe7b4a6ea, 0x4b5deb3c},
+    {0x4b4535b4, 0x695adf15, 0x3499b913, 0xa8c30ca3},
+    {0xeaba8a05, 0xab7520ea, 0x4b672b6c, 0xaf3c69ad},
+    {0x14a9f6fa, 0x4c8b6f2d, 0xa898464a, 0xb0a35654},
+    {0xb6960c8a, 0xb57254d1, 0xd7b7f8db, 0x976ad6e6},
+    {0x52d3b352, 0x248f695e, 0x98220724, 0xcaaaa91a},
+    {0xda54655f, 0xdb50ad21, 0xb6edbd37, 0x32a62de2},
+    {0x1555ad68, 0x915d25b6, 0xa598c1c8, 0xdd29d22c},
+    {0x69cb1245, 0x6d22d24b, 0xd4ab5e5b, 0x217d5755},
+    {0xaa2af79d, 0x26de9ccc, 0x1564b145, 0xde82914b},
+    {0x56f20464, 0xb292b375, 0x755dabb8, 0x225d6ed9},
+    {0xa98bf55b, 0x9555550a, 0x434a564f, 0xedf99225},
+    {0xa66c95aa, 0xed6c54b5, 0x5da5a4d0, 0x0a025bf5},
+    {0x2d327551, 0x2287adb5, 0x3432ab15, 0xf3b74a05},
+    {0xd5d68a2e, 0xdef8510a, 0xc3de5976, 0x0cd975fa},
+    {0xa449bbd1, 0x928b5d76, 0xbc92a6a4, 0x7225844a},
+    {0x5b6a4a1d, 0xd26d47a9, 0x82b2a4ad, 0x976a7692},
+    {0x9296d2e2, 0x2da1b82a, 0x764eb6b1, 0x69aacaef},
+    {0x6c64ad2e, 0xcc9e4bed, 0x15d1a926, 0xad2929a0},
+    {0x25ab35a1, 0xb3f0ac25, 0xe91d2b74, 0x52b7361d},
+    {0xd69ac8dd, 0x240ba5bb, 0x9e66e48b, 0x4ca4c9b2},
+    {0x59269715, 0xdbd53544, 0x21a91cb2, 0xb5a65acd},
+    {0xc97969e2, 0x88358954, 0xed35a3da, 0xa619922a},
+    {0x9b45962a, 0x77c87d77, 0x99965c26, 0xa9f376d2},
+    {0x64ad65dd, 0xd06f8308, 0xa6d9c9ea, 0x5c8d26a5},
+    {0x5dd2a952, 0x0f216cf7, 0x3a4d3519, 0x62aad85e},
+    {0x8a34572a, 0xf4dd9a85, 0x89334e56, 0xdd354bb1},
+    {0x72d7e8d5, 0x054a516c, 0xedaa71cd, 0x0aad392a},
+    {0xaa501595, 0x7a759733, 0x156a8d31, 0xb3a5a6cd},
+    {0x17aff6a9, 0xa58a74cb, 0xd54d554e, 0x54255934},
+    {0xb0541176, 0xcd755158, 0xa652b36a, 0xa6dca69b},
+    {0xef4bae89, 0xa5558faa, 0x3aba5932, 0x7ac974e2},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(17)
+  {  // level 17: redness 136
+    {0x09b455b5, 0xba967027, 0x894b56da, 0x06370b9e},
+    {0xf557b26a, 0x276b97f8, 0xed995485, 0xf9a9f451},
+    {0xad524eaa, 0x68a8d40e, 0x2aedab7b, 0x95548b5e},
+    {0x4b5db2b5, 0xcf4d2ef3, 0x528a5a54, 0xedab75a3},
+    {0x5ca6ceda, 0xb0b7b144, 0xad7acb86, 0x156dad5c},
+    {0xe399314b, 0xab604d5d, 0x65a574fa, 0xe5255667},
+    {0x2e6eed59, 0xad5ff6e7, 0x5a0b4e96, 0x3deca9b9},
+    {0xb92915ce, 0xb5111530, 0x53fa50a5, 0xca35b795},
+    {0x45ebd531, 0x25f5d9af, 0xae25b7a9, 0x5b95502d},
+    {0x749cb6ef, 0x7c8e2659, 0xa169a4bf, 0x64ea6fe9},
+    {0x96a34524, 0xc56aeb65, 0xbf6e6f20, 0xb635924c},
+    {0x2add7ddb, 0x3554a55a, 0xa12991af, 0xa9da7536},
+    {0xeb2b454a, 0xdf279d2b, 0xded4de68, 0x5d23abb1},
+    {0x4ce43a6b, 0xa0f8f3a8, 0x526ed1a5, 0x4b7c6896},
+    {0x731bc7cd, 0x5e8b0cb7, 0xd7aa271f, 0x64870eee},
+    {0xacd57835, 0x536aeb2a, 0x5093f9e1, 0x36d1f2b1},
+    {0xab2d2769, 0xa4b495a9, 0x7f5c8a3a, 0xcb3f2645},
+    {0x49d5d556, 0xdb9734af, 0x82e4b596, 0x31a059be},
+    {0x5a555949, 0x3572d751, 0x5b2b66e9, 0xdeaf6651},
+    {0xd55a277b, 0x4ccd49ac, 0xb2ccd8af, 0x51b1b5af},
+    {0x35a3f949, 0x6b2b5aaf, 0xae3b1792, 0x565c4d68},
+    {0xca9d15d7, 0xd574ca50, 0x49e56875, 0x6acba557},
+    {0xb272d62a, 0x1a9b369b, 0xb316d78a, 0x95733aa4},
+    {0x5eca5bd2, 0xd66559e6, 0xad5914b5, 0xdd5a55be},
+    {0x8357481e, 0x65add65c, 0xe5d3ebcd, 0x638acd92},
+    {0xfd696fe1, 0x99a4568b, 0x152e1a32, 0x946aba65},
+    {0x2115905e, 0x573b69f2, 0x74e2e5d6, 0xefaaa59f},
+    {0xdff55f61, 0xe8ab4d2e, 0xcb5a4d2b, 0x14baad30},
+    {0x504a929d, 0x17e66ba2, 0x992baab8, 0x7346bae7},
+    {0xd7566dd6, 0xdc1a98ab, 0x35a639e7, 0x9d7ac319},
+    {0x29a9da31, 0xa2d5d6bd, 0x56daca14, 0x52955ad7},
+    {0xeeb613af, 0xbeb21284, 0xaa2bafd6, 0x6da97564},
+    {0x4952fac8, 0x455df6f7, 0xaacc3075, 0x952d8d9d},
+    {0x2d4d845b, 0x694b0889, 0x5afbef15, 0xb5f276a5},
+    {0xeb733faa, 0x5d6cfbbb, 0xe68495d5, 0x2d1692b9},
+    {0x1954e2a9, 0x41b34a44, 0x1a767457, 0xe1aacd46},
+    {0xeaaf2cae, 0x7f265bbb, 0x6dd5a5a9, 0x1f557ad9},
+    {0x4b50eb71, 0x42d9d459, 0xa50d5db6, 0xf45a85ab},
+    {0x94bb9996, 0x9d1733a4, 0x36fa9133, 0x81d6f44a},
+    {0x7b4cb65a, 0x72f4d45f, 0xd583776a, 0x7e548bb5},
+    {0x8a6a66e2, 0x4b2557a1, 0x327d4c8d, 0x95b6faad},
+    {0x6babc91b, 0x5d5d54be, 0x6d4ad5f1, 0xd2c92565},
+    {0x6c983ef4, 0xa2d355a3, 0xa553324e, 0x165b5b15},
+    {0x4ae7614d, 0xba5d5a5d, 0x9dacae9a, 0xfb4aecfa},
+    {0xbb35aeb3, 0xa72262c9, 0x655b69b2, 0x00f1138a},
+    {0x4458a9ac, 0xc8eddd6d, 0x9a4a4d5b, 0x7e9eda35},
+    {0x5fcfae23, 0x5f2d2593, 0x75edd94c, 0xd565aae6},
+    {0xe03065de, 0x50d5aaf4, 0x861526b3, 0x22d52b1d},
+    {0x9faeda31, 0x676a6a0e, 0x79dab1a7, 0xdd2de9d2},
+    {0x325295cc, 0x9c4b1bf1, 0xc6636edc, 0x93542a56},
+    {0xcdacb26f, 0xb3aae22e, 0xbb1c9532, 0xb2ebb76a},
+    {0x64b7ad30, 0xdadb3de9, 0x28e56967, 0xad2a494a},
+    {0xbba8a9cf, 0x2464851a, 0xcfb2b758, 0x66d2ed73},
+    {0x44564ea9, 0x77aafad3, 0x58aeca4f, 0x396e954e},
+    {0xb7b76ab5, 0x88ad2634, 0x53254df1, 0xcb49eb69},
+    {0x8850aac6, 0x7bb1adcd, 0xaed97116, 0xad3a0d5a},
+    {0x77bf5b34, 0x464ee935, 0x68db4ee9, 0xa8c7e8c5},
+    {0xaa456abb, 0xbada26e6, 0xaf26b32e, 0x6f5837ba},
+    {0xa55aa6c4, 0x4ad2d915, 0xa974ccc9, 0x9237c4aa},
+    {0x2d5a553b, 0xd256d6f9, 0xd58b35b6, 0xb5c87aaa},
+    {0x7565b590, 0xadb25687, 0x3669b652, 0x4d6f4b49},
+    {0x4b352ddf, 0x34ad54b5, 0x49ae46bd, 0xe3116977},
+    {0xada6e224, 0xe76ad6aa, 0x77a37949, 0x1d759a89},
+    {0x58bd3d6b, 0x195329aa, 0x8c3aa565, 0xd99676b6},
+    {0x4b42cb4c, 0xdb566b2b, 0x75cbadb6, 0x66aa8bab},
+    {0xf57d28b3, 0x649594b4, 0x2b2c664b, 0x5a56d44d},
+    {0x9cc55fb4, 0xb6ed76d7, 0xcc7398f2, 0xcd5ab770},
+    {0x633ae247, 0xc9a94a24, 0xb396671c, 0xb1e529af},
+    {0x9a951d59, 0x36155bd9, 0x56b55a63, 0x2e2dd6aa},
+    {0xead373ae, 0xaafb546d, 0x9a4a95d5, 0xa2c54c9a},
+    {0x16accc60, 0x2b8ab6d2, 0xebdbf53d, 0xfb7d75b3},
+    {0xf9573b5f, 0xec6b551d, 0x2a5824a2, 0x0aa5134c},
+    {0x273952c9, 0x535ab2e9, 0xda67dfad, 0xf495ec7b},
+    {0xa8d25634, 0x5b4c9656, 0x939a216b, 0x4afa67c2},
+    {0xdacfb6d7, 0xb45375d8, 0x746add2a, 0xab09943a},
+    {0xd728a8a8, 0x4db51447, 0xcf4da5b5, 0x2dfe7b56},
+    {0x14f5cfb7, 0xf39aebba, 0x32b2b65a, 0xe041cec9},
+    {0xea8a34aa, 0x0c6698a5, 0xd4aaa9a5, 0x3fbe213b},
+    {0x55baca92, 0xeb94e736, 0x2fb6b76a, 0xc491bda4},
+    {0x56c6bafe, 0x58bb2ced, 0xd85494ad, 0x9aeeca9e},
+    {0xd4596684, 0x6745a709, 0xa7d37771, 0xbb3164e2},
+    {0x27a698db, 0x9af4b8ea, 0xb45d494e, 0xa5af1b3c},
+    {0xda54a7b2, 0xb516c736, 0x8b62b6a9, 0x6cd17583},
+    {0x5176bc2c, 0x55d13955, 0x6ddda55b, 0xd12ecabe},
+    {0xef49c6cb, 0xa61fce92, 0xd44caad4, 0x3fe53564},
+    {0x08b5397a, 0xbdf070de, 0xb772dd57, 0x822cad1b},
+    {0xff4ee74a, 0x424f4fa9, 0x25969532, 0xfdb7a2ea},
+    {0x22b29965, 0xdf31ac57, 0xda69b1da, 0x25915e4d},
+    {0x9a9d6d5a, 0x50ed32e8, 0x575a2e27, 0xaabc93b2},
+    {0xfae344ad, 0x9e86d71b, 0x7193d5ba, 0x7646f4bb},
+    {0x053d3da9, 0xd279196d, 0x9d6c4ad4, 0xa9b52693},
+    {0x7b45e5a6, 0x6dc5ed52, 0x6335ba97, 0x56a55aec},
+    {0xc96a5535, 0x14be4adb, 0x5ea6d572, 0xda5b5315},
+    {0x2d55ada9, 0xd5096952, 0x90b84acd, 0x55d4ae6b},
+    {0x5b5654da, 0xa6f3af5d, 0xb7cbdab2, 0x652db5dc},
+    {0x64a95727, 0x759c5253, 0x94552b2d, 0x5d622942},
+    {0x35b769b5, 0x8a6352d5, 0xe7b6a6ea, 0x4b5deb3e},
+    {0x4b4535b4, 0x6d5adf15, 0x3499b913, 0xa8c32da3},
+    {0xeaba8a45, 0xab7520ea, 0x5b672b6c, 0xaf3c69ad},
+    {0x14a9f6fa, 0xcc8b6f2d, 0xa89846ca, 0xb0ab5654},
+    {0xb6d60c8a, 0xb57254d1, 0xd7b7f8db, 0xb76ad6e6},
+    {0x52d3b352, 0x24cf695e, 0x99222724, 0xcaaaa91a},
+    {0xda5c6d5f, 0xdf51ad21, 0xb6edbd37, 0x32a62dea},
+    {0x1755ad68, 0x915d37b6, 0xa59ac1c8, 0xdd29d22c},
+    {0xe9cb1267, 0x6d62d25b, 0xd4ab5e7b, 0x21fd5f55},
+    {0xaa2af79d, 0x26de9ccc, 0x1d64b147, 0xde82916b},
+    {0x56fa0c64, 0xba92b375, 0x755dabb8, 0x225d6ed9},
+    {0xa98bf55b, 0x9555550a, 0x434a564f, 0xedf9d225},
+    {0xb66c95aa, 0xed6cd6f5, 0xddb5b4d4, 0x1a065bfd},
+    {0x2d337551, 0x2287adb5, 0x3432ab95, 0xf3b74a05},
+    {0xd5d68a6f, 0xdef8510a, 0xc7ded976, 0x0cd975fa},
+    {0xa449bbd1, 0x928b5d76, 0xbc92aea4, 0x72258c4a},
+    {0x5b7a4a1d, 0xda6d47a9, 0x92b2a4ad, 0x976e769a},
+    {0xd396d2e2, 0x2da1b82a, 0x764eb7b5, 0x69aacaef},
+    {0x6c64ad3e, 0xcc9e6bed, 0x15d1a926, 0xad2929a1},
+    {0x25ab35a1, 0xb3f4ac25, 0xe95d2b74, 0x52b7b65d},
+    {0xd6dac8dd, 0x240ba5bb, 0x9e66e68b, 0x4da4cdb2},
+    {0x5926b715, 0xdff5374c, 0x23a93cb2, 0xb5b65acd},
+    {0xcb7969ea, 0x8835c954, 0xed35a3da, 0xa619922a},
+    {0x9b45962a, 0x77c87d77, 0x99965c26, 0xa9f376da},
+    {0x64ad6ddd, 0xd06f8308, 0xa6d9cbea, 0x5c8d26a5},
+    {0x5dd6a953, 0x2f216cf7, 0x7acd3519, 0x63aad95e},
+    {0x8a34572a, 0xf5dd9e95, 0x89334e76, 0xdd354bb1},
+    {0x73d7e8dd, 0x054a516c, 0xedaa71cd, 0x2aad392a},
+    {0xaa501595, 0x7a75d733, 0x156a8d31, 0xb3b5a6cd},
+    {0x57aff6a9, 0xa58a74cb, 0xd54dd54e, 0x54a55974},
+    {0xb0741176, 0xdd75555c, 0xa6d2b36a, 0xa6dda69b},
+    {0xef4bee8b, 0xa5558faa, 0x7aba5932, 0x7ac974e2},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(18)
+  {  // level 18: redness 144
+    {0x09b455b5, 0xbad67027, 0x8b4bd6de, 0x06b70b9e},
+    {0xf557b26e, 0xa76b97f8, 0xedb954c5, 0xf9adf471},
+    {0xad524eaa, 0x68b8d50e, 0x2aedab7b, 0x95548b5e},
+    {0xcb5db2b5, 0xcf4d6ef3, 0xda8b5a54, 0xedab75a3},
+    {0x5ce6ceda, 0xb4b7b14c, 0xad7acb96, 0x156dad5c},
+    {0xe399354b, 0xab684d5d, 0x65a574fa, 0xe5255667},
+    {0x2e6eed79, 0xaddff6e7, 0x5a4b4e96, 0x3deea9b9},
+    {0xb92915ce, 0xb5111530, 0x53fe58b5, 0xca35b795},
+    {0x47ebd531, 0x25f5d9af, 0xbe25b7a9, 0x5b95586d},
+    {0x749cb6ef, 0x7e8e2659, 0xa169a4bf, 0x64eb6fe9},
+    {0xd6a34524, 0xc57afb65, 0xbf6e6f62, 0xb735924e},
+    {0x2add7ddb, 0x3554a55a, 0xa12b91af, 0xa9da7576},
+    {0xeb2bc55a, 0xdf279d6f, 0xded4de68, 0x5d23afb1},
+    {0x4ce43a6b, 0xa0f8f3a8, 0x526ed1b5, 0x4b7ce896},
+    {0x735bc7cd, 0x5e8f0cb7, 0xdfaa2f1f, 0x74970eee},
+    {0xacd57835, 0x5b6aeb6a, 0x50b3f9e1, 0x36d1f2b5},
+    {0xab2d27ed, 0xa4b4d5a9, 0x7f5c8a3a, 0xcb3f2ec5},
+    {0x6dd5dd56, 0xdb9734af, 0x82e6b596, 0x31a0d9be},
+    {0x5a555949, 0xb572d771, 0x7b2b66e9, 0xdeaf6651},
+    {0xd55e277b, 0x4ccd49ae, 0xb2ccdcaf, 0x55b3b5af},
+    {0x35e3f949, 0x6b2b7aaf, 0xae3b5792, 0x565c5d68},
+    {0xce9d15df, 0xd5f4cad0, 0x59e56875, 0x6acba557},
+    {0xb272d62a, 0x1a9b369b, 0xb336d79b, 0x95737aa4},
+    {0x7eca5bf2, 0xd66559e6, 0xad5934b5, 0xdd5a55be},
+    {0x835f691e, 0x75bdd65c, 0xedd3ebcd, 0x73aecd92},
+    {0xfd696fe1, 0x99a4568b, 0x152e1a32, 0x946aba65},
+    {0x2115905e, 0x573b69f2, 0x74eae5d6, 0xefaaa5df},
+    {0xdff55f65, 0xe8ab4d2e, 0xcf5a6d2b, 0x14baad30},
+    {0x545ad29d, 0x57e66bb2, 0x992baab8, 0xf346baef},
+    {0xd7566dd6, 0xdc9ad8ab, 0x75a6bbe7, 0x9d7acb19},
+    {0x29a9da31, 0xa2d5d6bd, 0x56faca14, 0x52d55ad7},
+    {0xeeb693af, 0xbeb21684, 0xab2bafd6, 0x6dab7564},
+    {0x695afae8, 0x455df6f7, 0xaacc3075, 0x952d8dbd},
+    {0x2d4d845b, 0x7b4b08a9, 0x5afbef55, 0xf5f276a5},
+    {0xeb733faa, 0x5d6cfbbb, 0xe68495d5, 0x2d16b2b9},
+    {0x1954e2ab, 0x41b34a44, 0x1a777457, 0xe1eacd4e},
+    {0xeaaf2cae, 0x7f2e5bbb, 0xedd5a7a9, 0x1f557ad9},
+    {0x5b52eb71, 0x62d9d45b, 0xa52d5db6, 0xf45a85ab},
+    {0x95bb9996, 0x9d5737e4, 0x36fa9133, 0x83d6fc6a},
+    {0x7b4cb65a, 0x72f4d45f, 0xd583776e, 0xfe548bb5},
+    {0x8a6a67e6, 0xcb2557a1, 0x367d4c8d, 0x95b7faad},
+    {0x6babc91b, 0x5d5dd4be, 0x6d4ad5f1, 0xd2c9256d},
+    {0x6c9a3ef4, 0xaad355a3, 0xa573324e, 0x565b5b15},
+    {0x4ae7614d, 0xbadd5e5d, 0x9dadaeda, 0xfb4eecfa},
+    {0xbbb5aeb7, 0xa72262c9, 0xe55b69b2, 0x02f1138a},
+    {0x5458a9ac, 0xd8eddd6d, 0x9b4a4f5b, 0x7e9efa75},
+    {0x5fcfae63, 0x5f2d2d97, 0x75edd94c, 0xd565aae6},
+    {0xe0b065de, 0x52d5aaf4, 0x8e152eb3, 0x22d52b1d},
+    {0x9fafda31, 0x676aea0e, 0x79dab1a7, 0xdd2dedd2},
+    {0xb25297cc, 0x9c5b1bf1, 0xc6e36edc, 0x9b552a56},
+    {0xcdacb26f, 0xb3aae62e, 0xbb1e9532, 0xb2ebb77a},
+    {0x66b7ad30, 0xdadb7de9, 0x68e56967, 0xad2a494a},
+    {0xbba8b9cf, 0x2664851a, 0xcfbab758, 0x66daed73},
+    {0x5456cea9, 0x77aefad7, 0x58aeca4f, 0x396e954e},
+    {0xb7b76abd, 0x88ad26b4, 0x53255df1, 0xcb49eb69},
+    {0x88d0aac6, 0x7bb1adcd, 0xaed97117, 0xaf3a1d5b},
+    {0x77bf5b34, 0x464ee935, 0x68db4ee9, 0xa8d7e8c5},
+    {0xaa456abb, 0xbada2ee6, 0xaf26b33e, 0xefd837ba},
+    {0xb5dab6c4, 0x6ad2d915, 0xa974ccc9, 0x9237c4aa},
+    {0x2d5b557f, 0xd65ed6f9, 0xd58bb5b6, 0xb5c87aae},
+    {0x7565b590, 0xadb35687, 0x7679b652, 0x5d6f4f49},
+    {0x4b352ddf, 0x34ad54fd, 0x49ae47bf, 0xe3556977},
+    {0xeda6e224, 0xe76ad6aa, 0x77a37949, 0x1d759aa9},
+    {0x5abd3dfb, 0x195339aa, 0x8c3aa56d, 0xd99676b6},
+    {0x4b42cb4e, 0xdb766b2b, 0x75cbadb6, 0x66eacbab},
+    {0xf57da8b3, 0x649595b4, 0x6bac764b, 0x5a56d44d},
+    {0x9cc55fb4, 0xbeed76d7, 0xcc7399f2, 0xcd5ab770},
+    {0x673ae257, 0xc9ab4a24, 0xb396e71c, 0xb5e529af},
+    {0x9ad71d59, 0x36955bdb, 0x56f55a67, 0x2e3dd6aa},
+    {0xead373af, 0xeafb546d, 0x9a4a95d5, 0xa2c54cda},
+    {0x16accc60, 0x2b8ab7d2, 0xebdbf53d, 0xfb7d75b3},
+    {0xf9573b5f, 0xec6b551d, 0x2a5824a2, 0x0aa51b4c},
+    {0x2739d2c9, 0x535ab2eb, 0xde67dfad, 0xf695ec7b},
+    {0xaad256b6, 0x5bcc9656, 0x939a316b, 0x4afa67c6},
+    {0xdadfb6d7, 0xb45bf5d8, 0x74eaddaa, 0xbb0b943a},
+    {0xd728a8a8, 0x4db51657, 0xcf4da5b5, 0x2dfe7bd6},
+    {0x14f7efb7, 0xf39aebba, 0x32bab65e, 0xe241cec9},
+    {0xfa8a34aa, 0x0c6698a5, 0xd4aaa9a5, 0x3fbe213b},
+    {0x55bacb92, 0xefd4e736, 0x2fb7b76a, 0xc493bde4},
+    {0x56c6bafe, 0x58bb3ced, 0xd85494af, 0xdaeece9f},
+    {0xd4796684, 0x6745a729, 0xa7d37771, 0xbb3164e2},
+    {0x37a798db, 0x9afcb8eb, 0xb45d494e, 0xa5af1b3c},
+    {0xda54a7b2, 0xb516c736, 0xab62bea9, 0x6ed175a3},
+    {0x537ebcad, 0x55d139d5, 0x6ddda55b, 0xd13ecabe},
+    {0xef49c6cb, 0xa65fce92, 0xd44eaad4, 0x3fe53564},
+    {0x88b5397a, 0xbdf070de, 0xb772dd57, 0x822ced9b},
+    {0xff4ee74a, 0x424f4fa9, 0x25969732, 0xfdb7a2ea},
+    {0x22f29967, 0xff31ac57, 0xda6db1da, 0x25915e4d},
+    {0x9a9d6f5a, 0x50ed72e8, 0x575a6e27, 0xaafd93b2},
+    {0xfae344ad, 0x9f8ed79b, 0x7193d5ba, 0x7646fcbb},
+    {0x053d3da9, 0xd279196d, 0x9d6c4ad4, 0xa9bd2693},
+    {0x7f45e5ae, 0x6dc5ed52, 0x63b5ba97, 0x57a5daec},
+    {0xc97a5535, 0x35be4adf, 0x5ea6d772, 0xda5b5355},
+    {0x2d55adab, 0xd5097952, 0xd0ba4acd, 0x55d4ae6b},
+    {0xdb56d4da, 0xa6f3af5d, 0xb7cbfab6, 0x652db5dc},
+    {0x64a95727, 0x759e5253, 0x9c552b2d, 0x5d6a2942},
+    {0x35bf69b5, 0x9a635af5, 0xe7b6a6ea, 0x6b5deb3e},
+    {0x4b453db4, 0x6d5adf17, 0x3499b913, 0xa8c32da3},
+    {0xfaba8a47, 0xab7520ea, 0xdb676b7c, 0xafbd69bd},
+    {0x16adf6fa, 0xcd8bef2d, 0xa8d84eca, 0xb0ab5654},
+    {0xb6d64caa, 0xb57a55d3, 0xd7b7f8db, 0xb76ad6e6},
+    {0x52d3b352, 0x24cf695e, 0x992a2764, 0xceaaa91a},
+    {0xda5c6d5f, 0xff51ad61, 0xb6edbd3f, 0x32aeadeb},
+    {0x1755ad68, 0x915d37b6, 0xa59ac1c8, 0xdd29d2ac},
+    {0xe9eb5267, 0x6d62d25b, 0xd6ab5e7b, 0x25fd5f55},
+    {0xae2af79d, 0x66deddcc, 0x1d64b547, 0xfe82916b},
+    {0x56fa0ce4, 0xba92b375, 0x755fabb8, 0x225d6edd},
+    {0xa98bf55b, 0x95d5550e, 0x534a564f, 0xedf9d225},
+    {0xb66c95aa, 0xed7cd6f5, 0xddb5b4f4, 0x1a465bfd},
+    {0x2db37555, 0x2287adb5, 0x3432ab95, 0xf3b74a05},
+    {0xd5de8a6f, 0xfef8514a, 0xc7ded976, 0x0cd975fa},
+    {0xac49bbd1, 0x928bdd76, 0xbc92aea4, 0x7aa58d4a},
+    {0x5b7a5a9d, 0xdb7d47ab, 0xd2f6a4ad, 0x976e769a},
+    {0xd397d2e2, 0x2da1b82a, 0x764eb7b5, 0x69aadaef},
+    {0x6c6cad3f, 0xcc9f6bed, 0x15d1b926, 0xad6929a1},
+    {0x2dab37a1, 0xbbf4ad25, 0xe95d2b74, 0x52b7b65d},
+    {0xd6dac8dd, 0x640ba5bb, 0x9e66e6cf, 0x5da4cdb6},
+    {0x5926b735, 0xdff5374c, 0x63ad3cb2, 0xb5b67acd},
+    {0xcb7969ea, 0x8835c955, 0xed75a3da, 0xa61d92aa},
+    {0xbb55962a, 0x77cc7d77, 0x99965c26, 0xadf376da},
+    {0x64ad6ddd, 0xd46fa388, 0xa6d9ebeb, 0x5c8d26a5},
+    {0x5dd6a953, 0x2f316cf7, 0x7acd3519, 0x63ead95e},
+    {0xca35576a, 0xf5dd9e95, 0x8b33ce76, 0xdd354bb1},
+    {0x7bd7ecdd, 0x854a516c, 0xedaa71cd, 0x2aad7d2a},
+    {0xaa501595, 0x7e75d7b3, 0x357a9d71, 0xb3b5a6cf},
+    {0x57aff6a9, 0xa58e74cb, 0xd54dd54e, 0x5ca55974},
+    {0xb4741576, 0xdd75555c, 0xa6d2b76a, 0xa6dda69b},
+    {0xef4bee8b, 0xa555afaa, 0x7aba5932, 0x7ac97ce2},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(19)
+  {  // level 19: redness 152
+    {0x09b455b5, 0xbad67827, 0xab4bd6de, 0x46b70b9e},
+    {0xf55fb2ee, 0xa76b97f8, 0xedb956c5, 0xfdadf671},
+    {0xad525eaa, 0x78bad50e, 0x2aedbb7b, 0x95549b5e},
+    {0xdb5db2b5, 0xcfcd6ef3, 0xda8b5a54, 0xedab75a3},
+    {0x5ce6ceda, 0xb4b7b34c, 0xad7acb96, 0x357daddc},
+    {0xe399354b, 0xab684d5d, 0x65b574fa, 0xe5255667},
+    {0x2eefed7b, 0xeddff6e7, 0x5e4b4f96, 0x3deea9b9},
+    {0xf92915ce, 0xb5111534, 0x53fed8b5, 0xcab5b797},
+    {0x47ebf531, 0x25f5ddaf, 0xbe25b7a9, 0x5b95586d},
+    {0x7c9cb6ef, 0x7e8f26d9, 0xa169a4bf, 0x6ceb6fe9},
+    {0xd6b34d24, 0xc57afb65, 0xbfee7f62, 0xb735924e},
+    {0x2add7ddb, 0x3554a55a, 0xa92b91af, 0xa9de7576},
+    {0xfb2bc55a, 0xdfa79d6f, 0xded4de68, 0x5d23afb5},
+    {0x4eec3a6b, 0xa0f8f3a9, 0x526ed1b5, 0xcbfce896},
+    {0x735bcfcd, 0x5e8f1cb7, 0xdfab2f1f, 0x74971eee},
+    {0xacd57835, 0x7beaeb6a, 0x50b3f9e1, 0x36d1f2b5},
+    {0xab2d27ed, 0xa4b4d5ad, 0xff5c8ebe, 0xcf7f2ec5},
+    {0x6df5dd56, 0xdb9734af, 0x82e6b596, 0x31a8d9be},
+    {0x5a55d94d, 0xb57ad771, 0x7f3b66e9, 0xdeaf6651},
+    {0xd75e277b, 0x4ecd4dae, 0xb2ccdcaf, 0x55b3b5af},
+    {0x35e3fd49, 0x6b2b7aaf, 0xaebb579a, 0x765c5d78},
+    {0xce9d15df, 0xf5f6cad0, 0x59e568f5, 0x6bcba757},
+    {0xb273d62a, 0x1a9b369f, 0xb336d79b, 0x95737aa5},
+    {0x7eca5bf2, 0xd66559e6, 0xad5d34b5, 0xdd5a55be},
+    {0x835f691f, 0x75bdd67c, 0xedd3ebcd, 0x73aecdb2},
+    {0xfde96fe1, 0x9da5568b, 0x952e1e7a, 0x946aba65},
+    {0x2515b05e, 0x573b79f2, 0x74ebe5d7, 0xefaba7df},
+    {0xdff75f65, 0xe8ab4d2f, 0xcfda6d2b, 0x14baad30},
+    {0x545ad2dd, 0x57f66bb2, 0x992baab8, 0xf346baef},
+    {0xd7566dd6, 0xdc9adaab, 0x75a6bbe7, 0x9d7acb59},
+    {0x29a9da31, 0xa2d7d6fd, 0x56faca1c, 0xd6d55ad7},
+    {0xeeb693af, 0xbeb23684, 0xab2bafd6, 0x6dab7564},
+    {0x69dafeec, 0xc5ddf6f7, 0xbacc3075, 0x952d8dbd},
+    {0x2d4d845b, 0x7b4b0aa9, 0x5afbef55, 0xf5f276a7},
+    {0xeb7b7faa, 0x5d6cfbbf, 0xe69495d5, 0x2d1fb3b9},
+    {0x1b54e2eb, 0x45b3ca44, 0x1b77745f, 0xe9eacd4e},
+    {0xeaaf2eae, 0xff2e5bbb, 0xedd5a7a9, 0x1f557ad9},
+    {0x5b52eb71, 0x62d9d45b, 0xb52d5db6, 0xf45b87af},
+    {0x95bb999e, 0x9d5737e4, 0x36fad133, 0x93d6fc6a},
+    {0x7b4cb65a, 0x76f6d45f, 0xd587776e, 0xfe548bb5},
+    {0xca6b77e6, 0xcb255fa9, 0xb6fd4c9d, 0x95b7faad},
+    {0x6bbbc91b, 0x5d5dd4be, 0x6d4af7f1, 0xdac9256d},
+    {0x6e9a3ef4, 0xaad355a3, 0xa573324f, 0x567b5b95},
+    {0x4ae7654d, 0xbadd5f7d, 0xbdadaeda, 0xfb4eecfa},
+    {0xbbb5aeb7, 0xa72b62c9, 0xe55b69b2, 0x02f1138e},
+    {0x545aa9ac, 0xd8eddd6d, 0x9b4a6f5b, 0xfe9efe75},
+    {0x5fcfbe63, 0x5f2d2d97, 0x75edd94c, 0xd565aae6},
+    {0xe0b065de, 0x52d5aaf4, 0x8e35aefb, 0x26d52b3d},
+    {0x9fbfda33, 0xf76aea8e, 0x79dab1a7, 0xfdbdedd3},
+    {0xb25297cc, 0x9c5b1bf1, 0xc6eb6edc, 0x9b552a56},
+    {0xddacf26f, 0xb3aae62e, 0xbb1e9d32, 0xb2ebb77a},
+    {0x66b7adb0, 0xdadb7deb, 0x68e5e9ef, 0xaf2a594a},
+    {0xbba8b9df, 0xa664855a, 0xcfbab758, 0x66daef7b},
+    {0x545ecea9, 0x77affad7, 0x5aaeca4f, 0x396e954e},
+    {0xf7b76abd, 0x98ad36b4, 0x73655df9, 0xeb49eb69},
+    {0x8cd0aac6, 0x7bb1adcd, 0xaedb7317, 0xaf3a1d5b},
+    {0x77bfdbb4, 0x466ee935, 0x68db4ee9, 0xa8d7eacd},
+    {0xaa656abb, 0xbadb2fee, 0xaf26bb3f, 0xefd937ba},
+    {0xb5dab6c4, 0x6ad2d915, 0xa9fcccc9, 0x9a37d4aa},
+    {0xad5b557f, 0xd75ed6f9, 0xdd8bb5b6, 0xb5c87aee},
+    {0x7565b590, 0xadb37687, 0x7679b652, 0x5d6f4f49},
+    {0x4b3daddf, 0x34ad56fd, 0x49ae4fbf, 0xe355e97f},
+    {0xede6e624, 0xe76ad6aa, 0x77ab7949, 0x9d759aa9},
+    {0x5abd3dfb, 0x5b5b39ab, 0x8c7aa56d, 0xd99676b6},
+    {0x4b46cb4e, 0xdb76eb6b, 0x75cbadb6, 0x66eacbeb},
+    {0xf57db8b3, 0x649595b4, 0x6bac764b, 0x5b56dc4d},
+    {0x9dc55fb4, 0xbeed76df, 0xcc7b99f6, 0xed5bb774},
+    {0x673ae2d7, 0xc9ab4a24, 0xb396e71c, 0xb5e529af},
+    {0xbad71d59, 0x36957bdb, 0x76f55ae7, 0x2e3df6aa},
+    {0xeadb73af, 0xeafb546d, 0x9a4a95d5, 0xaac54cda},
+    {0x16accd70, 0x2b8ab7d2, 0xebdbf73d, 0xfb7d75b7},
+    {0xf9d73b5f, 0xec6bd55d, 0x2a5a24a2, 0x0aa71b4c},
+    {0x2739d2c9, 0x577abaeb, 0xfee7dfbd, 0xf6d5ed7b},
+    {0xbad25eb6, 0xdbcc9656, 0x939ab16b, 0x4afa67c6},
+    {0xdadfb6d7, 0xb45bf5d8, 0x74eaddaa, 0xbb0b943a},
+    {0xd728a8a8, 0x4db51657, 0xcf4da5b5, 0xadfe7bd7},
+    {0x14f7efbf, 0xf39afbba, 0x32babe5e, 0xe241ced9},
+    {0xfb8a34aa, 0x2c6798a5, 0xf5aaa9a5, 0x3ffe313b},
+    {0x55bbcb93, 0xefdce7b7, 0x2fb7b76a, 0xc493bde4},
+    {0x56cebafe, 0x58bb3ced, 0xd85494af, 0xdaeece9f},
+    {0xd4796694, 0x6745a729, 0xa7dbf771, 0xbb3164e2},
+    {0x37a7badb, 0x9afdb8ef, 0xb65d494e, 0xa5af5b3e},
+    {0xda54a7b6, 0xb516d736, 0xab62beed, 0x6ed175a3},
+    {0x537ebcad, 0x75d139d5, 0x6ddda55b, 0xd13fcebe},
+    {0xefc9c6cb, 0xa65fceb2, 0xd44eaad4, 0x3fe53564},
+    {0x88b5397a, 0xbdf272de, 0xb7f2fd57, 0xc22ced9b},
+    {0xff4ee74a, 0x424f4fa9, 0xad96973a, 0xfdb7b2ea},
+    {0x22f39977, 0xffb1ac57, 0xda6db1da, 0x25915e4d},
+    {0x9e9d6f5a, 0x50ed72ec, 0x577a6e67, 0xaefd93b6},
+    {0xfae364ad, 0x9f8ed79b, 0x7593d5ba, 0xf646fdbb},
+    {0x45bd3da9, 0xd279196d, 0x9d6e5ad4, 0xa9bd2693},
+    {0x7f45e5ae, 0xedc5ef52, 0x63b5ba9f, 0x57a5daee},
+    {0xc97e5575, 0x35bf4adf, 0x5ea6d772, 0xda5b5355},
+    {0x2d55bdab, 0xdd297952, 0xd4ba4acd, 0x5dd6ae6b},
+    {0xdbd6d4da, 0xa6f3af5d, 0xb7dbfab6, 0x656db5de},
+    {0x6ca95727, 0x759e52d3, 0x9c552b2d, 0xdd6aad62},
+    {0x35bf69b5, 0x9b635af5, 0xe7f6aeea, 0x6b5deb3e},
+    {0x4b457dbc, 0x6d5edf17, 0x3499b993, 0xacd32da3},
+    {0xfafa8a47, 0xab7520fa, 0xdb676b7e, 0xafbd69bd},
+    {0x56adf6fa, 0xdd8bef2d, 0xacda4eca, 0xb0ab5654},
+    {0xb6d64daa, 0xb57a5dd3, 0xd7b7f8db, 0xb76ad7ee},
+    {0x52d3b352, 0x24cf695e, 0x992a2764, 0xceaab91a},
+    {0xfb5d6d5f, 0xff71ad69, 0xb6edbd3f, 0xb2eeadeb},
+    {0x1755ade8, 0x935f37b6, 0xb59ae3c8, 0xdd29d2ac},
+    {0xe9eb5267, 0x6d62d25b, 0xd6ab5e7b, 0x25fd7f55},
+    {0xae2af79d, 0x66deddcc, 0x5d64b547, 0xfe82916b},
+    {0xd6fb0cf5, 0xba92b775, 0x757fabb8, 0x225f6edd},
+    {0xa98bf55b, 0x95d7550e, 0x534ad64f, 0xeff9daa5},
+    {0xb66c97aa, 0xed7cd6f5, 0xddb5b4f4, 0x1a465bfd},
+    {0x6db37555, 0x2687adb5, 0x34b2af95, 0xf3b76a07},
+    {0xd5deca6f, 0xfef8594a, 0xc7ded976, 0x4cd975fa},
+    {0xac49bbd9, 0x928fdd7e, 0xbc92aea6, 0x7aad8d6a},
+    {0x5b7a5a9d, 0xdb7d47ab, 0xd2f6e4ad, 0x976e769a},
+    {0xd397d6e2, 0x6da1b8aa, 0x765eb7f5, 0x69abdaef},
+    {0x6d6cad3f, 0xcc9f6bed, 0x17d1b92e, 0xef692ba1},
+    {0x2dab77a1, 0xbbf4ad25, 0xe95d2b74, 0x52bfb65d},
+    {0xf6dac8dd, 0x640bb5bb, 0x9e66e6cf, 0x5da4cdb6},
+    {0x5926bf37, 0xdff5376c, 0x63adbcb2, 0xb5b67acd},
+    {0xcb7b69ea, 0xa937c955, 0xfd75a7da, 0xa65d92ba},
+    {0xbb55962a, 0x77cc7d77, 0x99965c2e, 0xedf376da},
+    {0x66ad6ddd, 0xd46fa38c, 0xa6d9ebeb, 0x5c8d2ea5},
+    {0x5dd6b953, 0x2f316cf7, 0x7aed3599, 0x63ebd95e},
+    {0xca35576a, 0xf5dd9e95, 0x8b37ce76, 0xdd354bb5},
+    {0x7bd7ecdd, 0x854b516c, 0xedaa73cd, 0x2aad7d6a},
+    {0xaa581595, 0x7ef5dfbb, 0x357a9d75, 0xf3b5a6cf},
+    {0x57aff6ed, 0xa58e74cb, 0xdd4dd54e, 0x5cad5974},
+    {0xb4f51576, 0xdd75555c, 0xa6d6b76a, 0xa6dda79b},
+    {0xef4bee8b, 0xa555afeb, 0x7aba5932, 0x7ac97ce6},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(20)
+  {  // level 20: redness 160
+    {0x19b455b5, 0xbade792f, 0xab4bd6de, 0x46b74b9f},
+    {0xf55fb2ee, 0xa76b97f8, 0xedbd56d5, 0xfdbdf671},
+    {0xadd2deaa, 0x78bad50e, 0x2aedbb7b, 0x95569b5e},
+    {0xdb5db3b7, 0xcfcd7ef3, 0xfb8b5ad4, 0xedab75ab},
+    {0x5cf6eeda, 0xb4b7b36e, 0xad7acb97, 0x377daddc},
+    {0xeb99354b, 0xab684d5d, 0x65b574fa, 0xe5255667},
+    {0x2eefed7b, 0xeddff6e7, 0x7e4b5f96, 0x3deeedb9},
+    {0xf92917ce, 0xbd1535b4, 0x53fed8f7, 0xcab5b797},
+    {0x47ebf531, 0x25f5ddaf, 0xbea5b7a9, 0x5b9d586d},
+    {0x7c9eb6ef, 0x7ecf26d9, 0xa16da4bf, 0xeceb6ff9},
+    {0xd6f34d34, 0xc57afb67, 0xbfee7f62, 0xb735da4e},
+    {0x2add7ddb, 0x7555a55a, 0xa92b91af, 0xa9de7576},
+    {0xfb2bc55a, 0xdfaf9f6f, 0xded4ff6c, 0x7d23afb5},
+    {0x4eec7b6b, 0xa4f8f3a9, 0xd2fed1b5, 0xcbfce896},
+    {0x735bcfdd, 0x5e8f1cb7, 0xdfab2f5f, 0x74971fee},
+    {0xbdd77835, 0x7bfaeb6a, 0x50b3f9e1, 0x36d5f2b5},
+    {0xab2d27ed, 0xa4b5d7ad, 0xff5c8ebe, 0xcf7f2ed5},
+    {0x6df5dd56, 0xdb9734af, 0x82e6f596, 0x71a8d9be},
+    {0x5a55d96d, 0xb57af771, 0x7f3b66f9, 0xdeaf6f51},
+    {0xd75e277b, 0x5eed4dae, 0xb2cedcaf, 0x55f3b5af},
+    {0x75e3fd49, 0x6b2b7aaf, 0xaebb579a, 0x765c5d78},
+    {0xce9d15df, 0xf5f6caf0, 0xd9e568f5, 0x6bcfa757},
+    {0xb2fbf66a, 0x1a9b769f, 0xb736df9b, 0xd5737aa5},
+    {0x7eca5bf2, 0xd6e55be6, 0xad5d34b5, 0xdd5ad5be},
+    {0x935f691f, 0x75bdd67d, 0xedf3ebcd, 0x77aecdb2},
+    {0xfde96fe9, 0xdda5568b, 0x972e1e7a, 0x946aba6d},
+    {0x251db25e, 0x577b7bfa, 0x74ebf5d7, 0xffbba7df},
+    {0xdff75f65, 0xe8abcd2f, 0xefda6dab, 0x15baed30},
+    {0x545ad2dd, 0x57f66bb2, 0x993baabc, 0xf346baef},
+    {0xf7d66dd6, 0xde9adaab, 0x75a6bbe7, 0x9d7ecb59},
+    {0x29abdb39, 0xb2d7d6fd, 0xd6faca5c, 0xd6d55edf},
+    {0xeeb693af, 0xbeb23696, 0xab2bbfd6, 0x6dbb7564},
+    {0x6ddafeec, 0xc5ddf6f7, 0xbaccb177, 0x952dcdbd},
+    {0x2d4d845b, 0x7b5b0aa9, 0x5afbef55, 0xf7f276a7},
+    {0xeb7b7faa, 0x5d6cfbbf, 0xe69495d5, 0x2d1fbbb9},
+    {0x5b54e2eb, 0x45b3cac4, 0x3b777c7f, 0xe9eacd6e},
+    {0xeaaf3eae, 0xff6e5fbb, 0xedd5a7a9, 0x9f557ad9},
+    {0x5b72eb71, 0x62d9f45b, 0xb52d5db6, 0xf4dba7af},
+    {0xd5bb99de, 0x9d5737e4, 0x36fad573, 0x93d6fc6a},
+    {0x7b4cb65a, 0x76f6d4df, 0xd587776e, 0xfe548bb5},
+    {0xcaeb77e6, 0xcb2d5fa9, 0xb6fd4c9d, 0x95bffaed},
+    {0x6bbbc91b, 0x7dddd4be, 0x6d4af7f1, 0xdac92d6d},
+    {0x7e9a3ef6, 0xaad375a3, 0xa777324f, 0x577b5b95},
+    {0x4ae765cd, 0xbadd5f7d, 0xbdadaeda, 0xfb4eecfa},
+    {0xfbb5eeb7, 0xa72b62cb, 0xe57b69b6, 0x0af1938e},
+    {0x547aa9ac, 0xf9eddd7d, 0x9b4a6f5b, 0xfe9efe75},
+    {0x5fcfbf73, 0x5f2d6d97, 0x75efd94c, 0xd56daae6},
+    {0xe4b065de, 0x52d5aaf4, 0xce35aefb, 0x26d52b3d},
+    {0x9fbfda33, 0xf76efa9f, 0x79dab3a7, 0xfdbdedd3},
+    {0xb25297ec, 0x9cdb1bf1, 0xc6eb6edc, 0x9b556a56},
+    {0xddeef66f, 0xb3aae62e, 0xbf1e9d32, 0xb2ebb7fa},
+    {0x66b7adb0, 0xdedb7deb, 0x68e5e9ef, 0xaf3a594b},
+    {0xbba8b9df, 0xa674875a, 0xcfbab758, 0xeedbef7b},
+    {0x54decea9, 0x77affad7, 0x5aaeda4f, 0x396e954e},
+    {0xf7b77abd, 0x98ad36b4, 0x73655df9, 0xeb49eb69},
+    {0x8cd0aae6, 0x7fb5adef, 0xaedb7357, 0xaf7e5d7b},
+    {0x77bfdbb6, 0x466ee935, 0x6adb4ee9, 0xa8d7eacd},
+    {0xaa656abb, 0xbadb2fee, 0xaf26fb3f, 0xefd937ba},
+    {0xb5deb6c4, 0x6ad2d955, 0xa9fcccc9, 0x9a37d4ab},
+    {0xaf5b5d7f, 0xd75ed6f9, 0xdd8bb5fe, 0xb5da7aee},
+    {0x7565b592, 0xbdb37687, 0x7679b652, 0x5d6f4f49},
+    {0x4b3dadff, 0x34ad56fd, 0x49ae4fbf, 0xe355eb7f},
+    {0xfde6e624, 0xe76bd6aa, 0xffabf949, 0xbf759aa9},
+    {0x5abd3dfb, 0x5b5b39af, 0x8c7aa77d, 0xd99676b6},
+    {0x4b46cb4e, 0xdb76eb6b, 0x75cbadb6, 0x66facbeb},
+    {0xf57dbab3, 0x65959db4, 0x6fac764b, 0x5b56dc5d},
+    {0x9dd55fbc, 0xbeed76df, 0xcc7b9df6, 0xed5bb774},
+    {0x673ae2d7, 0xc9bbcaa4, 0xb396e71d, 0xb5e529af},
+    {0xbad75d59, 0x3e957bdb, 0xf6f57ae7, 0x2ebdf6aa},
+    {0xeadb77af, 0xeafb546d, 0x9e5a95d5, 0xaac54eda},
+    {0x16accd72, 0x2b9ab7d6, 0xebdbf73d, 0xfb7df5b7},
+    {0xfdd73b5f, 0xec6bd55d, 0x2a5a24e6, 0x0aa71b4c},
+    {0xa73bd2d9, 0x577abaeb, 0xfee7dfbd, 0xfed5ed7b},
+    {0xbad25eb6, 0xdbce9756, 0x939ab56b, 0x4afa77d6},
+    {0xdadfb6d7, 0xb45bf5da, 0x7cfaddaa, 0xbb0b943a},
+    {0xd728a9a8, 0x4ff51657, 0xcf4da5b5, 0xadfe7bd7},
+    {0x54f7efbf, 0xf39afbba, 0x32babedf, 0xe249ced9},
+    {0xfbaa34ea, 0x2c679aad, 0xf5aae9a5, 0x3ffeb33f},
+    {0x55bbdb93, 0xefdce7b7, 0x2ff7b77a, 0xd493bde4},
+    {0x5ecebafe, 0x58bb3ced, 0xd8549caf, 0xdbeece9f},
+    {0xd5796694, 0x6745a729, 0xb7dbf771, 0xbb3975f2},
+    {0x37a7badb, 0xdefdb9ef, 0xb65d494e, 0xa5af5b3e},
+    {0xda54a7b6, 0xb556d736, 0xab62bfed, 0x6ed175a3},
+    {0x537ebcad, 0x75d539d5, 0x6ddde55b, 0xd93fcebe},
+    {0xffcbe6db, 0xa65fceb6, 0xd45eaad4, 0x3fe53566},
+    {0x88b53d7a, 0xbdf272de, 0xb7f2fdd7, 0xc22cef9b},
+    {0xff5ee74a, 0xca4f5fa9, 0xad96973a, 0xfdf7b2fa},
+    {0x62f39977, 0xffb9ad77, 0xda6db1da, 0x35955e4d},
+    {0x9e9d6f5a, 0x50ed72ec, 0x577a6e67, 0xaefd93b6},
+    {0xfaeb64ed, 0xbfafd79b, 0x7593d7ba, 0xf646fdbb},
+    {0x45bd3dab, 0xd279396d, 0xdd6e5ad4, 0xa9bd2693},
+    {0x7f45e5ae, 0xedc5ef52, 0x63bdba9f, 0x57b5dafe},
+    {0xc97e5775, 0x35bf4aff, 0x5ea6d772, 0xda5b7355},
+    {0x6d55bdab, 0xdd297b52, 0xd4ba4acd, 0x5dd6ae6b},
+    {0xdbd6d4da, 0xa6fbaf5d, 0xb7dbfaf6, 0x676db5de},
+    {0x6cb9576f, 0xf59e52d7, 0xdc552b2d, 0xdd6aad62},
+    {0x77bf69b5, 0x9b637af5, 0xe7f6eefa, 0x6b5deb3e},
+    {0x4b457fbc, 0x6d5edf17, 0x3699b993, 0xacd32de3},
+    {0xfafb8a47, 0xab7521fa, 0xdb6f6b7e, 0xefbd79bd},
+    {0x56adf6fa, 0xdd8bef2d, 0xacda4eca, 0xb0ab5656},
+    {0xb6d65dae, 0xb77a5dd3, 0xd7b7fadb, 0xbf6ed7ee},
+    {0x56d3b352, 0x24cf695e, 0xd92aa765, 0xceaab91a},
+    {0xfb5d6d5f, 0xff71ad69, 0xb6edbd3f, 0xb3eeafeb},
+    {0x175dade8, 0x935f77b7, 0xb5bae3c8, 0xdd2bd2bc},
+    {0xe9eb5a67, 0x6d6ad25b, 0xd6af5e7f, 0x25fd7f55},
+    {0xbe2af79d, 0x6ededdcc, 0x5d64b547, 0xfea2916b},
+    {0xd7fb2cf5, 0xbab2b775, 0x777fbbf8, 0x225f6edd},
+    {0xa99bf55b, 0x95d7552e, 0x534ad64f, 0xfff9daa5},
+    {0xb66c97aa, 0xed7cf6f5, 0xddb5b4f5, 0x1a4e5bfd},
+    {0x6db37d75, 0x2687adb7, 0x34b6af95, 0xf3b76a07},
+    {0xd5deca6f, 0xfef85b4a, 0xd7ded976, 0x4ed9f7fa},
+    {0xae4bbbd9, 0x92cffd7e, 0xbc92afb6, 0x7aad8d6b},
+    {0x7b7a5a9f, 0xdb7d47ab, 0xd3f6e4ad, 0x976e769a},
+    {0xd397d6e2, 0x6da1bcaa, 0x765eb7f5, 0x69abdaef},
+    {0x6d6cad7f, 0xce9f6bfd, 0x57d3bd2e, 0xef692bb1},
+    {0x2dbb77a9, 0xbbfcad27, 0xe95d2b75, 0x52bfb65d},
+    {0xf6dac8dd, 0x644bf5bb, 0x9e76e6cf, 0x5da4cdb6},
+    {0x5da6bf37, 0xdff5376c, 0x63adbcb2, 0xb5b6facd},
+    {0xcb7b69ea, 0xa937c955, 0xfd75a7db, 0xb65d96bb},
+    {0xbb55d72a, 0x77cc7d77, 0x9d965c6e, 0xedf376da},
+    {0x66ad6ddd, 0xd4efa7ac, 0xa6dbebeb, 0x5c8d2ee5},
+    {0x5dd6b957, 0x2f356cf7, 0xfaed3599, 0x63fbf95e},
+    {0xca75576a, 0xf5ddbf95, 0x9b37ce76, 0xdd354bb5},
+    {0x7bd7eedd, 0x954b516d, 0xedaa73cd, 0x2ead7d6a},
+    {0xaa585595, 0x7ef5dfbb, 0x357add75, 0xf3f7a6cf},
+    {0x57aff6ed, 0xa59e74cb, 0xddcdd55e, 0x5cad7974},
+    {0xb4f51576, 0xdd75d55c, 0xa6d6b7eb, 0xa6dda79b},
+    {0xef5bfe9b, 0xb755afeb, 0x7aba5932, 0x7ac97ce6},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(21)
+  {  // level 21: redness 168
+    {0x19b555b5, 0xbade792f, 0xaf6bf6de, 0x46b74b9f},
+    {0xf75fb6ee, 0xa76bd7f9, 0xedbd56d5, 0xfdbdf6f1},
+    {0xadd2deaa, 0x7abad54e, 0x2aedbb7f, 0x95569b5e},
+    {0xdb5db3b7, 0xcfcd7ef3, 0xfb8b5ad4, 0xfdeb75ab},
+    {0x5cf6eefa, 0xbcb7b36e, 0xad7ecf97, 0x377deddd},
+    {0xeb9b354b, 0xab694d5d, 0x65f5f4fa, 0xe5255667},
+    {0x2eefed7b, 0xeddff6e7, 0x7e4b5f96, 0x3feeedf9},
+    {0xf93937ce, 0xbd3535b5, 0x53fed8f7, 0xeab5b797},
+    {0x47ebf539, 0xa5f5ddaf, 0xbea5b7a9, 0x5b9d586d},
+    {0x7c9eb6ef, 0x7ecf2ed9, 0xa56da6bf, 0xeceb6ff9},
+    {0xd7f34db4, 0xd57afb77, 0xfffeff72, 0xb775db4e},
+    {0x2add7ddb, 0x7555a55a, 0xa92b91af, 0xa9de7576},
+    {0xfb2bd55e, 0xdfafbf6f, 0xded4ff6c, 0x7f2bafb5},
+    {0x4eec7b6b, 0xa4f8f3a9, 0xd2fed5b5, 0xcbfce8b6},
+    {0x735bcfdd, 0x5e8f9cb7, 0xdfab2f5f, 0x74975fee},
+    {0xbdf77835, 0x7bfaeb7a, 0x54b7f9e1, 0xbed5f2b5},
+    {0xab2d27ed, 0xa4b5dfad, 0xff5c8ebf, 0xcf7f2ed5},
+    {0x6df5df56, 0xdf9734af, 0x92e6f596, 0x71a9d9be},
+    {0xdad5f96d, 0xb57af7f1, 0x7f7b76f9, 0xdeaf6f53},
+    {0xd75e277b, 0x5eedcdae, 0xb2ceddaf, 0x55f3b5af},
+    {0x7df3fd49, 0xeb2b7aaf, 0xaebb579a, 0x765cdd78},
+    {0xce9d15df, 0xf5f6cef0, 0xd9ed68f5, 0x6fcfa75f},
+    {0xb2fbf66e, 0x1e9b769f, 0xb736dfdf, 0xd5737ae5},
+    {0x7eca5ff2, 0xd6ed5be6, 0xad5db4b5, 0xdd5ad7be},
+    {0x935fe91f, 0x75bdd67d, 0xfdf3ebcd, 0x77eeddb2},
+    {0xfde96fe9, 0xdda5568b, 0x972e1e7a, 0x946aba6d},
+    {0x251db27e, 0x577f7bfa, 0x74ebf5d7, 0xffbba7df},
+    {0xfff75f65, 0xf8abcd6f, 0xefda6dab, 0x95baed32},
+    {0x545adadd, 0x57f67bb6, 0x993baebc, 0xf746bbef},
+    {0xf7d66dd6, 0xde9adaab, 0x77a6fbe7, 0x9d7eeb59},
+    {0x2dbbdb39, 0xb2dfd6fd, 0xdefeca5d, 0xf6d55edf},
+    {0xeeb6b3af, 0xbeb23796, 0xab2bbfd6, 0x6dbb7564},
+    {0x6ddafeed, 0xc5ddf6f7, 0xbaccb177, 0x956fcdbd},
+    {0xad4d855b, 0x7b5b2aa9, 0x5bffef5d, 0xf7f276a7},
+    {0xeb7b7fba, 0x7d6efbbf, 0xe69495d5, 0x3d1fbbbb},
+    {0x5bd5e2eb, 0x45b3cae4, 0x3b777d7f, 0xe9eacd6e},
+    {0xeaaf3eae, 0xff6e5fbf, 0xedd5e7a9, 0x9f5d7ad9},
+    {0x5f72eb75, 0x6ad9f45b, 0xb5ad5db7, 0xf4dba7af},
+    {0xd5bfddde, 0x9d5737e4, 0xb6fad573, 0x97d6fd6a},
+    {0x7b4cb65a, 0x76f6d4df, 0xdd9777ee, 0xfe748bbd},
+    {0xceeb77e6, 0xcb2d5fa9, 0xb6fd4c9d, 0x95bffaed},
+    {0x6bbbc93b, 0x7dddd5bf, 0x6d4af7f5, 0xfac96d6d},
+    {0x7e9abef6, 0xaad375a3, 0xa777ba4f, 0x577b5b97},
+    {0x4aef6dcd, 0xbefd5f7d, 0xbdadaeda, 0xfb4eeefa},
+    {0xfbb5eeb7, 0xa72b72cb, 0xed7b69f6, 0x4af393ae},
+    {0x557aa9ac, 0xf9eddd7d, 0x9b4a6f5b, 0xfe9efe75},
+    {0x5fcfbf73, 0x5f3d6f97, 0x75efd94d, 0xd5edabe7},
+    {0xe4b265de, 0x52d5aaf4, 0xcf35aefb, 0x26d53b3d},
+    {0xbfbffa33, 0xf76efa9f, 0x79dab3a7, 0xfdbfeddb},
+    {0xb25297ec, 0x9cdb1bf1, 0xd6ebeedc, 0xdb556a56},
+    {0xddeef66f, 0xb3abe62e, 0xbf3e9d33, 0xb2ebb7fa},
+    {0x66b7adb2, 0xdedb7dfb, 0x68e5ebef, 0xaf3a594b},
+    {0xbfa8b9df, 0xa674975b, 0xdfbab778, 0xeedbef7b},
+    {0x54dfcfa9, 0x77affad7, 0x5aafda4f, 0x39eeb5ce},
+    {0xf7b77abd, 0xd8ed36b4, 0x73755df9, 0xeb49eb6b},
+    {0x9cd4aae6, 0x7fb5afef, 0xaedb7357, 0xaf7e5d7b},
+    {0x77bfdfb6, 0x466ee935, 0x6adb4ee9, 0xb8d7eacd},
+    {0xea656abb, 0xbbdbbfee, 0xbf66fb3f, 0xefd937ba},
+    {0xb5deb6cc, 0x6adad955, 0xa9fccdc9, 0x9b37d6ab},
+    {0xaf5bdd7f, 0xd75ed6fd, 0xdd8fb5fe, 0xf5da7afe},
+    {0x75e5b592, 0xbdb37687, 0x7779b653, 0x5d6f4f49},
+    {0x4b3dadff, 0x34ed56fd, 0x49ae4fbf, 0xe355fb7f},
+    {0xfde6e724, 0xef6bd6ea, 0xffabf949, 0xbf7d9aa9},
+    {0x5abdbdfb, 0x5b5b3daf, 0x8c7ab7fd, 0xd99776b6},
+    {0x6f66cb4f, 0xdb7eeb6b, 0x75dbadb6, 0x6efacbeb},
+    {0xf57dbab3, 0x65959db4, 0x6fad764b, 0x5b56dd5f},
+    {0x9dd75fbc, 0xbeed76df, 0xdcfb9df6, 0xed5bb774},
+    {0x673ae2d7, 0xc9bbcab5, 0xb396e73d, 0xb5ed39af},
+    {0xbad75d79, 0x3f957fdb, 0xf6f77ae7, 0x6ebdf6aa},
+    {0xeedb77af, 0xeaff546d, 0x9e5a95d5, 0xaac54efa},
+    {0x16accd72, 0x2b9ab7d6, 0xebdbff3d, 0xfb7df5b7},
+    {0xfdf77b5f, 0xfd6bd55d, 0x2b5a64e6, 0x2ba71b4d},
+    {0xa73bd3d9, 0x577abefb, 0xfef7dfbd, 0xfedded7b},
+    {0xbad25eb6, 0xdbced756, 0x939ab56b, 0xcafa77d6},
+    {0xdbdff6df, 0xb45bf5da, 0xfcfaddae, 0xbb4b94ba},
+    {0xd72ca9a8, 0x5ff51657, 0xcf4fa5b5, 0xadfefbd7},
+    {0x5cf7efbf, 0xf39afbfa, 0x36babedf, 0xea49ced9},
+    {0xfbaa34ea, 0x2c779aad, 0xf5aae9a5, 0x3ffeb33f},
+    {0x55bbdb93, 0xefdce7b7, 0xafffb77a, 0xd493bde4},
+    {0x5ecebefe, 0x59bb7ced, 0xd8549daf, 0xdbeece9f},
+    {0xd5796695, 0x6745a739, 0xb7dbf773, 0xbb3b75f2},
+    {0x77afbafb, 0xdefdbdef, 0xf6df495e, 0xadef5b3e},
+    {0xdad5a7b6, 0xb556d736, 0xab62bfed, 0x6ed175a3},
+    {0x537ebcad, 0x7dd579d5, 0x7ddded5b, 0xd93fdefe},
+    {0xffcbe7db, 0xa75fceb6, 0xd65eaad6, 0x3fed3566},
+    {0x88b53d7b, 0xbdf272de, 0xb7f2fdd7, 0xc62cef9b},
+    {0xff5ee74a, 0xca4fdfa9, 0xad97973a, 0xfdf7b2fa},
+    {0x63f3b977, 0xffb9ad77, 0xfa6db9da, 0x35955e4d},
+    {0x9e9d6f5a, 0x50ed72ec, 0x57fe6e67, 0xaefdd3f6},
+    {0xfaeb66ed, 0xbfafdf9b, 0x7593d7ba, 0xf6c6fdbb},
+    {0x45bdbdab, 0xd679396f, 0xdd6e5ad6, 0xadbd2693},
+    {0x7f65edbe, 0xedcdef52, 0x6bbdbadf, 0x77b5defe},
+    {0xd97e5775, 0x35bf4aff, 0x5ee7d772, 0xda5b7355},
+    {0x6f55bdab, 0xdda97b52, 0xd4ba5acd, 0x5dd6af6b},
+    {0xdbd7d4da, 0xa6fbaf5d, 0xb7dbfbf6, 0x676db5de},
+    {0x6cb95f6f, 0xfd9ed2d7, 0xdc572b2d, 0xdd6ebd6a},
+    {0x77bf69b5, 0x9b637af5, 0xe7f6eefa, 0x6bddeb3e},
+    {0x4b457fbc, 0x6ddedf17, 0x3699b993, 0xacd32de3},
+    {0xfafb8ac7, 0xeb7531fa, 0xfb6f6b7e, 0xefbdfbbd},
+    {0x56adf6fa, 0xddabef2d, 0xacda4eda, 0xb1ab5656},
+    {0xb6de5dae, 0xb77addf3, 0xd7f7fadb, 0xbf6ed7ee},
+    {0xd6f3b352, 0x34cf6b5e, 0xdb2aa765, 0xcebaf93a},
+    {0xfb5d6f5f, 0xff71ad69, 0xb6edbd7f, 0xb3eeafeb},
+    {0x175dadfa, 0x935f77b7, 0xb5baebc8, 0xfd2bd2bc},
+    {0xe9eb5a67, 0x6d6ada7b, 0xd6af5e7f, 0x25fd7f57},
+    {0xbe2af79d, 0xefdeddcc, 0x5de4b557, 0xffa2d36b},
+    {0xd7fb2df5, 0xbab3b775, 0x777fbbf8, 0x225f6edd},
+    {0xa99bf55b, 0x95d755ae, 0xd34ad74f, 0xfff9daa5},
+    {0xbeee97ae, 0xfd7cf6f5, 0xddf5b4f5, 0x9a4e5bfd},
+    {0x6db37d75, 0x26a7adb7, 0x36b6af9d, 0xf3b76a17},
+    {0xd5decb6f, 0xfefa5b4a, 0xd7def976, 0x4ed9f7fa},
+    {0xae6bbbd9, 0x92cffd7e, 0xbc93afb6, 0x7aed9d6b},
+    {0x7b7a5a9f, 0xfb7d47ab, 0xd3f6e4ad, 0x976e769a},
+    {0xdb97f6e2, 0x6da3bcab, 0x765eb7f5, 0x79abdaef},
+    {0x6d6cad7f, 0xcedf6bfd, 0x5fd3bd2e, 0xef6d6bb3},
+    {0x2dbb77a9, 0xbbfcad27, 0xe95d6b75, 0x56bfb65d},
+    {0xf6dbcadd, 0x644bf5bb, 0x9ef6e7df, 0x5de4cdf6},
+    {0x5da6bf37, 0xdff537ee, 0x63adbcb2, 0xb5b6facd},
+    {0xcb7b69ea, 0xa937cd55, 0xfd75a7db, 0xb65d96bb},
+    {0xbb55d72b, 0x7fccfd77, 0x9db67c6e, 0xedf776de},
+    {0x66bd6dfd, 0xd4efa7ac, 0xa6dbebeb, 0x5e8d2ee5},
+    {0x7dd7b957, 0x2f356cf7, 0xfaed359b, 0x73fbfb5e},
+    {0xcb75576b, 0xf5fdbf95, 0x9bb7de76, 0xdd354bb5},
+    {0x7bd7eefd, 0x954b516d, 0xedaa73cd, 0x2ead7d7a},
+    {0xaa5a5595, 0xfef5dfbb, 0xb57add75, 0xf3f7a6cf},
+    {0x5faff6ed, 0xa59e76eb, 0xddcdd55e, 0x5cad7d74},
+    {0xb4f51576, 0xddf5d55c, 0xa6d7b7eb, 0xaedda7bb},
+    {0xef5bff9b, 0xb755afeb, 0x7aba5d32, 0xfbeb7ce6},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(22)
+  {  // level 22: redness 176
+    {0x19b555b5, 0xfade792f, 0xaf6bf6de, 0x56b74b9f},
+    {0xf77fb6fe, 0xa76bdff9, 0xedbd56d5, 0xfdbdfef1},
+    {0xadd2deaa, 0x7abad54e, 0x2aedbb7f, 0x97569b5e},
+    {0xdb5db3b7, 0xcfef7efb, 0xffab7ad4, 0xfdeb75bb},
+    {0x7ef6eefa, 0xfcb7b36e, 0xad7ecfb7, 0xb77feddd},
+    {0xeb9b3d4f, 0xab695f5d, 0x65f5f4fa, 0xe5255e67},
+    {0x2eefedfb, 0xefdff6f7, 0xfe4b5f96, 0x3ffeedfd},
+    {0xf9b937ce, 0xbd3535b5, 0x53fedaff, 0xeab5b797},
+    {0x4febf539, 0xa5f5ddaf, 0xbea5b7a9, 0x5b9f5a6d},
+    {0x7c9eb6ef, 0x7ecf6ed9, 0xa56db6bf, 0xeeeb6ffb},
+    {0xd7f3cdb5, 0xd77afbf7, 0xfffeff72, 0xb775db4e},
+    {0x6add7fdb, 0x7555a55a, 0xa92b91ef, 0xa9df7576},
+    {0xfb6fd55e, 0xdfefbf6f, 0xdfd6ff6e, 0x7f2bafb5},
+    {0x4eec7b6b, 0xe4f8f3ed, 0xf2fed5b5, 0xcbfce8b6},
+    {0xf35bcfdd, 0x5e8f9eb7, 0xdfab6f5f, 0x74d75fee},
+    {0xbdf778b7, 0x7bfeeb7a, 0x54b7f9e9, 0xbed5f6b7},
+    {0xaf2d67ed, 0xa4b5dfad, 0xffdc8ebf, 0xcf7f2ed5},
+    {0x6df5df56, 0xffd734af, 0x92e7f5d6, 0x79a9f9be},
+    {0xdad7f96f, 0xb57af7f9, 0x7f7b76f9, 0xdfbf6f73},
+    {0xd75e277b, 0x5eedcdae, 0xb6ceddaf, 0x55f3b5af},
+    {0x7df3fdd9, 0xebaf7baf, 0xaebbd79a, 0xf65cddf8},
+    {0xce9d55df, 0xf5f6cef8, 0xf9ed6cf5, 0x6fdfb75f},
+    {0xb2fbf66e, 0x1e9b769f, 0xb7b6dfdf, 0xd5737ae5},
+    {0xfeca5ff2, 0xf6ed5be6, 0xad5db4b5, 0xdd5ad7be},
+    {0x977fe91f, 0x75bff6fd, 0xfdf3ebcf, 0x77efddb3},
+    {0xfde96fe9, 0xdda5568b, 0x972e5f7a, 0x956abaed},
+    {0x251db37e, 0x577f7bfa, 0x74eff5d7, 0xffbbb7df},
+    {0xfff75f65, 0xfaabcd6f, 0xefda6dbb, 0x95baed32},
+    {0x54dbdadf, 0x57f67bb6, 0x997baebc, 0xf766bbef},
+    {0xf7d66dd6, 0xde9adaab, 0x77a6fbe7, 0x9d7feb59},
+    {0xadbbdf79, 0xb2dfd6fd, 0xdefeca5d, 0xf7d55edf},
+    {0xeeb6b3af, 0xbef2b796, 0xab6bbfd6, 0x6dbb7766},
+    {0x6ddafeed, 0xc5ddf6ff, 0xfaccb577, 0x956fcdbd},
+    {0xad6f955b, 0x7f5b2ea9, 0x5bffef5d, 0xf7f276e7},
+    {0xfb7b7fba, 0x7d6efbbf, 0xee9595d5, 0xbd1fbbbb},
+    {0x5bd5e2eb, 0x45b3cae4, 0x3b777d7f, 0xebeacd6e},
+    {0xeaaf3eae, 0xff7e5fbf, 0xeddde7a9, 0x9f7d7af9},
+    {0x5f72eb75, 0x6ad9f55b, 0xb5ad5dbf, 0xf4dbb7af},
+    {0xd5bfddde, 0x9d57b7f5, 0xb6fbd573, 0x97d6fd6a},
+    {0x7b6cb65b, 0xf7f6d4df, 0xdd977fee, 0xfe768bbd},
+    {0xceeb77e6, 0xcb3d7fa9, 0xb6fd4c9d, 0x95bffeed},
+    {0x6bbbcb3b, 0x7dddd5bf, 0x6d4af7f5, 0xfbc96d6d},
+    {0x7edabef6, 0xaad375ab, 0xe7ffba6f, 0x577b5b97},
+    {0x4aef6ddd, 0xfeff5f7d, 0xbdadaeda, 0xfb5efefa},
+    {0xfbb5eeb7, 0xa72b72cb, 0xed7bebf6, 0x4af393ae},
+    {0x557aa9ac, 0xf9eddd7d, 0x9b4a6f5b, 0xfe9efe75},
+    {0x7fcfbf77, 0x5fbd6fd7, 0x7dffd94d, 0xd5edabe7},
+    {0xe4ba65de, 0x5ad5aaf4, 0xcf35befb, 0x2ed53b3d},
+    {0xbfbffab3, 0xf76efa9f, 0x79dab3b7, 0xfdbfeddb},
+    {0xb2d29fec, 0x9edb5ff5, 0xd6ebeedc, 0xdb556e56},
+    {0xddeef66f, 0xb3bbe6ae, 0xbf3ebd37, 0xb2efb7fe},
+    {0x66bfadba, 0xfedb7dfb, 0x69e5ebef, 0xafba594b},
+    {0xbfa8b9df, 0xa6f4975b, 0xdfbab778, 0xeedbef7b},
+    {0x54ffefa9, 0x77affad7, 0xdaafda4f, 0x39eeb5de},
+    {0xf7b77abf, 0xd8edb6bc, 0x77755ffd, 0xef59ef6b},
+    {0x9cd4aae6, 0x7fb5afef, 0xaedb7357, 0xaf7e5d7b},
+    {0x77bfdfb6, 0x466ee935, 0xeadf6ee9, 0xb8d7eacd},
+    {0xeae56abb, 0xffdbbfee, 0xbf66fb3f, 0xefd93ffa},
+    {0xbddeb7cc, 0x6adad955, 0xa9fccdc9, 0x9b77d6ab},
+    {0xaf5bdd7f, 0xd75ed7fd, 0xdd8fbdfe, 0xf5dafafe},
+    {0x75edb592, 0xbdb77e97, 0xf779f653, 0x5d6f4f49},
+    {0xcb3dadff, 0x35ed56fd, 0x49ee4fff, 0xebd5fbff},
+    {0xfde6f72c, 0xef6bd6ea, 0xffabf949, 0xbf7d9aad},
+    {0x5bbdbdfb, 0x5b5b7daf, 0xad7eb7ff, 0xd99776b6},
+    {0x6f66cb6f, 0xdb7eeb7b, 0x75dbadb6, 0x6efaebeb},
+    {0xf57dbab3, 0x6dd59db4, 0x6fad76cb, 0x5bd6dd5f},
+    {0x9dd75fbe, 0xbeef76df, 0xdcfbbdf6, 0xed5bb774},
+    {0x773af2d7, 0xe9bbcab5, 0xb396e73d, 0xb7ed39af},
+    {0xbbf75d79, 0x3f957fdb, 0xf6f77ae7, 0x6ebff7aa},
+    {0xeedb77af, 0xeaff556d, 0x9eda95dd, 0xaad54efa},
+    {0x56adcd72, 0x2b9af7d6, 0xfbdfffbd, 0xfb7df5b7},
+    {0xfdf77b5f, 0xfd6bd55d, 0x2b5a64e7, 0x2ba73b4d},
+    {0xa73bdbd9, 0x577abefb, 0xfef7dfbd, 0xfedded7b},
+    {0xbad25eb6, 0xdbeed756, 0x939ab56b, 0xcafb77d6},
+    {0xfbfff6ff, 0xb45bf5fa, 0xfcfafdae, 0xbb4b9cba},
+    {0xd72cada8, 0x5ff71e57, 0xcfcfa7b5, 0xaffefbd7},
+    {0x5cf7efbf, 0xf39afbfa, 0x36babeff, 0xea49ced9},
+    {0xfbaab4ea, 0x2e779aad, 0xf5aae9a5, 0xbffeb37f},
+    {0x55bbdb9b, 0xefdce7b7, 0xafffb77b, 0xd4b3fde4},
+    {0x7eeebefe, 0x79bb7cef, 0xdc549daf, 0xdbeece9f},
+    {0xd5796695, 0x6767a739, 0xb7dbf773, 0xbb3b75f2},
+    {0x77afbafb, 0xdefdbdef, 0xf6df695e, 0xadef5f3e},
+    {0xdad5b7b6, 0xb556d736, 0xab72bfed, 0xeed175ab},
+    {0x5b7ebcad, 0x7df57df5, 0xfddded5b, 0xd93fdefe},
+    {0xffebe7db, 0xe75fceb7, 0xd65eaad6, 0x3fed3566},
+    {0x88b53d7b, 0xbdf272de, 0xb7f2fdf7, 0xc6adefdb},
+    {0xff5eef4a, 0xca5fdfad, 0xadb7973a, 0xfdf7b2fa},
+    {0x73f7b9ff, 0xffb9ad77, 0xfa6df9da, 0xb59d5e4d},
+    {0x9e9d6f5a, 0xd2ed72ec, 0x57fe6eef, 0xaefddbf7},
+    {0xfaeb66ed, 0xbfafdfbb, 0x7593d7ba, 0xf6c6fdbb},
+    {0x47bdbdab, 0xd679396f, 0xdd6edad6, 0xadbf26d3},
+    {0xff67edbe, 0xedcdefd2, 0x6bbdbedf, 0x77b5defe},
+    {0xd97e5775, 0x37bf6aff, 0xdee7d772, 0xda7b7355},
+    {0x6f55fdaf, 0xfda97b52, 0xd5ba5adf, 0xddd6ef6b},
+    {0xdbd7d5da, 0xa6fbaf7d, 0xb7dbfbf6, 0x676db5de},
+    {0x6cb95f6f, 0xfd9edad7, 0xdc5f2b2d, 0xdd6ebdea},
+    {0x77ff69b5, 0x9b737bfd, 0xeff6eefe, 0x7bddeb3f},
+    {0xcb457fbd, 0x6ddedf17, 0x36d9bd93, 0xacd72de3},
+    {0xfefbaac7, 0xeb7531fa, 0xfb6feb7e, 0xefbdfbbd},
+    {0x56adf6fa, 0xddafef2d, 0xacda5eda, 0xb1ab5656},
+    {0xb6de5dbe, 0xb77addf7, 0xf7f7fadb, 0xff6ed7ee},
+    {0xd6f3b352, 0x34cf6b5e, 0xdb2ea76d, 0xcebaf93a},
+    {0xfb5d6f5f, 0xfff9ad69, 0xb6edbd7f, 0xb3eeafeb},
+    {0x1f5dedfa, 0xd35f77b7, 0xbdbaebc8, 0xfd2bdabc},
+    {0xe9eb5a67, 0x6d6adb7b, 0xd6afdf7f, 0x2dfd7f57},
+    {0xbeaef79d, 0xefdeddcc, 0x5de4b557, 0xffa6d36b},
+    {0xd7fb2df5, 0xbab3b777, 0x777fbbf8, 0x225f6efd},
+    {0xa99bf55b, 0x95df5dae, 0xdb4ad74f, 0xfff9daa5},
+    {0xfeeed7ae, 0xfd7cf6f5, 0xddfdf4f5, 0x9a6f5ffd},
+    {0x6db37d75, 0x27a7adbf, 0x76b6af9d, 0xfbb76a97},
+    {0xd5decb6f, 0xfefa5b4a, 0xd7def9f7, 0x4ed9f7fa},
+    {0xaf6bbbd9, 0x96cffd7e, 0xbcb3afb6, 0xfaef9d6f},
+    {0x7b7adebf, 0xfb7d47eb, 0xd7f6ecad, 0x976e76da},
+    {0xdbd7f6e2, 0x6da3fcab, 0x765eb7f7, 0x79bbdaef},
+    {0x6d6cad7f, 0xcedf6ffd, 0x5fd3bd2e, 0xef6d6bb3},
+    {0x6dbb77ad, 0xbbfcad27, 0xe95d6b75, 0x56bfbe5d},
+    {0xf6dbdadd, 0x764ff5bb, 0xbef6efdf, 0xdde4cdf6},
+    {0x5daebf77, 0xdff537ee, 0x67adbcb2, 0xb5b6fbcd},
+    {0xeb7b69ea, 0xa937dd55, 0xfd77a7db, 0xb75d96bb},
+    {0xbbd5df2b, 0x7fdcfd77, 0x9db67e6e, 0xedf7f6de},
+    {0x6ebd6dfd, 0xd4efa7ad, 0xe6dbebeb, 0x5e8d2ee5},
+    {0x7dd7bb57, 0x6f356cf7, 0xfeed35bb, 0x73fbfb5e},
+    {0xcb75576b, 0xf5fdff9d, 0x9bb7de76, 0xddb74bb5},
+    {0x7bd7eefd, 0x974f516d, 0xedaa73cd, 0x2ead7d7a},
+    {0xaa7a5d95, 0xfef5dfbb, 0xb77edf75, 0xf3f7a7cf},
+    {0x5faff6ef, 0xa59e76ef, 0xddcdd55e, 0x5ead7d74},
+    {0xf5f55576, 0xddf7d55c, 0xe6f7b7eb, 0xaedda7bb},
+    {0xef5bff9b, 0xb755afeb, 0x7aba5db6, 0xfbeb7cee},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(23)
+  {  // level 23: redness 184
+    {0x3db555b5, 0xfafef93f, 0xaf6bf6de, 0x56b74bdf},
+    {0xf77fb6ff, 0xaf6bdff9, 0xfdbf57d5, 0xfdfdfef1},
+    {0xadd2feaa, 0x7abad54e, 0x2aedbb7f, 0x9756db5f},
+    {0xdb5fb3b7, 0xcfef7ffb, 0xffab7ad6, 0xfdeb77bb},
+    {0x7ef6eefa, 0xfcbfb36f, 0xad7ecfb7, 0xb77feddd},
+    {0xebbb3d4f, 0xabe95f5d, 0x77f5f4fa, 0xeda55e67},
+    {0x2eefedfb, 0xefdff6f7, 0xfe4f5f96, 0x3ffeedfd},
+    {0xf9b937ef, 0xbd35b5b5, 0x53fedaff, 0xeab5b7b7},
+    {0x6feffd39, 0xe5fdddaf, 0xbfb5f7a9, 0x5bdf7a6d},
+    {0x7c9eb6ef, 0x7ecf6edd, 0xb56db6bf, 0xeeeb6ffb},
+    {0xd7f3cdb5, 0xd77afbf7, 0xfffeff72, 0xb775db4e},
+    {0x6add7fdb, 0x7557ad5a, 0xa92b95ef, 0xb9df7576},
+    {0xff6fd57e, 0xdfefbf6f, 0xdfd6ff6e, 0xff2bbfbd},
+    {0x4eed7b6b, 0xf4f8f3ed, 0xf6fed5b5, 0xcbfee9b6},
+    {0xf35bcfdd, 0x5f8f9eb7, 0xdfab6f7f, 0x76d75fee},
+    {0xbdf77cb7, 0x7bfeeb7a, 0x54b7f9e9, 0xbed5f6b7},
+    {0xaf2d67fd, 0xa6b5ffed, 0xffdc9ebf, 0xcf7f2edd},
+    {0x6dfddf56, 0xffd734af, 0x92f7f7d6, 0x79a9fbbe},
+    {0xfad7f96f, 0xb57ef7f9, 0xff7b76fb, 0xdfbf6f73},
+    {0xd75e277b, 0x5eedddae, 0xb6ceddaf, 0x55f3b5af},
+    {0x7df3ffd9, 0xebaf7baf, 0xaebbd7ba, 0xf65cddfc},
+    {0xde9f55df, 0xf5f6cef9, 0xfbed7cf5, 0x7fdfb75f},
+    {0xb3fbf66e, 0x1ebbf69f, 0xb7b6dfdf, 0xd5f37ae5},
+    {0xfeca5ff2, 0xf6ed5be6, 0xad5fb6b5, 0xdd5ed7be},
+    {0x977ff95f, 0x77bffefd, 0xfdf3ebdf, 0x77efddbb},
+    {0xfdeb6fed, 0xdde5569b, 0x973e5f7a, 0xd56abaed},
+    {0xa55db37e, 0x577f7bfa, 0x76eff5d7, 0xffbfb7df},
+    {0xfff77f65, 0xfaabcd6f, 0xefdb6dbb, 0x95baed3a},
+    {0x54dbdadf, 0x57f77fb6, 0xb97baebe, 0xf766bbef},
+    {0xf7de6dde, 0xdebadaeb, 0x77a6fbe7, 0x9d7feb59},
+    {0xbdbbdf79, 0xf3dfd6fd, 0xdefeea7d, 0xf7d55eff},
+    {0xeeb6b3af, 0xbef2bf96, 0xab7bbfd6, 0x6dbb7766},
+    {0x6ddafeed, 0xc5dff6ff, 0xfeccb577, 0x9d6fddbd},
+    {0xaf6f95db, 0x7f5b2ee9, 0x5bffefdd, 0xf7f276ef},
+    {0xfb7b7fbe, 0xfdeefbbf, 0xeeb5b5d5, 0xbd5fbbbb},
+    {0x5bd5eaeb, 0x45b3dae6, 0xbb777d7f, 0xebebcf6e},
+    {0xeabf3fae, 0xff7e5fbf, 0xeddde7a9, 0x9f7d7af9},
+    {0x7ff2eb75, 0x6bddf55b, 0xb7ad5dbf, 0xf4dbb7af},
+    {0xd5bfddde, 0x9d57bff5, 0xb6fbf573, 0xb7d6fd6a},
+    {0x7b6cb6db, 0xf7f6d4df, 0xdd977fee, 0xfef68bbf},
+    {0xdeef77ee, 0xdb3d7fa9, 0xb7fd4c9d, 0x95bffeed},
+    {0x6bbbeb3b, 0x7ddfd5ff, 0x7d4af7f5, 0xfbcb6d6d},
+    {0xfedabef7, 0xabd37dab, 0xe7ffbb6f, 0x5f7b5bb7},
+    {0x4aef6ddd, 0xfeff5f7d, 0xbdadaeda, 0xfb5efefa},
+    {0xffb7eeb7, 0xa72b73cb, 0xed7bfbf6, 0x4af393ae},
+    {0x557aabec, 0xf9eddd7f, 0xdbca6f5f, 0xff9efe7d},
+    {0x7fcfff77, 0x5fbf7fd7, 0x7dffdb6d, 0xd5edabe7},
+    {0xe4fa65de, 0x5af5aaf4, 0xcf35befb, 0xaef5bb3d},
+    {0xbfbffabb, 0xf76efa9f, 0x79deb3b7, 0xfdbfeddb},
+    {0xb6d29fec, 0xdedb5ff5, 0xd7ebeedc, 0xdf556ed6},
+    {0xddeff66f, 0xb3bbe6ae, 0xff3ebdb7, 0xb2efb7fe},
+    {0x66bfadba, 0xfedf7dfb, 0x69e5ebef, 0xbfbadd4b},
+    {0xffa8bbdf, 0xa6f4975b, 0xdfbeb778, 0xeedbef7b},
+    {0x54ffefa9, 0x7faffbd7, 0xdaafdacf, 0x39eeb5de},
+    {0xf7b77abf, 0xd9fdb6bc, 0x77f55ffd, 0xef59ef6b},
+    {0x9ed5aaf6, 0x7fb5bfef, 0xbedbf357, 0xaf7f5d7b},
+    {0x77bfffb6, 0x466ee935, 0xeadf6eeb, 0xf8d7eacd},
+    {0xeaf56abb, 0xffdbbfff, 0xbf66fb7f, 0xefd93ffe},
+    {0xbddeb7ec, 0x7afad955, 0xabfccdcd, 0x9f7fd6ab},
+    {0xaf5bfd7f, 0xd75ed7fd, 0xddafbdfe, 0xf5dafafe},
+    {0x7dedb793, 0xbdb7fe97, 0xff7bf653, 0x5d6f4f49},
+    {0xcb3dadff, 0x75ed56fd, 0x49ee4fff, 0xebd5fbff},
+    {0xfde6f72c, 0xef7bd7ea, 0xffabf949, 0xbf7d9aad},
+    {0x5bbfbdfb, 0x5b5b7daf, 0xad7ebfff, 0xd99776f6},
+    {0x6f66cf6f, 0xdb7eeb7b, 0x75dbadb6, 0x6efeefeb},
+    {0xf57dfab3, 0xedd59db5, 0xefad76db, 0x7bd6dd5f},
+    {0x9dd75fbe, 0xbeef77df, 0xdcfbbdf6, 0xed5bb774},
+    {0x773af3d7, 0xe9bbdab5, 0xb79ee73d, 0xb7ed79ef},
+    {0xbbf75d79, 0x3f957fdb, 0xf6f77ee7, 0x7ebff7ae},
+    {0xeedb77af, 0xeeff557d, 0x9edad5dd, 0xaad54efa},
+    {0x56adcdf6, 0x6bdaffd7, 0xfbdfffbd, 0xff7df5b7},
+    {0xfdf77b5f, 0xfd6fd55d, 0x6b5a64e7, 0x2bb73f6d},
+    {0xa7bbdbd9, 0x577abefb, 0xfef7dfbd, 0xfedded7b},
+    {0xbed65eb6, 0xdfeed756, 0x979bb57b, 0xcafb77d6},
+    {0xfbfff6ff, 0xf45bf5fe, 0xfcfafdae, 0xfb4b9cbe},
+    {0xd72cadaa, 0x5ff75f57, 0xefefa7b5, 0xaffefbd7},
+    {0x5cf7ffbf, 0xf3dafbfb, 0x36babeff, 0xea4dced9},
+    {0xfbaeb4ea, 0x2e779aad, 0xf5aaedad, 0xbffebb7f},
+    {0x57bbdbdb, 0xefdeefb7, 0xaffff77b, 0xd4b3fde6},
+    {0x7eeebefe, 0x79bb7cef, 0xdc569daf, 0xffeece9f},
+    {0xd579e795, 0x6f67a7b9, 0xb7fbf7f3, 0xbb3b75f2},
+    {0x7fafbafb, 0xdffdfdef, 0xf6df695e, 0xadef5fbe},
+    {0xdad5b7b6, 0xb556d736, 0xaf72bfed, 0xefd9f5ab},
+    {0x5b7ebced, 0x7df77df5, 0xfddfed5b, 0xd93fdefe},
+    {0xffebe7df, 0xe75fceb7, 0xd65eaade, 0x3fed3566},
+    {0x8ab5bd7b, 0xbdf273de, 0xb7f2fff7, 0xe6adefdb},
+    {0xff5eef4a, 0xdb5fffad, 0xadb7973a, 0xfdf7f6fe},
+    {0x73f7b9ff, 0xffb9ad77, 0xfe6df9da, 0xb79d5e4d},
+    {0x9edd6f5a, 0xd2ef76ed, 0x57fe6eef, 0xaefddbf7},
+    {0xfaeb76ef, 0xbfafdfbb, 0x75b3d7ba, 0xf6e6fdbb},
+    {0x57bdbdeb, 0xd679396f, 0xdf6efad6, 0xadbf66d7},
+    {0xff67edbe, 0xededefd2, 0x6bbdbedf, 0x77b5defe},
+    {0xd9fe5775, 0xb7bf6aff, 0xdee7d772, 0xdb7b7b55},
+    {0x6f5dfdaf, 0xfdab7b56, 0xf5ba5adf, 0xddd6ef7b},
+    {0xdbd7d5fa, 0xa6fbaf7d, 0xb7dbfff6, 0x777db5de},
+    {0x6cb95f6f, 0xfddedad7, 0xdc5f6b2d, 0xdd6fbdea},
+    {0x7fffe9b5, 0x9b737bfd, 0xeff6eefe, 0x7bddef3f},
+    {0xcb4d7fbd, 0xeddfdf57, 0x36d9bd93, 0xacd72deb},
+    {0xfefbaad7, 0xef7535fa, 0xfb6febfe, 0xefbdfbbd},
+    {0x76adf6fa, 0xddafef2d, 0xaeda5eda, 0xb5eb5ed6},
+    {0xb7df5dbf, 0xb77addf7, 0xf7f7fadb, 0xff6ed7ee},
+    {0xd6f3bbd2, 0xb4cf7bde, 0xdb2ea76d, 0xcebbf93b},
+    {0xfb5d6f5f, 0xfff9ad69, 0xb6edbd7f, 0xb3eeafeb},
+    {0x5f7fedfa, 0xdb5ff7bf, 0xbdfaebc8, 0xfd2bdabc},
+    {0xe9eb5b67, 0x6d6adb7b, 0xf6afdf7f, 0x2dfd7fdf},
+    {0xbeaef7bd, 0xeffeddcc, 0x5df4b557, 0xffe6d36b},
+    {0xd7fb2df7, 0xbab3b777, 0x777fbbfc, 0x625f6eff},
+    {0xad9bfd5b, 0xd7df5dae, 0xdb4adf6f, 0xfff9faa5},
+    {0xfeeed7ee, 0xfd7cf6f5, 0xddfff4f5, 0x9b6f5ffd},
+    {0x6dbb7d75, 0x27a7edbf, 0x76b6af9d, 0xfbb76a97},
+    {0xd5deeb6f, 0xfefa5bca, 0xd7def9f7, 0x4ed9f7fa},
+    {0xef6bbbd9, 0x96cffd7e, 0xbcb3afb6, 0xfaef9d6f},
+    {0x7b7adebf, 0xfb7d57eb, 0xd7f6ecbd, 0x9f6ef6da},
+    {0xdbd7f7e6, 0x6db3fcaf, 0x765eb7f7, 0x79bbdbef},
+    {0x6d6ead7f, 0xeedf6ffd, 0x5ff3bdae, 0xefed6bbb},
+    {0x6fbb77ad, 0xbbfcad67, 0xe95f6b75, 0x56bfbe5d},
+    {0xf6fbdadd, 0x764ff5bb, 0xbef6efdf, 0xfde6cdf7},
+    {0x5daebf77, 0xdff537ee, 0x67adbcb2, 0xb5b6fbcd},
+    {0xeb7b69ea, 0xe937dd5d, 0xfdf7a7df, 0xb75db6bb},
+    {0xbbd7df2f, 0x7fdcfdf7, 0x9db6fe6e, 0xedf7f6fe},
+    {0x6ebd6dfd, 0xd5efa7ad, 0xe6dbebeb, 0x5ead2ee5},
+    {0x7dd7bb57, 0x7f356cf7, 0xfefd37bb, 0x73fbfb5e},
+    {0xcb7d776b, 0xf5fdffdd, 0x9bb7de76, 0xddb75bb7},
+    {0x7fd7eefd, 0x974f556d, 0xedab73df, 0x6eadfd7a},
+    {0xea7a5d95, 0xfef5dfbb, 0xb77edf75, 0xf3f7a7cf},
+    {0x5faff7ff, 0xb59e76ef, 0xddcdf55e, 0x5ebd7d76},
+    {0xf5f55576, 0xddf7dd5c, 0xeef7b7eb, 0xaedde7bb},
+    {0xef5fffdb, 0xb755afeb, 0x7bba5db6, 0xfbeb7cee},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(24)
+  {  // level 24: redness 192
+    {0x3df555b5, 0xfafef93f, 0xaf6bfedf, 0x56b74bdf},
+    {0xf77fb6ff, 0xafefdffb, 0xfdff57f5, 0xfdfdfef5},
+    {0xaddaffaa, 0x7abad54e, 0x2aedfb7f, 0x975edb5f},
+    {0xdb5fb3bf, 0xcfef7ffb, 0xffab7ed6, 0xfdeb77fb},
+    {0x7ef6eefa, 0xfcbff36f, 0xad7ecfbf, 0xb77feddd},
+    {0xebbbbf4f, 0xbbe95f5d, 0x77f5f5fa, 0xeda55f67},
+    {0x2eefedfb, 0xefdff6f7, 0xfe4f7f96, 0x3fffedfd},
+    {0xfbb937ef, 0xbd35b7b5, 0x53fedaff, 0xeab5b7b7},
+    {0x6feffd39, 0xe5fdddbf, 0xffb5f7e9, 0x7bdf7a6d},
+    {0xfcbeb7ef, 0x7fcf6edd, 0xb56fb6bf, 0xeeeb6ffb},
+    {0xd7f3edbd, 0xdf7afbf7, 0xfffeff76, 0xb77ddf5e},
+    {0x6add7fdb, 0x7557ad5a, 0xa92b95ef, 0xbddf75f7},
+    {0xff6fd57e, 0xdfffbf7f, 0xdff6ff6e, 0xff6bbfbd},
+    {0x5ffd7b6b, 0xf4f9f3ed, 0xf6fed5b5, 0xcbfee9b6},
+    {0xf35bdfdd, 0x5f8f9eb7, 0xdfab6f7f, 0x76d75fee},
+    {0xbdf77cb7, 0xfbfeeb7a, 0x75bffbe9, 0xbeddf6b7},
+    {0xef2d67fd, 0xa6b5ffef, 0xffdc9ebf, 0xefffaedd},
+    {0x6dfddf56, 0xffd736af, 0x92f7f7d6, 0x79a9fbfe},
+    {0xfbd7f9ef, 0xb57ef7f9, 0xff7b76fb, 0xdfbf6f73},
+    {0xd75eaf7b, 0x5eedddbe, 0xb6ceddaf, 0x5df7b5af},
+    {0x7df3ffdb, 0xefaf7baf, 0xeefbd7ba, 0xf65cddfc},
+    {0xdebf55df, 0xf5f6def9, 0xfbef7cf7, 0x7fdff75f},
+    {0xb3fbf66e, 0x5ebbf6bf, 0xb7b6dfdf, 0xd5f37ee5},
+    {0xfece5ff3, 0xf6ed5be6, 0xad5fb6b5, 0xdd5ed7be},
+    {0x977ffd5f, 0x77bffefd, 0xfdf3fbdf, 0x7fefddbb},
+    {0xfdeb6fed, 0xdde5579f, 0xb7be5f7a, 0xd56afaed},
+    {0xad5db37e, 0x777f7bfa, 0x76eff5d7, 0xffbfb7df},
+    {0xfff77f65, 0xfaabed6f, 0xefdb7dbb, 0x95faed7a},
+    {0x56dbdbdf, 0x5fff7fbe, 0xbd7bafbe, 0xf766bfef},
+    {0xf7de6dde, 0xdebadaeb, 0x77aefbe7, 0xbd7feb5b},
+    {0xbdbbff79, 0xf3dfd6fd, 0xdefeea7d, 0xf7dd5eff},
+    {0xeef7b3af, 0xbef2bf96, 0xab7bbfd6, 0x6dbbf7e6},
+    {0x7ddafefd, 0xd5dff6ff, 0xfecdb57f, 0xbd6fddbd},
+    {0xaf6f95db, 0x7f5b6ee9, 0x5bffefdd, 0xf7fa76ef},
+    {0xfb7b7fbe, 0xfdfefbbf, 0xeeb5b5d5, 0xbd5fbbbb},
+    {0x5bddeaeb, 0x45b3dae6, 0xbb777d7f, 0xebebef6e},
+    {0xeebfbfbe, 0xff7f5fff, 0xedddefed, 0xbf7d7afd},
+    {0x7ff2eb75, 0x7bddf55b, 0xbfaf5dbf, 0xf6dfb7ef},
+    {0xd5bfddde, 0x9d57bff5, 0xf6fbf773, 0xb7d6fd6a},
+    {0x7b6dbedb, 0xf7f6d4df, 0xddb77fee, 0xfef6cbbf},
+    {0xdeef77ee, 0xdb7d7fad, 0xb7fdccbd, 0x95bfffed},
+    {0x6bbbeb3b, 0x7ddfd5ff, 0x7d4af7f7, 0xfbeb6d6d},
+    {0xffdabff7, 0xabd37dab, 0xe7ffbb6f, 0x5f7b5bb7},
+    {0x4aff6ddd, 0xfeffdf7d, 0xbdadaeda, 0xfbdefefb},
+    {0xffb7feb7, 0xaf3b73db, 0xef7bfbf6, 0x4af7d3ae},
+    {0x557aabee, 0xf9eddd7f, 0xdbce6f5f, 0xff9efe7d},
+    {0x7fcfff77, 0xdfbf7fd7, 0x7dffdb6d, 0xf5edafe7},
+    {0xe6fa6dde, 0x5af5aaf5, 0xcf35fefb, 0xaef5bb7d},
+    {0xbfbffabb, 0xf76ffbbf, 0x7ddeb7b7, 0xfdbfeddb},
+    {0xb6d29fee, 0xdedb5ff5, 0xd7ebeedc, 0xdfd57ed7},
+    {0xddfff6ef, 0xbbfbe6ae, 0xff3ebdb7, 0xb2efb7fe},
+    {0x76bfedba, 0xfedf7dff, 0x69f5ebef, 0xbfbadd6b},
+    {0xffa8bbdf, 0xa6f4d75b, 0xdfbebf79, 0xeedfef7b},
+    {0x55ffefe9, 0x7faffbf7, 0xdaafdacf, 0xb9eeb5de},
+    {0xf7b77abf, 0xd9fdb6bc, 0x77f55ffd, 0xef59ff6b},
+    {0xded5aef6, 0x7fb7bfef, 0xbedbfb57, 0xafff5dff},
+    {0x77bfffb6, 0x666ee935, 0xeaff6efb, 0xf8d7eacd},
+    {0xeaf56abf, 0xffdbbfff, 0xbf66fb7f, 0xefd97ffe},
+    {0xbddfb7ec, 0x7afadb55, 0xebfdcfcd, 0xbf7fd6ab},
+    {0xef7bfd7f, 0xd75ed7fd, 0xddafbdfe, 0xf5dafbfe},
+    {0x7dedb7d3, 0xbfb7fe97, 0xff7bf653, 0x5d6f4f4b},
+    {0xcb3dadff, 0x75ed76fd, 0x49ee4fff, 0xebf7fbff},
+    {0xfdf6f72c, 0xef7bd7ee, 0xffabf94d, 0xbf7dbead},
+    {0x5bbfbdfb, 0x7bdb7daf, 0xad7ebfff, 0xdb9776fe},
+    {0x6f66cf6f, 0xdb7eef7b, 0x7ddbedb6, 0x6efeefeb},
+    {0xf5fdfaf3, 0xefd5ddb5, 0xefef76db, 0x7bd7dd5f},
+    {0xdddf5fbe, 0xbeef77ff, 0xdcfbbdf6, 0xed7bb774},
+    {0x773af7d7, 0xe9bbdab5, 0xb79ee7bd, 0xb7ed7def},
+    {0xbbf7dd7d, 0xbfb57fdf, 0xf6f77ef7, 0x7ebff7af},
+    {0xeedf77af, 0xeeffd57d, 0x9edad5dd, 0xabd55efa},
+    {0x5eadddf6, 0x6bdaffd7, 0xfbdfffbd, 0xff7ff5b7},
+    {0xfdf77b7f, 0xfd6fd5dd, 0x6b7a6ce7, 0xabb73fed},
+    {0xa7bbdbd9, 0x577abefb, 0xfef7dfbd, 0xfedded7f},
+    {0xbed6deb6, 0xdfeed756, 0x979fb5fb, 0xcbfb77d6},
+    {0xfbfff7ff, 0xf55bf5fe, 0xfcfafdaf, 0xfb5bddbe},
+    {0xd72cadaa, 0x5fff5f57, 0xefefb7b5, 0xbffefbf7},
+    {0x5df7ffbf, 0xf3dafbfb, 0x36bbbeff, 0xea4dced9},
+    {0xfbbeb6ee, 0x3e77dabd, 0xfdaaedad, 0xbffebb7f},
+    {0x57bbdbdb, 0xefdeefb7, 0xaffff77b, 0xd5bbffe6},
+    {0x7eeebefe, 0x79bb7def, 0xfd569daf, 0xffeecebf},
+    {0xd57def95, 0x6f6fa7b9, 0xb7fbf7fb, 0xbb3bf5f2},
+    {0x7fefbaff, 0xdffdfdef, 0xf6df6d5f, 0xadef5fbf},
+    {0xdad5f7b6, 0xb556d73f, 0xaf72bfed, 0xefd9f5ab},
+    {0x5b7ebeed, 0x7ff77df5, 0xfddfed7b, 0xf97fdffe},
+    {0xffefe7df, 0xe75fdeb7, 0xd6deeade, 0x3fed356e},
+    {0xaaf5bd7b, 0xbdf673fe, 0xf7f2fff7, 0xe6bdefdb},
+    {0xff5eefca, 0xdb5fffad, 0xadbf973a, 0xfdf7f6fe},
+    {0x73f7b9ff, 0xfff9ad77, 0xfe6dfdde, 0xb79d5f4d},
+    {0x9eddef5a, 0xd2ef77ed, 0x57ff6eef, 0xaeffdbff},
+    {0xfaef76ef, 0xbfafdfbb, 0x75b3d7ba, 0xf6e6fdbb},
+    {0x57bdbfeb, 0xd6f9b96f, 0xff6efaf6, 0xbdbf66d7},
+    {0xff67edbe, 0xfdedefda, 0x6bbdbfdf, 0xf7b5dffe},
+    {0xd9fe5775, 0xb7bf6eff, 0xdeefd772, 0xdb7f7b57},
+    {0x7f5dfdaf, 0xfdab7bd6, 0xf5badadf, 0xddd6ef7b},
+    {0xdbf7ddfa, 0xa6fbef7d, 0xb7dbfff6, 0x777db5de},
+    {0xecbb5f6f, 0xffdedad7, 0xdd5f6b6d, 0xdf6fbdea},
+    {0x7fffe9b7, 0xbb737bfd, 0xeff6eefe, 0x7bddef3f},
+    {0xcb4d7ffd, 0xeddfdf57, 0x36ddbd93, 0xacf76deb},
+    {0xfefbaed7, 0xef7575fa, 0xfb6febfe, 0xefbdfbbd},
+    {0x76edf6fa, 0xddbfef2f, 0xaeda5ede, 0xb5eb5ed7},
+    {0xb7df5dbf, 0xb7faddf7, 0xf7f7fbdb, 0xff6ed7fe},
+    {0xdef3fbd2, 0xb4cf7bde, 0xdb3fb76d, 0xdebbfd3b},
+    {0xfb5d6f5f, 0xfffbad69, 0xb6edbd7f, 0xb3eeafeb},
+    {0x5f7ffdfa, 0xdb5fffbf, 0xbffaebea, 0xff3bdabc},
+    {0xebeb5b6f, 0x6d6adb7b, 0xf6afdf7f, 0xadfd7fdf},
+    {0xbeaef7bd, 0xfffeddcc, 0x5df5b557, 0xffe7db6b},
+    {0xf7fbadf7, 0xbab3f77f, 0x777fbbfc, 0x6a5f6eff},
+    {0xadbbfd5b, 0xd7df5dae, 0xdbcadf6f, 0xfff9fbad},
+    {0xfeeed7ee, 0xfd7cf6f5, 0xddfff4f5, 0x9b6f5ffd},
+    {0x6dbb7f7d, 0x37afefbf, 0x7eb6af9f, 0xfbbf6a97},
+    {0xdddeeb6f, 0xfefb5bdb, 0xd7defdf7, 0x4ed9fffa},
+    {0xef6bbbd9, 0x96cffd7e, 0xbdb3afb6, 0xfbef9d6f},
+    {0x7b7edebf, 0xfbfd57eb, 0xf7feecbd, 0xdf6ef6da},
+    {0xdbd7f7e6, 0x6db3fdaf, 0x765ef7f7, 0x79bbdbef},
+    {0x7d6ebd7f, 0xeedf6ffd, 0x5ff3bdae, 0xefed7bbb},
+    {0x6fbb77ed, 0xbbfdad6f, 0xeb5f6b7d, 0x56bfbf5d},
+    {0xf6fbdadd, 0x764ffdbb, 0xbef6efdf, 0xfdf6cdf7},
+    {0xddaeff77, 0xdffd37ee, 0x67adbcb2, 0xb7b6fbdd},
+    {0xef7b6bfa, 0xe977dd5d, 0xfdffb7ff, 0xb75dbebb},
+    {0xbbd7df2f, 0x7fdcfdf7, 0xbdb6fe6e, 0xedf7f7fe},
+    {0x6efd6dfd, 0xd5efb7bd, 0xe7dbebeb, 0x7ead2ee5},
+    {0xfdd7bbd7, 0x7f376cf7, 0xfefd37bf, 0x77fbfb5e},
+    {0xcb7d776f, 0xf5fdffdd, 0x9bb7de76, 0xddbf5bf7},
+    {0x7fd7eefd, 0x97cf556d, 0xfdeb7bdf, 0x6eadfd7a},
+    {0xeafb5d95, 0xfef5dfbb, 0xb77edff5, 0xfbf7a7df},
+    {0x5faff7ff, 0xb5bef6ef, 0xddcdf55e, 0x5ebd7d76},
+    {0xf5f55d76, 0xdff7dddc, 0xeef7b7fb, 0xeedfefbb},
+    {0xef5fffdf, 0xb755afeb, 0x7bbeddb6, 0xfbeb7eee},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(25)
+  {  // level 25: redness 200
+    {0x3df5d5b5, 0xfafefb3f, 0xaf6bfedf, 0x56b76bdf},
+    {0xf77fbeff, 0xefefdffb, 0xfdff57f5, 0xfffdfef5},
+    {0xbddaffaa, 0x7abad56e, 0x6bedfb7f, 0xd75fdb5f},
+    {0xdbdfb3ff, 0xcfef7ffb, 0xffbb7ed6, 0xfdeb77fb},
+    {0x7ef6eefa, 0xfebffb6f, 0xad7fcfbf, 0xb77feddd},
+    {0xefbbbf4f, 0xbbe95fdd, 0x77f5f5fa, 0xedad7f6f},
+    {0x6eefedfb, 0xeffff6ff, 0xfe6f7f97, 0x7fffedfd},
+    {0xfbb9b7ef, 0xbd37b7b5, 0x57fedaff, 0xeab5b7b7},
+    {0x6feffd7d, 0xedfdfdff, 0xffb5ffe9, 0x7fff7aed},
+    {0xfcbeb7ef, 0x7fef6edd, 0xb56fb6bf, 0xeeebeffb},
+    {0xdff7edbd, 0xdf7afbf7, 0xfffefff6, 0xb77ddf5e},
+    {0x6add7fdb, 0xf557addb, 0xab2b95ef, 0xbddf75f7},
+    {0xff6fd57e, 0xdfffbf7f, 0xfff7ff7e, 0xff6bbfbd},
+    {0x5ffd7beb, 0xf6f9fbed, 0xf6fef5b5, 0xdbfeedb6},
+    {0xf35bdfdf, 0x5fafbebf, 0xdfab6f7f, 0x76d77fff},
+    {0xbdf77cb7, 0xfbfeebfa, 0x75fffbed, 0xbeddf6b7},
+    {0xef2f77fd, 0xaebdffef, 0xffdd9ebf, 0xefffaedd},
+    {0x6dfddf56, 0xffd7b6af, 0xd6f7f7d6, 0xf9a9fbfe},
+    {0xfff7f9ff, 0xf5fef7f9, 0xff7b76fb, 0xdfbf6f77},
+    {0xd75eaf7b, 0x5eedddbf, 0xb6dedfef, 0x5df7bdaf},
+    {0x7df3ffdb, 0xefbf7baf, 0xeefbf7ba, 0xf6ddddfc},
+    {0xdfbf55df, 0xf5f6dff9, 0xfbef7cf7, 0x7fdff75f},
+    {0xb3fbf77e, 0x5fbbf6bf, 0xbfb6dfdf, 0xd5f37ee5},
+    {0xfecedff3, 0xf6ed5be6, 0xad7fb6f5, 0xdf5ed7ff},
+    {0xb77ffd5f, 0x7fbffefd, 0xfdf3fbdf, 0x7fffddbb},
+    {0xffeb6fed, 0xddedd79f, 0xb7be5f7b, 0xd56afeed},
+    {0xad5dbb7f, 0x777f7bfa, 0xf6eff5d7, 0xffbfb7df},
+    {0xffffff75, 0xfbabed6f, 0xefdb7dfb, 0x9dfbed7a},
+    {0xd6dbdbdf, 0xdfff7fbe, 0xbd7bafbe, 0xf766bfef},
+    {0xf7de6dde, 0xdebadbeb, 0x77affbef, 0xbdfffb5b},
+    {0xbdbbff7b, 0xf3dff6fd, 0xdefeee7d, 0xf7dd5eff},
+    {0xeeffb7af, 0xbef6bfb7, 0xebfbbfd6, 0x6dbbf7f6},
+    {0x7ddafefd, 0xd7dff6ff, 0xfecdb57f, 0xbf6fddbd},
+    {0xaf6fd5db, 0x7f5b6ee9, 0x5bffffdd, 0xf7faf6ef},
+    {0xfbfb7fbe, 0xfdfeffbf, 0xfeb5b7d7, 0xbd5fbbbb},
+    {0xdbddeaeb, 0x47b3daee, 0xbbff7d7f, 0xebebef6e},
+    {0xeebfbfbe, 0xff7f5fff, 0xedddefed, 0xbf7d7efd},
+    {0x7ff2eb77, 0x7bddf55b, 0xbfaf5dbf, 0xf6dfb7ef},
+    {0xd5bfddde, 0xdd77bff5, 0xf6fbf77b, 0xb7f6fd6a},
+    {0x7fedbefb, 0xf7f6d6ff, 0xddb77fee, 0xfef6dbbf},
+    {0xdeef77ee, 0xdf7dffad, 0xb7fdccbd, 0xddbfffed},
+    {0x6bbbeb3b, 0x7ddfd5ff, 0x7d6efff7, 0xfbeb6d7f},
+    {0xffdbbff7, 0xabd37dab, 0xefffbb7f, 0x5f7bdbb7},
+    {0x5aff6ddd, 0xfeffdf7d, 0xbdadeedb, 0xfbdefffb},
+    {0xffb7feb7, 0xafbb77db, 0xef7bfbf6, 0x4ef7dbae},
+    {0x557aabfe, 0xf9eddd7f, 0xdbee6f5f, 0xffbefefd},
+    {0x7fdfff77, 0xdfbfffd7, 0x7dffdbed, 0xf5edafef},
+    {0xf6fb6dde, 0x7bf5aafd, 0xef35feff, 0xaef7bb7d},
+    {0xbfbffbbb, 0xf76ffbbf, 0x7dfeb7b7, 0xfdbfeddb},
+    {0xf6d29fee, 0xdedb5ff5, 0xd7ebeedc, 0xdfd57ed7},
+    {0xddfff6ef, 0xbbfbf6ae, 0xff3fbdb7, 0xf2ffb7fe},
+    {0x76fffdba, 0xfedf7dff, 0x6df5ebff, 0xbfbafd6f},
+    {0xffaabbdf, 0xa6f6d75b, 0xfffeff79, 0xefdfeffb},
+    {0x55ffefed, 0xffaffff7, 0xdaafdacf, 0xb9eeb5de},
+    {0xffb77abf, 0xd9fdb6bd, 0x77fd5ffd, 0xff7bff6b},
+    {0xdeddaff6, 0x7fb7bfef, 0xbedbfb57, 0xafff5fff},
+    {0x77bfffb6, 0x66eee9b5, 0xebff6efb, 0xfad7eadd},
+    {0xeef56abf, 0xffdbbfff, 0xbf66fb7f, 0xefdd7ffe},
+    {0xbddfbfed, 0x7afbfb55, 0xebfddfcd, 0xbf7fd6ab},
+    {0xef7bfd7f, 0xd77ed7ff, 0xddafbdff, 0xf5dafbfe},
+    {0x7dedb7d3, 0xbfb7feb7, 0xff7bf753, 0x5f6f5f6b},
+    {0xcfbfbdff, 0x75ed76fd, 0x6bee6fff, 0xebf7fbff},
+    {0xfdf6f7ae, 0xef7fd7ee, 0xffbbf96d, 0xbf7dbead},
+    {0xdbbfbdfb, 0x7bdb7daf, 0xad7ebfff, 0xfbd776ff},
+    {0x6f66ef6f, 0xdb7feffb, 0x7ddbefb6, 0x6efeefeb},
+    {0xfdfdfafb, 0xefd5ddb5, 0xefef76df, 0x7fd7dddf},
+    {0xdddf5fbe, 0xbeff77ff, 0xdcfbbdf6, 0xed7bb774},
+    {0x77baf7d7, 0xebbbdab5, 0xb79eefbd, 0xb7ed7dff},
+    {0xbbf7dd7d, 0xbfb77fdf, 0xf7f77ef7, 0xfebff7af},
+    {0xeedf77af, 0xeeffd57d, 0xbefbd5dd, 0xabf55efa},
+    {0x5eedddf6, 0x6bdaffd7, 0xfbdfffbf, 0xff7ff5bf},
+    {0xfdff7f7f, 0xfdefd5dd, 0x6b7a6ce7, 0xabb7bfed},
+    {0xe7bbdbdd, 0x777bbeff, 0xfef7ffbd, 0xfedded7f},
+    {0xbed6deb6, 0xdfeef7d6, 0xd79fb7fb, 0xdbfb77d6},
+    {0xfbfff7ff, 0xf55bf5fe, 0xfdfafdaf, 0xfb5bddbe},
+    {0xdf6cadea, 0x5fff5f57, 0xefefb7f5, 0xbffefbf7},
+    {0x5df7ffbf, 0xfbdafffb, 0x36bbbeff, 0xeacfeedb},
+    {0xfbbef6ee, 0xbe77dabd, 0xfdbaedad, 0xbffebb7f},
+    {0xd7bbdbdb, 0xefdeefb7, 0xaffff7fb, 0xd5bbffe6},
+    {0x7eeebefe, 0x79fb7dff, 0xfd56bdaf, 0xffeedebf},
+    {0xd77defb5, 0x6f6fb7b9, 0xb7fbf7fb, 0xbb7bf5fa},
+    {0x7fefbaff, 0xfffdfdef, 0xf6df6d5f, 0xedef5fbf},
+    {0xfad5f7b6, 0xb55ed7bf, 0xaf76bfed, 0xefd9f5ab},
+    {0x5b7ebeed, 0xfff77df5, 0xfddfef7b, 0xfd7fdffe},
+    {0xffeff7df, 0xe75fdeb7, 0xd6deeade, 0x3fef356e},
+    {0xaaf5bd7b, 0xbdf6f3fe, 0xfff2fff7, 0xe6bdffdb},
+    {0xff5eefda, 0xdb5fffad, 0xadbf977a, 0xfdf7f6fe},
+    {0x77f7bdff, 0xfff9ad7f, 0xfeedfdde, 0xb79d5f6d},
+    {0xdeddef5a, 0xdaef77ed, 0xd7ff7eef, 0xbeffdbff},
+    {0xfaef76ff, 0xbfafffbb, 0x7dbbd7bb, 0xf7e6fdbb},
+    {0x57fdbfeb, 0xd6fdb97f, 0xff6efaf6, 0xbdbf76d7},
+    {0xff67edbe, 0xfdedefda, 0x6bfdbfdf, 0xf7b5dffe},
+    {0xd9fe7775, 0xb7bf6eff, 0xdeeff77a, 0xdbff7b77},
+    {0x7f5dfdbf, 0xfdab7bd7, 0xfdbadadf, 0xddd7ef7b},
+    {0xdbf7dffa, 0xaefbef7d, 0xb7fbfff6, 0xf77db7de},
+    {0xeebb7f6f, 0xffdeded7, 0xfd5f6b6f, 0xdf6fbdeb},
+    {0x7fffe9b7, 0xbb777bfd, 0xeff6eefe, 0x7bddef7f},
+    {0xdb4d7ffd, 0xeddfdf57, 0x36ddbfb3, 0xbef76deb},
+    {0xfeffaed7, 0xef7575fa, 0xfb7febfe, 0xefbdfbbd},
+    {0x76edf6fa, 0xfdbfefbf, 0xaedadede, 0xb5ef5ed7},
+    {0xb7df5fbf, 0xb7faddf7, 0xfff7fbfb, 0xff6ef7fe},
+    {0xdef7fbf6, 0xb6cf7bde, 0xdbbfb76d, 0xdefbfd3b},
+    {0xfbdd6f5f, 0xfffbad6b, 0xb6edbf7f, 0xb3eeafeb},
+    {0x5f7ffdfa, 0xdb5fffff, 0xbffaebea, 0xff3bfafd},
+    {0xebeb5b6f, 0x6deadb7b, 0xf6afff7f, 0xadfd7fdf},
+    {0xbeaeffbd, 0xfffeddcd, 0x5dfdb757, 0xffefdb6b},
+    {0xf7ffadf7, 0xbab7f7ff, 0x777fbbfd, 0x6b5f6eff},
+    {0xadbbfd5b, 0xd7df5dae, 0xfbcadf6f, 0xfff9fbad},
+    {0xffeed7ee, 0xfdfcf6f5, 0xddfff5f5, 0x9b6fdffd},
+    {0x6dbb7f7d, 0x37afffbf, 0x7eb6afbf, 0xfbbf6ad7},
+    {0xddffeb6f, 0xfefb5bdb, 0xd7fffdf7, 0x6ed9fffb},
+    {0xef6bbbfb, 0xd6dffd7e, 0xbdb3afb6, 0xfbff9f7f},
+    {0x7b7edebf, 0xfffd57eb, 0xf7feedbd, 0xdf6ef6da},
+    {0xdbf7f7e6, 0x6db3fdaf, 0xf65efff7, 0x79bbdbef},
+    {0x7d6ebd7f, 0xeedf6ffd, 0x5ff3bdaf, 0xefed7bbb},
+    {0x6fbb77ed, 0xbbfdad6f, 0xfbdfeb7d, 0x5ebfff7d},
+    {0xf7ffdadf, 0xf74fffbb, 0xbefeefdf, 0xfdf6cdf7},
+    {0xddaeff77, 0xdffdb7ee, 0x67adbdb2, 0xb7b7fbdf},
+    {0xef7b6bfa, 0xed77dd5d, 0xfdffb7ff, 0xf77dbebb},
+    {0xbbdfdf2f, 0x7fdcfdf7, 0xbdb6fe6e, 0xedf7f7fe},
+    {0x6efd6dfd, 0xd5efb7bd, 0xe7dbebeb, 0x7ead6ee7},
+    {0xffd7fbd7, 0x7f376ef7, 0xfeff77bf, 0x77fbfb5e},
+    {0xcb7d7f7f, 0xfdfdffdd, 0xdbb7def6, 0xddbf5ff7},
+    {0x7fd7eefd, 0x97df556f, 0xfdeb7bdf, 0x6eedfd7a},
+    {0xfafb5d97, 0xfef5fffb, 0xb77edff5, 0xfbf7a7df},
+    {0x5fbff7ff, 0xf5bef6ef, 0xddddf55e, 0x5fbd7df6},
+    {0xf5f55d76, 0xdff7ddde, 0xeef7b7fb, 0xeedfefbb},
+    {0xef5fffdf, 0xb75dafeb, 0xfbbeddb6, 0xfbfb7eee},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(26)
+  {  // level 26: redness 208
+    {0xbff5d5f5, 0xfefefbbf, 0xaf6bfedf, 0x5eb76bdf},
+    {0xf77fbeff, 0xefeffffb, 0xfdff57f5, 0xfffdfff5},
+    {0xfddaffae, 0x7afad56e, 0x6feffbff, 0xd75fdb5f},
+    {0xdbffb3ff, 0xefef7ffb, 0xffbb7ed6, 0xfdeb7ffb},
+    {0x7ef6fefa, 0xfebffb6f, 0xad7fdfbf, 0xbfffeddd},
+    {0xefbfbf5f, 0xbbed5fdd, 0xf7f5f5fa, 0xedad7f6f},
+    {0x6eefedfb, 0xeffff6ff, 0xfeef7fb7, 0x7fffedfd},
+    {0xfbb9b7ef, 0xbf37bfb7, 0x57ffdaff, 0xeab5bfb7},
+    {0x6feffd7d, 0xedfdfdff, 0xffb5ffed, 0x7fff7aef},
+    {0xfdbebfef, 0x7fef6edd, 0xb5efb6bf, 0xeeefeffb},
+    {0xdff7edbd, 0xdf7efff7, 0xfffefff6, 0xf7fdff5e},
+    {0x6afd7fdb, 0xf5d7eddb, 0xab3bd5ef, 0xbddf75f7},
+    {0xff6fdd7e, 0xdfffbf7f, 0xfff7ff7e, 0xff6bbffd},
+    {0xdffdfbeb, 0xf6f9fbed, 0xf6fefdb7, 0xdbffedb6},
+    {0xf75bdfff, 0x7fafbebf, 0xdfab6fff, 0x76d77fff},
+    {0xbdff7db7, 0xfbfeebfa, 0x75fffbed, 0xbefdf6b7},
+    {0xff6f77fd, 0xaebdffef, 0xffddbebf, 0xefffbfdd},
+    {0x6dfddf56, 0xffd7b6bf, 0xd6f7f7de, 0xfbadfbfe},
+    {0xfff7fbff, 0xf5fefff9, 0xff7b76fb, 0xdfbf6f77},
+    {0xd75eaf7b, 0x5eedddff, 0xb7dfdfef, 0x7df7fdef},
+    {0x7df7ffdb, 0xffbf7baf, 0xeefbf7be, 0xf6dddffc},
+    {0xffbf5ddf, 0xf5f7dff9, 0xfbef7ef7, 0x7ffff75f},
+    {0xb7fbf77e, 0x5fbffebf, 0xbfbedfdf, 0xd5f77ef5},
+    {0xfeeedffb, 0xf6ed5bef, 0xaf7fb6f5, 0xff5ef7ff},
+    {0xb77ffd5f, 0x7fbffefd, 0xfdf3fbdf, 0x7fffddbb},
+    {0xffeb6fed, 0xddedd7df, 0xb7bedf7b, 0xd5eaffed},
+    {0xad5dbbff, 0x777f7ffa, 0xfeeff7df, 0xffbfb7df},
+    {0xffffff75, 0xfbebed6f, 0xeffb7dfb, 0xbdfbed7a},
+    {0xdefbdbdf, 0xdfff7fbe, 0xbd7bafbe, 0xf76ebfff},
+    {0xf7df6dde, 0xdebbdbef, 0x77affbef, 0xbdfffb5b},
+    {0xbdbbff7b, 0xfbdff6fd, 0xfefeeefd, 0xffdd5eff},
+    {0xefffb7ef, 0xbef6bfb7, 0xeffbffd7, 0xedfbf7f6},
+    {0x7ddafefd, 0xd7fff6ff, 0xfeddb57f, 0xbf6fddbd},
+    {0xaf6fd7db, 0x7f5b6fed, 0x5bfffffd, 0xf7faffef},
+    {0xfbfb7fbf, 0xfdfeffbf, 0xfeb5b7d7, 0xbd7fbbfb},
+    {0xdbddeaeb, 0x57b7daee, 0xbbfffd7f, 0xefebef6f},
+    {0xfebfbffe, 0xffff7fff, 0xedddefed, 0xbf7d7efd},
+    {0x7ff6fb77, 0x7bddf75b, 0xbfbf5dbf, 0xf6dfb7ef},
+    {0xd5bfdfde, 0xdd77bff7, 0xf6fbf77b, 0xb7f7ff7a},
+    {0x7fedbefb, 0xf7f6d6ff, 0xdfb77fee, 0xfef6dbbf},
+    {0xfeff77ee, 0xdf7dffad, 0xf7fdedbd, 0xdfbfffed},
+    {0x6bbbfb3b, 0x7ddfddff, 0x7d6efff7, 0xfbef6d7f},
+    {0xffdbbfff, 0xebdb7deb, 0xefffbb7f, 0x5f7bdbb7},
+    {0x5aff6ddd, 0xfeffdf7f, 0xbdadeedb, 0xfbdefffb},
+    {0xffb7ffb7, 0xafbb77db, 0xff7bfbf6, 0x6ef7dbae},
+    {0xd5faabfe, 0xfdeddd7f, 0xdbee7f7f, 0xffbefefd},
+    {0x7fdfff77, 0xdfbfffd7, 0x7dffdbed, 0xf5edefef},
+    {0xf6fb6dde, 0x7bf5aefd, 0xefb7feff, 0xaeffbb7f},
+    {0xbfbffbbb, 0xf77ffbbf, 0x7dfeb7b7, 0xffbfefdb},
+    {0xf6d6dfee, 0xdedb5ff5, 0xd7ebfefe, 0xdfd57ef7},
+    {0xdffff6ff, 0xbbfbf6ef, 0xff3fbfb7, 0xf2ffb7fe},
+    {0x76ffffba, 0xffdf7dff, 0x6df5ebff, 0xbfbbfd6f},
+    {0xffaabbdf, 0xb6f6d75b, 0xfffeff79, 0xefdfeffb},
+    {0x55ffefed, 0xffbffff7, 0xdaafdadf, 0xb9eeb5de},
+    {0xffb77abf, 0xddfdb6bd, 0xfffddffd, 0xff7bff6b},
+    {0xdeddeff7, 0x7fb7ffef, 0xbedbfb57, 0xafff7fff},
+    {0x77ffffb6, 0xe6feedbd, 0xebff6ffb, 0xfad7eadd},
+    {0xeef56aff, 0xffdbbfff, 0xbf6efb7f, 0xefdd7fff},
+    {0xbddfbfed, 0x7bfffb55, 0xfbfddfed, 0xbf7fdeab},
+    {0xef7bfd7f, 0xd77ed7ff, 0xddefbdff, 0xf5fbfbfe},
+    {0x7dedb7db, 0xffb7ffb7, 0xff7bf75b, 0x7f6f5f6b},
+    {0xefbffdff, 0x7ded76fd, 0x6bef6fff, 0xebf7fbff},
+    {0xfdf6f7ae, 0xef7fdfee, 0xffbbfd6d, 0xbf7dbfad},
+    {0xdbbfbdfb, 0x7bdb7daf, 0xad7ebfff, 0xfbd7f6ff},
+    {0x6f76ef6f, 0xdb7fefff, 0x7fdbefb6, 0x6efeeffb},
+    {0xfffffbfb, 0xffd5fdb5, 0xefff76df, 0xffd7fddf},
+    {0xdddf5fbe, 0xbeff77ff, 0xfcfbfdf7, 0xed7fb776},
+    {0x77baf7f7, 0xebfbdef5, 0xb79eefbd, 0xb7ed7dff},
+    {0xfbf7fd7d, 0xbfb77fdf, 0xf7f77ef7, 0xfebff7af},
+    {0xeedf77af, 0xfeffd57d, 0xbefbd7dd, 0xbbf55efa},
+    {0x5fedddf6, 0x6bdafff7, 0xfbdfffbf, 0xff7ff7bf},
+    {0xfdff7f7f, 0xfdefdddd, 0x6f7e6cf7, 0xabf7bfed},
+    {0xf7bbdbdd, 0x777bbeff, 0xfef7ffbd, 0xfeddfd7f},
+    {0xbedefeb6, 0xdffef7d7, 0xd7dfb7fb, 0xdfff77f6},
+    {0xfbfff7ff, 0xf55bf5fe, 0xfdfafdaf, 0xfb5bddbe},
+    {0xdf6dadea, 0x5fff5f57, 0xefeff7fd, 0xbffefff7},
+    {0x7df7ffbf, 0xfbdbffff, 0x76bfbeff, 0xeaefeedb},
+    {0xfbbef6fe, 0xbf77dafd, 0xfdfaedad, 0xfffebb7f},
+    {0xd7fbdbdb, 0xefdeefb7, 0xafffffff, 0xd5bbfff6},
+    {0x7eefbefe, 0x79fbfdff, 0xfd56bdaf, 0xffeedebf},
+    {0xd77defb7, 0x6f6fb7bb, 0xb7fbf7fb, 0xbf7ff7fa},
+    {0x7fefbbff, 0xfffdfdef, 0xffdfed7f, 0xedef5fbf},
+    {0xfaddf7b6, 0xb55ed7bf, 0xaf76bfed, 0xefd9f5eb},
+    {0x5f7ebefd, 0xfff77dfd, 0xfdffef7b, 0xfd7ffffe},
+    {0xffeff7df, 0xef7fdeb7, 0xd6defade, 0x3fef356f},
+    {0xaafdbd7b, 0xbdf6f7ff, 0xfff3fff7, 0xf7bdffdb},
+    {0xff5eefdb, 0xdb5fffed, 0xadbf977b, 0xfdf7f6fe},
+    {0x77f7fdff, 0xfff9ad7f, 0xfeedfdde, 0xb79d5f6d},
+    {0xdeddef5a, 0xdaff77ed, 0xd7ff7fff, 0xbeffdbff},
+    {0xfeff76ff, 0xbfafffbb, 0x7dbbd7bb, 0xf7f6ffbb},
+    {0xd7fdbfeb, 0xf6fdbb7f, 0xff6efaf6, 0xbdbff6d7},
+    {0xff67edbe, 0xffedefda, 0xebfdbfdf, 0xf7b5dffe},
+    {0xdbff77f7, 0xb7bf7eff, 0xdeeff77a, 0xdfff7b77},
+    {0x7f5dfdbf, 0xfdef7bd7, 0xffbedbdf, 0xfdd7ff7b},
+    {0xdbf7dffa, 0xeefbeffd, 0xb7fbfff6, 0xf77db7de},
+    {0xeebb7f6f, 0xffdededf, 0xfd5f6b6f, 0xdf6fbdeb},
+    {0x7fffebb7, 0xbb77fbfd, 0xeff7fefe, 0x7bfdff7f},
+    {0xdbcd7ffd, 0xeddfdf57, 0x7fddbfb3, 0xfef76fef},
+    {0xfeffeedf, 0xeff575fb, 0xfb7febfe, 0xefbdfbbd},
+    {0x76fdf6fa, 0xfdbfffbf, 0xaedadedf, 0xb5efdef7},
+    {0xf7df5fbf, 0xbffaddf7, 0xfff7fbfb, 0xff7ef7fe},
+    {0xdef7fbf6, 0xb6dffbde, 0xdbbfb76d, 0xdffbfdbb},
+    {0xfbdd6f5f, 0xfffbaf7b, 0xf6edff7f, 0xf3efafef},
+    {0x5f7ffdfa, 0xdb5fffff, 0xbffeebea, 0xff3bfafd},
+    {0xfbfbdb6f, 0x6deedb7b, 0xf6afff7f, 0xadfd7fdf},
+    {0xbeaeffbd, 0xfffefdcd, 0xdffdb777, 0xffefdb6b},
+    {0xf7ffaff7, 0xbeb7f7ff, 0x777fbbfd, 0x6b5f7fff},
+    {0xadbbfd7f, 0xd7df5fbf, 0xfbdaff6f, 0xfff9fbad},
+    {0xffeef7ee, 0xfdfdf6f5, 0xdffff5f5, 0xdb6fdfff},
+    {0x6dbb7f7d, 0x77afffbf, 0x7eb6afbf, 0xffff6ad7},
+    {0xfdffeb6f, 0xfefb5bdb, 0xd7fffdf7, 0x6edbfffb},
+    {0xef6bbffb, 0xd7dfff7e, 0xbdb3bfbe, 0xfbffbf7f},
+    {0x7ffedebf, 0xfffdd7eb, 0xffffedbd, 0xdf6ef6da},
+    {0xdbf7f7f6, 0x6db7fdbf, 0xf6defff7, 0xfbfbdfef},
+    {0xfd6ebd7f, 0xfedf7ffd, 0x5ff3bdef, 0xefef7bbf},
+    {0x6fbbf7ed, 0xbbfdad6f, 0xfbdfeb7d, 0x5ebfff7d},
+    {0xf7ffdedf, 0xf76fffbb, 0xbefeffdf, 0xfdf6cdf7},
+    {0xddeeff77, 0xdffdb7fe, 0x6fadbdba, 0xb7b7ffdf},
+    {0xff7b6bfe, 0xed77dd5d, 0xfdffb7ff, 0xff7dbebb},
+    {0xbbdfff6f, 0x7fddfff7, 0xbdb6ff6f, 0xedfff7fe},
+    {0x6efd6dfd, 0xd5ffb7bf, 0xefdbebfb, 0x7faf6ef7},
+    {0xffd7fbd7, 0x7fb76ef7, 0xfeff7fbf, 0xf7fbfbde},
+    {0xdb7d7f7f, 0xfdfdffdd, 0xdbbfdef6, 0xddbf5ff7},
+    {0x7fdfeefd, 0xd7df557f, 0xfdeb7bdf, 0x6eedfd7e},
+    {0xfafb7dd7, 0xfef7fffb, 0xb77fdff5, 0xfbf7b7df},
+    {0x5fbff7ff, 0xf5bef6ef, 0xffddfd5e, 0x7fbdfdf6},
+    {0xf5f55d76, 0xdff7fdde, 0xeef7b7ff, 0xeedfefbb},
+    {0xef5fffdf, 0xb75daffb, 0xfbbeddf6, 0xfbfb7efe},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(27)
+  {  // level 27: redness 216
+    {0xbff5f7f5, 0xfefefbbf, 0xbf6bfedf, 0xdef7ebdf},
+    {0xf77fbeff, 0xefeffffb, 0xfdff57fd, 0xfffdfff5},
+    {0xffdbffae, 0x7efbd76e, 0x6feffbff, 0xd75fdb5f},
+    {0xdbffb3ff, 0xefef7fff, 0xffbb7ed7, 0xfdfb7fff},
+    {0x7ef6fefb, 0xfebffb6f, 0xbd7fdfff, 0xbfffedfd},
+    {0xefbfff5f, 0xbbeddffd, 0xf7fdf5fe, 0xedaf7f6f},
+    {0x7eefeffb, 0xeffff6ff, 0xfeef7fb7, 0x7fffeffd},
+    {0xfbfdb7ef, 0xbf77bfb7, 0x57ffdbff, 0xfbb5ffb7},
+    {0x6feffd7d, 0xedfdfdff, 0xffbdffed, 0x7fff7aff},
+    {0xfdbeffef, 0xffefeedd, 0xfdefb6bf, 0xeeefeffb},
+    {0xdff7edfd, 0xdf7effff, 0xfffefff6, 0xf7fdff5e},
+    {0x7bff7fdf, 0xfdd7eddb, 0xabbbd7ff, 0xbddf75f7},
+    {0xff6fdf7e, 0xdfffbfff, 0xfff7ff7e, 0xff7bbfff},
+    {0xdffdfbeb, 0xf6fdfbed, 0xf6fefdb7, 0xdbffedb6},
+    {0xf7dbdfff, 0x7fafbebf, 0xdfaf6fff, 0x7fd77fff},
+    {0xbdff7db7, 0xfbffeffb, 0x7dfffbed, 0xfefdf6f7},
+    {0xff6ff7ff, 0xaefdffef, 0xffddbeff, 0xefffbfdf},
+    {0x6dfddf56, 0xffd7b6bf, 0xd6f7f7de, 0xfbadfbfe},
+    {0xfff7fbff, 0xf7fffffb, 0xffff7efb, 0xdfff6f77},
+    {0xd77eef7f, 0xdeedddff, 0xbfdfdfef, 0x7df7fdef},
+    {0x7df7fffb, 0xffbf7baf, 0xeefbf7be, 0xf6dddffe},
+    {0xffbf7ddf, 0xf5f7dffd, 0xfbef7ef7, 0x7ffff75f},
+    {0xb7fbf77f, 0x5fbfffbf, 0xbfbedfdf, 0xddf77ef5},
+    {0xfeeedffb, 0xf6ed5bef, 0xeffff6fd, 0xff5ef7ff},
+    {0xb77ffddf, 0xfffffefd, 0xfdf7ffdf, 0x7fffddbf},
+    {0xfffbefed, 0xddedf7df, 0xb7bedf7b, 0xd5eeffed},
+    {0xedddbbff, 0x7f7f7ffa, 0xfeeff7df, 0xffbfbfdf},
+    {0xffffff75, 0xfbebed6f, 0xefff7dfb, 0xbffbed7b},
+    {0xdefbdbdf, 0xdfff7ffe, 0xbdfbbfbe, 0xf76effff},
+    {0xf7df7dfe, 0xdefbdbef, 0x77affbef, 0xbdfffbdb},
+    {0xbdbbff7b, 0xfbdffefd, 0xfefeeefd, 0xffdd5eff},
+    {0xefffb7ef, 0xbef6bfb7, 0xeffbffd7, 0xedfff7f6},
+    {0x7dfafefd, 0xf7fff6ff, 0xfedfb77f, 0xbf6fddbf},
+    {0xef6ff7db, 0x7f5befed, 0x5bfffffd, 0xf7faffef},
+    {0xffff7fbf, 0xfdfeffbf, 0xffb5b7d7, 0xbd7fbbfb},
+    {0xdbddeefb, 0xd7b7daee, 0xbffffd7f, 0xefefef6f},
+    {0xfeffbffe, 0xffff7fff, 0xedddefed, 0xfffdfefd},
+    {0x7ff6fb77, 0x7bddf75b, 0xffff7dff, 0xf6dfb7ef},
+    {0xd5bfdfdf, 0xdf7fbfff, 0xf6fbf77b, 0xb7f7ff7e},
+    {0xffedfefb, 0xf7f7f6ff, 0xdfb77fef, 0xfefedbbf},
+    {0xfeff77ee, 0xdf7dffad, 0xf7ffedbd, 0xdfbfffed},
+    {0x6bbffb7b, 0x7ddfdfff, 0x7d6efff7, 0xfbef7dff},
+    {0xffdbbfff, 0xeffb7dfb, 0xefffbb7f, 0xdf7bdbb7},
+    {0x5bff6ddd, 0xfeffff7f, 0xbdedefdb, 0xfbfefffb},
+    {0xffb7ffb7, 0xafbb77db, 0xff7ffbfe, 0x6ef7dbbf},
+    {0xddfeebff, 0xfdefddff, 0xdbeeff7f, 0xffbefefd},
+    {0x7fdfff77, 0xdfbfffd7, 0x7fffdbed, 0xf7edefef},
+    {0xf6fb6dfe, 0x7bf5befd, 0xefb7ffff, 0xbeffbb7f},
+    {0xbfffffbb, 0xfffffbbf, 0x7dfeb7b7, 0xffbfffdb},
+    {0xf6d6dfee, 0xdedf5ffd, 0xf7ebfefe, 0xdff57eff},
+    {0xdffff6ff, 0xbbfbf6ef, 0xff7fbfb7, 0xfaffb7fe},
+    {0x76ffffbb, 0xffdfffff, 0x6df7ebff, 0xbfbbff6f},
+    {0xffaabbff, 0xb6f6d75b, 0xfffeff7b, 0xeffffffb},
+    {0x75ffefed, 0xffbfffff, 0xdbafdbdf, 0xbdeeb5de},
+    {0xffff7ebf, 0xddfdb6fd, 0xfffdfffd, 0xff7bff7b},
+    {0xdeddeff7, 0x7fb7ffef, 0xbedbfb5f, 0xafff7fff},
+    {0x77ffffbe, 0xeefeedbf, 0xebff6ffb, 0xfaf7eadd},
+    {0xfef5eaff, 0xffdbbfff, 0xbf6ffb7f, 0xffdd7fff},
+    {0xbddfbfed, 0x7bfffb75, 0xfffdffed, 0xbf7fdeeb},
+    {0xefffff7f, 0xd77edfff, 0xddefbdff, 0xf5fbfbfe},
+    {0x7dedb7db, 0xfff7ffb7, 0xff7bf75b, 0x7f6f5f6f},
+    {0xefbffdff, 0x7dedf6ff, 0x6bef6fff, 0xeffffbff},
+    {0xfff6f7bf, 0xef7fdfee, 0xfffbfded, 0xbf7dbfad},
+    {0xfbbfbffb, 0xfffb7dbf, 0xed7fbfff, 0xfbd7f6ff},
+    {0x6f76ef6f, 0xdb7fefff, 0x7fdbefb6, 0x6efeeffb},
+    {0xfffffbff, 0xffd7fdb5, 0xefff76ff, 0xffdffddf},
+    {0xdddfdfbe, 0xbeff77ff, 0xfcfbfff7, 0xfdffb776},
+    {0x7fbaf7f7, 0xebfbdef7, 0xbfdfefbd, 0xb7edffff},
+    {0xfbfffd7d, 0xbfb77fdf, 0xf7f77eff, 0xffbff7ef},
+    {0xeedf77ef, 0xfefff77d, 0xbefbd7dd, 0xbbf75efb},
+    {0x5feddff6, 0x6bdefff7, 0xfbdfffff, 0xff7ff7bf},
+    {0xfdffff7f, 0xffefdddd, 0x6ffeeef7, 0xebf7bfed},
+    {0xf7bbdbdd, 0x7f7bbeff, 0xfef7ffbf, 0xfeddfd7f},
+    {0xbfdefef7, 0xdffef7f7, 0xdfdfb7fb, 0xdfff77f7},
+    {0xfbffffff, 0xf5dbfdfe, 0xfdfafdaf, 0xfb5bddbe},
+    {0xdf6dadea, 0x7fff5f57, 0xefeff7fd, 0xbffeffff},
+    {0x7dffffbf, 0xfbdbffff, 0x76bfbfff, 0xeeefeedb},
+    {0xfbbefeff, 0xbf7fdafd, 0xfffaedad, 0xffffbbff},
+    {0xdffbdbdb, 0xefdeffb7, 0xafffffff, 0xd5bbfff7},
+    {0x7eefbefe, 0xfdfbffff, 0xfd5ebdaf, 0xffeedebf},
+    {0xf77dffb7, 0x6f6fb7bb, 0xf7fbf7fb, 0xbf7ff7fa},
+    {0x7fefbbff, 0xfffdfdef, 0xffdffd7f, 0xfdff7fbf},
+    {0xfbfdf7b6, 0xb5dedfbf, 0xaf76bfed, 0xefdbf5eb},
+    {0xdf7fbeff, 0xfff7fdfd, 0xfdffefff, 0xfd7ffffe},
+    {0xffeff7df, 0xef7fdfb7, 0xd7defade, 0x3fef377f},
+    {0xbafdbdfb, 0xbff6f7ff, 0xfffbfff7, 0xf7bdffdb},
+    {0xffdeefdb, 0xfb5fffed, 0xbdbfb77b, 0xfdf7f6ff},
+    {0x77f7fdff, 0xfffbbd7f, 0xffedfdde, 0xb7df7fed},
+    {0xdeddefde, 0xdbff77ed, 0xd7ff7fff, 0xfeffdbff},
+    {0xfefff6ff, 0xbfafffff, 0x7dbbd7bb, 0xf7f6ffbb},
+    {0xd7fdbfeb, 0xf6fdbb7f, 0xffeffafe, 0xbdbff6df},
+    {0xff6ffdbe, 0xfffdefda, 0xebfdbfdf, 0xf7b5dffe},
+    {0xdbff77f7, 0xb7bffeff, 0xdeefff7b, 0xdfff7bf7},
+    {0x7fddfdbf, 0xfdef7bd7, 0xffbedbff, 0xfddfff7f},
+    {0xfbffdffa, 0xeefbeffd, 0xb7fbfff6, 0xf7fdf7de},
+    {0xeebb7f7f, 0xffdefedf, 0xfd5f6b6f, 0xdf6fbdfb},
+    {0x7fffebb7, 0xbb77fbfd, 0xeff7fffe, 0x7bffff7f},
+    {0xdbcd7ffd, 0xffffdf5f, 0x7ffdbfb7, 0xfef76fef},
+    {0xfeffeedf, 0xeff777fb, 0xfb7ffbfe, 0xefbdfbbd},
+    {0x77fdfffb, 0xfdbfffbf, 0xafdededf, 0xbdefdef7},
+    {0xffdfdfbf, 0xbffaddf7, 0xfff7fffb, 0xff7ef7fe},
+    {0xdef7fbf6, 0xb6dffbde, 0xdbbfb76d, 0xdffbfdbb},
+    {0xfbdd6f5f, 0xfffbbf7b, 0xfeedffff, 0xfbefafef},
+    {0xdf7ffdfe, 0xfb7fffff, 0xbffeebeb, 0xffbffefd},
+    {0xfbfbdbef, 0x6feedb7b, 0xf6efff7f, 0xadfd7fdf},
+    {0xbeeeffbd, 0xfffffded, 0xdffdbf77, 0xffefdb7b},
+    {0xf7ffaff7, 0xbeb7ffff, 0x7f7fbbfd, 0x7b7f7fff},
+    {0xbdbbfd7f, 0xd7ff5fbf, 0xfbdbff6f, 0xfffbfbad},
+    {0xffeef7ef, 0xfdfdf6f5, 0xdffffdfd, 0xdb6fdfff},
+    {0x6fbf7f7d, 0x7fafffff, 0x7eb6afbf, 0xffff7adf},
+    {0xfdffebef, 0xfefb5bdb, 0xf7fffdf7, 0x6edbfffb},
+    {0xef6bbffb, 0xd7dfff7f, 0xbdbbbffe, 0xfbffbf7f},
+    {0x7ffefebf, 0xfffdd7eb, 0xffffedbf, 0xdf6ef6fa},
+    {0xdbfff7f6, 0x6db7fdbf, 0xf6defff7, 0xfbfbdfef},
+    {0xfd6ebd7f, 0xffff7ffd, 0x5ffbbdef, 0xefef7bbf},
+    {0x7fbbf7ed, 0xbbfded6f, 0xfbdfef7d, 0x7ebffffd},
+    {0xf7ffdfff, 0xf76ffffb, 0xfefeffdf, 0xfdfeedf7},
+    {0xddeeff77, 0xdffdb7ff, 0x6fadfdfa, 0xb7f7ffdf},
+    {0xff7bebfe, 0xfd77fd5d, 0xffffb7ff, 0xff7dbebb},
+    {0xbbdfff6f, 0x7fddfff7, 0xbdfeff6f, 0xedfff7ff},
+    {0x6eff6ffd, 0xd7ffb7ff, 0xefdbebfb, 0x7faf7ef7},
+    {0xfff7fbd7, 0xffb7fef7, 0xfeff7fbf, 0xf7fbfbde},
+    {0xdb7d7f7f, 0xfdfdffdd, 0xdbbffef6, 0xffbfdff7},
+    {0x7fdfeffd, 0xd7df577f, 0xffeb7bff, 0x6eedff7e},
+    {0xfbfb7dd7, 0xfef7fffb, 0xb77fdff7, 0xfbffb7df},
+    {0xdfbff7ff, 0xfdbef6ef, 0xffddfd5e, 0x7fbdfdf7},
+    {0xfdf75d7e, 0xdff7fdde, 0xeeffb7ff, 0xeedfefbb},
+    {0xef7fffdf, 0xf7dfaffb, 0xfbfefff6, 0xfbfb7efe},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(28)
+  {  // level 28: redness 224
+    {0xbffdf7fd, 0xfefefbbf, 0xbf6bfedf, 0xdef7efff},
+    {0xf77fbeff, 0xefefffff, 0xfdffd7fd, 0xfffdfff7},
+    {0xffdbffae, 0x7efbdf6e, 0x6fffffff, 0xf75ffb5f},
+    {0xdbffb7ff, 0xefff7fff, 0xffbb7ed7, 0xfffb7fff},
+    {0xfef6fefb, 0xffbffbef, 0xbdffdfff, 0xbfffedfd},
+    {0xefbfffdf, 0xfbeddffd, 0xfffdfdfe, 0xedef7f6f},
+    {0x7fffeffb, 0xfffff6ff, 0xfeef7fb7, 0x7fffefff},
+    {0xfbfdbfff, 0xbf7fbfb7, 0x57ffdbff, 0xfbbdffb7},
+    {0xefeffd7f, 0xedfdffff, 0xffbdfffd, 0x7fff7bff},
+    {0xfdbeffef, 0xffefeedd, 0xfdeffebf, 0xeeefeffb},
+    {0xdff7edfd, 0xdf7effff, 0xfffefff6, 0xfffdff5e},
+    {0x7bff7fdf, 0xfdf7eddb, 0xbbbfd7ff, 0xbddf77ff},
+    {0xff6fff7f, 0xdfffbfff, 0xfff7ffff, 0xfffbffff},
+    {0xdffdfbfb, 0xf6fdfbfd, 0xf6fefdb7, 0xdbffedb6},
+    {0xf7dfdfff, 0x7fafbebf, 0xdfefefff, 0x7fd77fff},
+    {0xbfff7db7, 0xffffeffb, 0xfdffffed, 0xfefff6f7},
+    {0xff6fffff, 0xeefdffef, 0xffddbeff, 0xefffbfdf},
+    {0x6dfddf76, 0xffd7b6bf, 0xd6f7f7de, 0xfbadfffe},
+    {0xfffffbff, 0xf7fffffb, 0xffff7efb, 0xdfffef77},
+    {0xdf7eef7f, 0xdefddfff, 0xffdfdfff, 0xfffffdff},
+    {0xfdf7fffb, 0xffbf7baf, 0xeefbf7be, 0xf6dddffe},
+    {0xffbf7ddf, 0xfdf7fffd, 0xfbfffff7, 0x7ffff7df},
+    {0xb7fff77f, 0xdfffffff, 0xbfbedfdf, 0xddf77ef5},
+    {0xffeedffb, 0xf6ef5bef, 0xfffff6fd, 0xff7fffff},
+    {0xb77ffddf, 0xfffffefd, 0xfdf7ffff, 0x7fffddbf},
+    {0xfffffffd, 0xdfedf7df, 0xb7bedf7b, 0xf5eeffed},
+    {0xedddbbff, 0x7f7f7ffe, 0xffeff7df, 0xffbfffff},
+    {0xffffff77, 0xfbefef6f, 0xfffffdff, 0xbffbed7b},
+    {0xfefbdbdf, 0xdfff7ffe, 0xbdfbbfbe, 0xf77effff},
+    {0xf7df7ffe, 0xfefbfbef, 0xf7bfffef, 0xfffffbdb},
+    {0xbfbbff7f, 0xffdffffd, 0xfffeeefd, 0xffdddeff},
+    {0xffffb7ef, 0xbef6bfbf, 0xeffbfff7, 0xedfffff6},
+    {0x7dfbfefd, 0xf7fff6ff, 0xfedfb77f, 0xbfefddbf},
+    {0xef6ff7df, 0x7fdfffed, 0x7bfffffd, 0xfffaffff},
+    {0xffff7fff, 0xfdfeffff, 0xffb5bfdf, 0xbd7fbbfb},
+    {0xdbddeefb, 0xdfb7daee, 0xbffffd7f, 0xefefff6f},
+    {0xfefffffe, 0xffffffff, 0xeddfefed, 0xfffdfefd},
+    {0x7ff6fbf7, 0x7bddf7db, 0xffff7fff, 0xfedfb7ef},
+    {0xd7bfdfdf, 0xdf7fbfff, 0xf6fbf77f, 0xb7f7fffe},
+    {0xffedfeff, 0xf7f7f6ff, 0xdfbf7fef, 0xfefedbbf},
+    {0xfeff77ee, 0xfffdffad, 0xffffedfd, 0xffffffed},
+    {0x6fffff7b, 0x7ddfdfff, 0x7d6effff, 0xfbeffdff},
+    {0xffdbffff, 0xeffbfdff, 0xefffbf7f, 0xdf7bdfbf},
+    {0x7bff6dff, 0xfeffff7f, 0xbffdefdb, 0xfffefffb},
+    {0xffb7ffb7, 0xefbb77db, 0xff7ffbfe, 0x6ef7dbbf},
+    {0xddfeefff, 0xfdffddff, 0xdbeeff7f, 0xfffffefd},
+    {0x7fdfff77, 0xdfbffff7, 0xffffdbed, 0xf7edffef},
+    {0xf6fbedfe, 0xfbf5bfff, 0xefb7ffff, 0xfeffbbff},
+    {0xffffffbf, 0xfffffbbf, 0x7dfef7bf, 0xffbfffdb},
+    {0xf6d6dfee, 0xdedf7ffd, 0xffeffefe, 0xdff5feff},
+    {0xdffff6ff, 0xfbfbf6ef, 0xff7fbff7, 0xfbffb7fe},
+    {0x7fffffbb, 0xffdfffff, 0xedf7fbff, 0xbfbbff6f},
+    {0xffbbbbff, 0xb6fedfdb, 0xfffeff7b, 0xefffffff},
+    {0xf5ffffed, 0xffffffff, 0xdbafdbdf, 0xfdefb5de},
+    {0xffff7eff, 0xfdfdb6fd, 0xfffffffd, 0xff7bff7b},
+    {0xdeddeff7, 0x7fb7ffef, 0xbefbff7f, 0xafff7fff},
+    {0x77ffffbe, 0xeeffefbf, 0xebff6ffb, 0xfaffebdd},
+    {0xfef5fbff, 0xffdbbfff, 0xff6ffb7f, 0xffddffff},
+    {0xffdfbfed, 0x7bfffb75, 0xfffdffef, 0xbfffdeef},
+    {0xefffff7f, 0xdf7edfff, 0xddefbdff, 0xf5fbfbfe},
+    {0x7dfdb7fb, 0xffffffb7, 0xff7fff7b, 0x7f6f7f6f},
+    {0xefbffdff, 0x7dedf6ff, 0x6fef6fff, 0xeffffbff},
+    {0xfff7f7bf, 0xef7fffee, 0xfffbfdef, 0xff7dbfed},
+    {0xfbffbffb, 0xfffb7dff, 0xed7fbfff, 0xfbf7feff},
+    {0x6f76ff6f, 0xdbffefff, 0x7fdfffb6, 0x6ffeeffb},
+    {0xfffffbff, 0xffd7ffb7, 0xefff76ff, 0xffdffddf},
+    {0xdddfdfbe, 0xbeff77ff, 0xfefbfff7, 0xfdffbf7e},
+    {0x7fbafff7, 0xeffffef7, 0xbfdfefbd, 0xb7edffff},
+    {0xfffffd7f, 0xffb77fff, 0xf7ff7eff, 0xffbff7ef},
+    {0xeeff77ef, 0xfefff77f, 0xbefbf7dd, 0xbbf77efb},
+    {0x7fedfffe, 0x6bfefff7, 0xffdfffff, 0xff7ff7bf},
+    {0xfdffff7f, 0xffeffddd, 0xeffeeef7, 0xefffbffd},
+    {0xf7bbdbdd, 0x7f7bbfff, 0xfef7ffbf, 0xfeddff7f},
+    {0xbffefff7, 0xdffff7f7, 0xdfdfb7fb, 0xdffff7f7},
+    {0xfbffffff, 0xfddffdfe, 0xfdfefdef, 0xfbdbddbe},
+    {0xdf6dadee, 0x7fff7f5f, 0xefefffff, 0xfffeffff},
+    {0xffffffbf, 0xfbdbffff, 0x7ebfbfff, 0xeeeffedb},
+    {0xfbbeffff, 0xbf7fdbfd, 0xfffbedad, 0xffffbbff},
+    {0xdfffdbdb, 0xeffeffb7, 0xafffffff, 0xddfbfff7},
+    {0x7feffefe, 0xfdfbffff, 0xfddebdff, 0xffeedeff},
+    {0xf77dfff7, 0x6f6fb7bb, 0xf7fbf7fb, 0xbf7ff7fa},
+    {0x7fefbfff, 0xfffffdef, 0xffffff7f, 0xfdff7fbf},
+    {0xfbfdf7b6, 0xbddedfff, 0xbf77bfed, 0xefdbfdef},
+    {0xdf7fbeff, 0xfff7fdfd, 0xfdffefff, 0xfdfffffe},
+    {0xffefffff, 0xef7fdfb7, 0xf7defedf, 0xbfffb77f},
+    {0xbafdbdfb, 0xbffef7ff, 0xfffbffff, 0xf7bdffdb},
+    {0xffdfefdf, 0xfbdffffd, 0xbdbfb7fb, 0xfff7f6ff},
+    {0xf7fffdff, 0xfffbbd7f, 0xffedfdde, 0xb7df7fed},
+    {0xdeddffde, 0xdbfff7ed, 0xf7ffffff, 0xfeffdbff},
+    {0xfffff6ff, 0xffafffff, 0x7dbfdfbb, 0xfff6fffb},
+    {0xf7fdbffb, 0xf6ffbb7f, 0xffeffbfe, 0xbdbffedf},
+    {0xff6fffbe, 0xfffdefda, 0xfbfdbfdf, 0xf7f7dffe},
+    {0xdbff77f7, 0xbfbffeff, 0xdeefff7b, 0xdfff7bf7},
+    {0x7fddfdbf, 0xfdef7ff7, 0xffffdbff, 0xfddfff7f},
+    {0xffffdffe, 0xefffefff, 0xf7fbfff6, 0xfffdf7de},
+    {0xeebbff7f, 0xfffefedf, 0xfd5f7b7f, 0xdf6fbdfb},
+    {0x7ffffbf7, 0xbb77fbfd, 0xeff7ffff, 0x7bffff7f},
+    {0xfbef7fff, 0xffffdfdf, 0x7ffdbfb7, 0xfff76fef},
+    {0xfeffeedf, 0xeff777fb, 0xfb7ffbfe, 0xefbffbbf},
+    {0x77fdfffb, 0xfdbfffbf, 0xefdedeff, 0xbdefdff7},
+    {0xffdfdfbf, 0xfffedfff, 0xfff7ffff, 0xff7efffe},
+    {0xdef7fbf6, 0xb7dffbde, 0xdbbfb76d, 0xdffbfdbf},
+    {0xfbff6f7f, 0xfffbbf7b, 0xfffdffff, 0xfbefafef},
+    {0xdf7ffffe, 0xfb7fffff, 0xbfffebef, 0xffbffefd},
+    {0xfffbfbef, 0x6feedb7f, 0xf6efff7f, 0xedfdffdf},
+    {0xbeeeffbd, 0xffffffed, 0xdffdfff7, 0xffefdb7b},
+    {0xf7ffafff, 0xfeb7ffff, 0xff7fbbfd, 0x7b7f7fff},
+    {0xfdbbfdff, 0xd7ff5fbf, 0xfbdbff6f, 0xfffbffed},
+    {0xffefffef, 0xfdfdf6f5, 0xdfffffff, 0xdbefdfff},
+    {0x6fff7f7d, 0x7fefffff, 0x7ef6efbf, 0xffff7adf},
+    {0xfdffebef, 0xfeff7bdf, 0xf7fffdf7, 0x6edbfffb},
+    {0xff6bffff, 0xd7dfff7f, 0xbfbbbffe, 0xffffbfff},
+    {0x7ffefeff, 0xfffddffb, 0xffffefbf, 0xdf7ff6fb},
+    {0xdbfff7f6, 0x7db7fdbf, 0xf6defff7, 0xfbfbffef},
+    {0xff6fbf7f, 0xffff7fff, 0x5ffbbdff, 0xefef7bbf},
+    {0x7ffbf7ef, 0xbbffef6f, 0xfbffef7d, 0x7ebffffd},
+    {0xf7ffdfff, 0xff6ffffb, 0xfeffffdf, 0xfffeedff},
+    {0xddeeff77, 0xdffdb7ff, 0x6fadfdfb, 0xb7f7ffdf},
+    {0xff7bfbff, 0xfdfffd5d, 0xffffb7ff, 0xff7dbefb},
+    {0xfbdfff6f, 0x7fddffff, 0xbdffff6f, 0xedfff7ff},
+    {0x6fff6ffd, 0xd7ffb7ff, 0xefdbeffb, 0x7faf7eff},
+    {0xfff7fbdf, 0xffb7fef7, 0xfeff7fbf, 0xf7fbfbde},
+    {0xdb7dff7f, 0xfdfdffdf, 0xfbfffefe, 0xffffdff7},
+    {0x7fdfeffd, 0xdfdfd77f, 0xffebfbff, 0x6eedff7e},
+    {0xfbfb7dd7, 0xfffffffb, 0xb77fdff7, 0xfbffb7ff},
+    {0xdfbfffff, 0xfdbef6ff, 0xffddff5e, 0xffbdfdf7},
+    {0xfdf7ddfe, 0xdff7ffde, 0xefffb7ff, 0xefdfffbf},
+    {0xffffffdf, 0xf7dfbffb, 0xfbfefff6, 0xfbff7efe},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(29)
+  {  // level 29: redness 232
+    {0xbffdf7ff, 0xfefffbff, 0xbf7bfedf, 0xdef7efff},
+    {0xf77fbeff, 0xffefffff, 0xfffff7fd, 0xfffffff7},
+    {0xffdfffee, 0x7efbdf6e, 0xefffffff, 0xf77ffb7f},
+    {0xfffff7ff, 0xefff7fff, 0xffbb7edf, 0xfffb7fff},
+    {0xfef6feff, 0xffbffbef, 0xbdffdfff, 0xbfffeffd},
+    {0xefbfffdf, 0xfbedffff, 0xfffffffe, 0xedefff6f},
+    {0x7fffeffb, 0xfffff7ff, 0xfeefffb7, 0xffffefff},
+    {0xfbfdbfff, 0xbf7fbfb7, 0x77ffdbff, 0xffbdffbf},
+    {0xffeffd7f, 0xeffdffff, 0xfffdffff, 0x7fff7bff},
+    {0xffbfffef, 0xffefeefd, 0xfdeffebf, 0xeeeffffb},
+    {0xdfffeffd, 0xff7fffff, 0xfffefff6, 0xffffff7f},
+    {0x7bff7fff, 0xfff7ffdf, 0xbfbfdfff, 0xbfdf77ff},
+    {0xff6fff7f, 0xdfffbfff, 0xfff7ffff, 0xfffbffff},
+    {0xfffdfbfb, 0xf6fdfbfd, 0xf6fefdb7, 0xfbfffdb6},
+    {0xf7ffdfff, 0x7fefffbf, 0xdfffefff, 0x7fdf7fff},
+    {0xbffffdbf, 0xffffffff, 0xffffffff, 0xfefff7ff},
+    {0xff6fffff, 0xeefdffef, 0xffddfeff, 0xffffbfdf},
+    {0x7dfddff6, 0xffdfb6ff, 0xf6fff7de, 0xfbedfffe},
+    {0xfffffbff, 0xfffffffb, 0xffff7ffb, 0xdfffef77},
+    {0xdffeff7f, 0xdefdffff, 0xffdfffff, 0xfffffdff},
+    {0xfdf7fffb, 0xffbf7bbf, 0xeefbf7be, 0xf6ddfffe},
+    {0xffbfffdf, 0xfff7fffd, 0xffffffff, 0x7ffff7df},
+    {0xb7fff7ff, 0xdfffffff, 0xbfbedfdf, 0xfff77ef7},
+    {0xffeedffb, 0xf6efdbef, 0xfffffefd, 0xff7fffff},
+    {0xff7ffddf, 0xfffffefd, 0xfdf7ffff, 0x7fffddff},
+    {0xffffffff, 0xdffdffff, 0xb7bedffb, 0xf5eeffed},
+    {0xedddbfff, 0xff7ffffe, 0xffffffdf, 0xffffffff},
+    {0xffffff77, 0xfbefef6f, 0xfffffdff, 0xbffbef7b},
+    {0xfefbfbff, 0xdfff7fff, 0xbdfbbffe, 0xf77fffff},
+    {0xf7df7ffe, 0xfffbfbff, 0xffbfffef, 0xfffffbdf},
+    {0xbfffff7f, 0xffdffffd, 0xfffeeeff, 0xffdddfff},
+    {0xffffb7ef, 0xbeffbfbf, 0xeffbfff7, 0xedfffff6},
+    {0xfdfbfefd, 0xf7fff6ff, 0xfedff77f, 0xbfeffdbf},
+    {0xef6fffdf, 0xffdfffed, 0xfbfffffd, 0xfffeffff},
+    {0xffff7fff, 0xfdfeffff, 0xfffdbfdf, 0xff7fbbfb},
+    {0xdffdeeff, 0xdfb7deff, 0xbffffdff, 0xefefffff},
+    {0xfefffffe, 0xffffffff, 0xeddfefed, 0xfffdfeff},
+    {0x7ff7fbf7, 0x7bfdffdb, 0xffffffff, 0xfeffb7ef},
+    {0xf7bfdfdf, 0xff7fbfff, 0xfffbff7f, 0xb7f7fffe},
+    {0xfffdffff, 0xf7f7f6ff, 0xdfbf7fef, 0xfffeffbf},
+    {0xfeff77fe, 0xfffdffed, 0xffffedfd, 0xffffffef},
+    {0xefffff7b, 0x7ddfdfff, 0x7defffff, 0xfbeffdff},
+    {0xffdbffff, 0xeffffdff, 0xefffbf7f, 0xdf7fdfbf},
+    {0x7bff7dff, 0xffffffff, 0xfffdfffb, 0xfffefffb},
+    {0xffffffb7, 0xffbb77db, 0xff7ffbff, 0x7ef7fbff},
+    {0xfdfeefff, 0xfdfffdff, 0xdbeeff7f, 0xfffffefd},
+    {0x7fdffff7, 0xdfbffff7, 0xffffdfed, 0xf7edffef},
+    {0xf7fbfdfe, 0xfbf7bfff, 0xffb7ffff, 0xfeffbbff},
+    {0xffffffff, 0xfffffbbf, 0x7dfef7bf, 0xffbfffdf},
+    {0xfededfef, 0xdeff7ffd, 0xfffffefe, 0xdffdffff},
+    {0xdffffeff, 0xfffbf6ef, 0xff7fbff7, 0xfbffb7fe},
+    {0x7fffffbb, 0xffdfffff, 0xeff7ffff, 0xbfbbff6f},
+    {0xffbbbbff, 0xb7ffdfdf, 0xfffeff7b, 0xffffffff},
+    {0xf5fffffd, 0xffffffff, 0xfbbfdbdf, 0xfdefb7fe},
+    {0xfffffeff, 0xfdfdf6fd, 0xffffffff, 0xfffbff7f},
+    {0xffddeff7, 0x7fbfffef, 0xbefbffff, 0xefff7fff},
+    {0x77ffffbe, 0xefffffff, 0xefff6ffb, 0xfefffbdd},
+    {0xfef7fbff, 0xffdbbfff, 0xffeffb7f, 0xffddffff},
+    {0xffdfbfef, 0x7bfffb77, 0xfffdffef, 0xbfffdeef},
+    {0xefffff7f, 0xff7fdfff, 0xddffbfff, 0xfdfffffe},
+    {0x7dfdfffb, 0xffffffbf, 0xff7fff7b, 0x7fef7f7f},
+    {0xffbffdff, 0x7fedf7ff, 0xefefefff, 0xeffffbff},
+    {0xfffff7bf, 0xef7fffee, 0xfffbfdef, 0xff7fbfed},
+    {0xfbffbffb, 0xffff7dff, 0xfdffbfff, 0xfbf7feff},
+    {0x7f76ff7f, 0xfbffefff, 0x7fdfffbe, 0x6ffeefff},
+    {0xfffffbff, 0xfff7ffb7, 0xefff76ff, 0xffdffddf},
+    {0xddffdffe, 0xbeff77ff, 0xfefbfff7, 0xfdffbffe},
+    {0x7fbbfff7, 0xeffffef7, 0xffdfeffd, 0xfffdffff},
+    {0xffffff7f, 0xffb7ffff, 0xf7ff7eff, 0xffbff7ef},
+    {0xeeff77ef, 0xfffff7ff, 0xbefbffdf, 0xbbf77eff},
+    {0x7fefffff, 0x7bfefff7, 0xffdfffff, 0xfffff7bf},
+    {0xfdffff7f, 0xffeffddf, 0xeffeeef7, 0xffffbffd},
+    {0xffbbdbdd, 0xff7bbfff, 0xfef7ffbf, 0xfeddffff},
+    {0xfffeffff, 0xdffff7f7, 0xfffffffb, 0xdffffff7},
+    {0xfbffffff, 0xfddffdfe, 0xfffefdff, 0xfbffddbe},
+    {0xdf6fedee, 0x7fff7fdf, 0xefefffff, 0xfffeffff},
+    {0xffffffff, 0xfbfbffff, 0x7effbfff, 0xeeefffdf},
+    {0xfbfeffff, 0xbf7fdbfd, 0xfffbfdad, 0xffffbbff},
+    {0xdfffdbdb, 0xffffffb7, 0xefffffff, 0xddfbfff7},
+    {0xffeffefe, 0xfffbffff, 0xfddfbfff, 0xffeffeff},
+    {0xf77fffff, 0x6f6fb7ff, 0xfffbf7ff, 0xff7ff7fe},
+    {0x7fffbfff, 0xffffffef, 0xffffff7f, 0xffff7fbf},
+    {0xfbfdf7b6, 0xfdfeffff, 0xbf77bfed, 0xefdbfdef},
+    {0xff7fffff, 0xfff7fdfd, 0xffffefff, 0xfdfffffe},
+    {0xffefffff, 0xef7fdfb7, 0xf7defedf, 0xbfffb7ff},
+    {0xbbfdbdfb, 0xbffef7ff, 0xffffffff, 0xffbdffdb},
+    {0xffffefdf, 0xfbdfffff, 0xbdffb7fb, 0xfff7feff},
+    {0xffffffff, 0xfffbbf7f, 0xffedfddf, 0xf7ffffff},
+    {0xdeddffde, 0xdffff7ed, 0xf7ffffff, 0xfeffdbff},
+    {0xfffff6ff, 0xffefffff, 0x7fbfdffb, 0xfff6fffb},
+    {0xffffbffb, 0xf6ffbfff, 0xfffffbfe, 0xbfbffedf},
+    {0xff6fffbf, 0xfffdefde, 0xfbfdffdf, 0xf7ffdfff},
+    {0xdbfff7f7, 0xbfbffeff, 0xdeefff7f, 0xffff7bf7},
+    {0xffddfdff, 0xfdeffff7, 0xffffdfff, 0xfddfffff},
+    {0xffffdffe, 0xefffefff, 0xf7fbfff6, 0xfffdffde},
+    {0xeefbff7f, 0xfffefedf, 0xff5f7b7f, 0xdf7fbdfb},
+    {0x7ffffbf7, 0xbb77ffff, 0xefffffff, 0xfbffffff},
+    {0xffef7fff, 0xffffffff, 0x7ffdffb7, 0xfff77fff},
+    {0xfeffeedf, 0xeff777fb, 0xfb7ffbfe, 0xffbffbbf},
+    {0x77fdfffb, 0xfdbfffbf, 0xffffdfff, 0xbdffdff7},
+    {0xffdfdfff, 0xfffedfff, 0xfff7ffff, 0xfffefffe},
+    {0xfff7fbf7, 0xb7dffbdf, 0xdbbfbf6d, 0xdffbfdbf},
+    {0xfbff7f7f, 0xfffbfffb, 0xfffdffff, 0xfbffefff},
+    {0xdf7ffffe, 0xff7fffff, 0xffffebef, 0xffbffffd},
+    {0xfffbfbef, 0x6ffedb7f, 0xfeefff7f, 0xeffdffdf},
+    {0xbfffffbf, 0xffffffed, 0xdffdffff, 0xffefdb7f},
+    {0xf7ffafff, 0xfeb7ffff, 0xffffbbfd, 0x7f7fffff},
+    {0xfdbbfdff, 0xf7ffdfff, 0xfbdfff6f, 0xfffbffed},
+    {0xffffffef, 0xfffdfef7, 0xdfffffff, 0xfbffdfff},
+    {0x6fff7f7d, 0x7fefffff, 0xfef6efff, 0xfffffbdf},
+    {0xfdffefff, 0xfeff7bdf, 0xf7fffdf7, 0x6edbfffb},
+    {0xff6fffff, 0xf7ffffff, 0xbffbbffe, 0xffffbfff},
+    {0xfffefeff, 0xffffdffb, 0xffffffbf, 0xfffff6ff},
+    {0xdbfff7f6, 0xffb7fdff, 0xf6dffff7, 0xfbfbffef},
+    {0xff6fbf7f, 0xffff7fff, 0x7ffbbdff, 0xefef7fbf},
+    {0x7ffbffff, 0xbbffef6f, 0xffffeffd, 0xfefffffd},
+    {0xf7ffdfff, 0xff6fffff, 0xfeffffdf, 0xfffeedff},
+    {0xdfffff77, 0xdfffbfff, 0x6fedfdfb, 0xb7f7ffdf},
+    {0xff7bfbff, 0xfdfffddd, 0xffffbfff, 0xfffffefb},
+    {0xfbdfffef, 0x7fddffff, 0xfdffff7f, 0xfdfff7ff},
+    {0x7fff6ffd, 0xf7ffb7ff, 0xefdbeffb, 0x7fbf7fff},
+    {0xfff7ffff, 0xfffffef7, 0xfeff7fbf, 0xf7fbfbde},
+    {0xfb7fff7f, 0xfdfdffdf, 0xfffffffe, 0xfffffff7},
+    {0x7fffefff, 0xdfdfdfff, 0xfffbfbff, 0x6eefff7f},
+    {0xfffb7df7, 0xfffffffb, 0xb77fdff7, 0xffffb7ff},
+    {0xdfbfffff, 0xfdbef6ff, 0xffddff7e, 0xfffdfff7},
+    {0xfdf7dffe, 0xdff7ffdf, 0xffffb7ff, 0xefdfffbf},
+    {0xffffffdf, 0xf7ffbffb, 0xfbfffff7, 0xffff7efe},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(30)
+  {  // level 30: redness 240
+    {0xfffdf7ff, 0xfffffbff, 0xff7bffdf, 0xfff7efff},
+    {0xf77fbfff, 0xffefffff, 0xfffff7fd, 0xfffffff7},
+    {0xffffffee, 0xfeffdf7e, 0xefffffff, 0xf77ffbff},
+    {0xffffffff, 0xefffffff, 0xffbf7eff, 0xffff7fff},
+    {0xfef7feff, 0xfffffbef, 0xfdffffff, 0xbffffffd},
+    {0xffffffff, 0xffedffff, 0xfffffffe, 0xfdefff6f},
+    {0x7fffeffb, 0xffffffff, 0xffefffb7, 0xffffefff},
+    {0xfbfdffff, 0xff7fbfbf, 0x77ffdfff, 0xfffdffff},
+    {0xffeffdff, 0xefffffff, 0xfffdffff, 0x7fffffff},
+    {0xffffffef, 0xffefeefd, 0xfdfffeff, 0xeefffffb},
+    {0xdfffefff, 0xffffffff, 0xfffffff6, 0xffffff7f},
+    {0xffffffff, 0xffffffdf, 0xbfbfdfff, 0xffdf77ff},
+    {0xff6fff7f, 0xdfffbfff, 0xfff7ffff, 0xfffbffff},
+    {0xfffdfbfb, 0xfefffbfd, 0xf7feffbf, 0xfbffffb7},
+    {0xf7ffdfff, 0x7fefffbf, 0xffffefff, 0x7fff7fff},
+    {0xbfffffbf, 0xffffffff, 0xffffffff, 0xfefff7ff},
+    {0xff6fffff, 0xeffdffff, 0xffdffeff, 0xffffffff},
+    {0xffffdff7, 0xffdfbeff, 0xf7ffffdf, 0xffedfffe},
+    {0xfffffbff, 0xfffffffb, 0xffff7ffb, 0xdfffef77},
+    {0xdffeffff, 0xdeffffff, 0xffffffff, 0xffffffff},
+    {0xfdf7ffff, 0xffff7bbf, 0xeefbf7ff, 0xfefffffe},
+    {0xffffffdf, 0xfff7fffd, 0xffffffff, 0x7ffff7df},
+    {0xbffff7ff, 0xffffffff, 0xffffdfdf, 0xfff77fff},
+    {0xffeefffb, 0xfeffdfef, 0xfffffefd, 0xff7fffff},
+    {0xff7ffdff, 0xfffffeff, 0xfdf7ffff, 0x7ffffdff},
+    {0xffffffff, 0xdffdffff, 0xbfbeffff, 0xf7eeffef},
+    {0xefffbfff, 0xff7ffffe, 0xffffffdf, 0xffffffff},
+    {0xfffffff7, 0xfbffef6f, 0xfffffdff, 0xffffef7b},
+    {0xfefbfbff, 0xffffffff, 0xbdfbbffe, 0xf77fffff},
+    {0xffdf7ffe, 0xfffbffff, 0xffbfffef, 0xffffffff},
+    {0xbfffff7f, 0xffdfffff, 0xfffffeff, 0xffdddfff},
+    {0xfffff7ff, 0xbeffbfbf, 0xeffbffff, 0xfdfffffe},
+    {0xfdfffffd, 0xf7fff7ff, 0xfefff7ff, 0xbffffdbf},
+    {0xefefffdf, 0xfffffffd, 0xfffffffd, 0xfffeffff},
+    {0xffff7fff, 0xfffeffff, 0xfffdffdf, 0xff7ffffb},
+    {0xffffeeff, 0xdfb7deff, 0xbffffdff, 0xefefffff},
+    {0xfefffffe, 0xffffffff, 0xfddfeffd, 0xfffffeff},
+    {0x7ff7ffff, 0xfbffffdf, 0xffffffff, 0xfeffb7ef},
+    {0xf7ffffdf, 0xffffbfff, 0xfffbff7f, 0xbff7fffe},
+    {0xfffdffff, 0xfffffeff, 0xdfff7fef, 0xffffffff},
+    {0xfefff7ff, 0xfffdffed, 0xffffefff, 0xffffffff},
+    {0xefffff7b, 0x7ddfdfff, 0xfdefffff, 0xfbeffdff},
+    {0xffdfffff, 0xeffffdff, 0xffffff7f, 0xdf7fdfbf},
+    {0x7fff7fff, 0xffffffff, 0xfffdfffb, 0xfffefffb},
+    {0xffffffbf, 0xffbf7fdf, 0xff7ffbff, 0xffffffff},
+    {0xfdffefff, 0xfdfffdff, 0xdfffffff, 0xfffffeff},
+    {0x7fdffff7, 0xdfffffff, 0xffffdfef, 0xf7efffef},
+    {0xf7fbfdfe, 0xfff7bfff, 0xfff7ffff, 0xfeffbbff},
+    {0xffffffff, 0xfffffbbf, 0x7dfeffff, 0xffffffff},
+    {0xfeffdfff, 0xfefffffd, 0xfffffefe, 0xffffffff},
+    {0xdfffffff, 0xfffbffff, 0xff7ffff7, 0xfbffbfff},
+    {0xffffffbb, 0xffdfffff, 0xeff7ffff, 0xbfbbff6f},
+    {0xffbbbbff, 0xb7ffdfdf, 0xfffeffff, 0xffffffff},
+    {0xf7ffffff, 0xffffffff, 0xffffdbdf, 0xfdfff7fe},
+    {0xfffffeff, 0xfffdfefd, 0xffffffff, 0xffffff7f},
+    {0xffddfff7, 0xffbfffff, 0xfeffffff, 0xefff7fff},
+    {0x7fffffff, 0xefffffff, 0xefff7ffb, 0xfffffbfd},
+    {0xfefffbff, 0xfffbbfff, 0xffeffb7f, 0xffddffff},
+    {0xffffbfff, 0x7bfffb77, 0xffffffff, 0xbfffffef},
+    {0xefffff7f, 0xffffffff, 0xffffbfff, 0xfdfffffe},
+    {0x7ffdfffb, 0xffffffff, 0xff7fffff, 0xffef7f7f},
+    {0xffbfffff, 0xffeff7ff, 0xefffffff, 0xeffffbff},
+    {0xfffff7ff, 0xef7fffef, 0xfffbfdef, 0xff7ffffd},
+    {0xfbffbffb, 0xffff7dff, 0xfdffbfff, 0xffffffff},
+    {0x7ff7ff7f, 0xffffffff, 0xffdfffbe, 0xeffeefff},
+    {0xffffffff, 0xfff7ffbf, 0xeffff7ff, 0xffdffddf},
+    {0xfdffdffe, 0xfeff77ff, 0xfefbffff, 0xfdfffffe},
+    {0xffbbfff7, 0xeffffff7, 0xfffffffd, 0xfffdffff},
+    {0xffffff7f, 0xfff7ffff, 0xf7ff7eff, 0xffbfffef},
+    {0xefff77ff, 0xfffff7ff, 0xffffffdf, 0xbbfffeff},
+    {0x7fefffff, 0x7bffffff, 0xffdfffff, 0xfffff7ff},
+    {0xfdffffff, 0xffffffdf, 0xeffeefff, 0xfffffffd},
+    {0xfffffbdd, 0xff7bbfff, 0xfeffffbf, 0xffddffff},
+    {0xfffeffff, 0xdfffffff, 0xfffffffb, 0xdffffff7},
+    {0xffffffff, 0xfffffdfe, 0xfffffdff, 0xfbffddff},
+    {0xdf6ffdee, 0xffff7fdf, 0xefefffff, 0xffffffff},
+    {0xffffffff, 0xfbfbffff, 0x7effbfff, 0xffefffdf},
+    {0xfbfeffff, 0xbf7ffbfd, 0xfffffded, 0xffffbfff},
+    {0xffffdffb, 0xffffffbf, 0xffffffff, 0xddfbfff7},
+    {0xffeffeff, 0xfffbffff, 0xfddfbfff, 0xfffffeff},
+    {0xff7fffff, 0xef7fbfff, 0xfffbf7ff, 0xff7ff7fe},
+    {0x7fffffff, 0xffffffef, 0xffffff7f, 0xffff7fff},
+    {0xfbfdf7be, 0xffffffff, 0xbf7fffed, 0xeffbffef},
+    {0xffffffff, 0xfff7fdfd, 0xffffefff, 0xfdffffff},
+    {0xffefffff, 0xff7fdfbf, 0xf7defeff, 0xfffff7ff},
+    {0xbbffbdfb, 0xbfffffff, 0xffffffff, 0xffbdfffb},
+    {0xffffffdf, 0xfbffffff, 0xbffffffb, 0xfffffeff},
+    {0xffffffff, 0xfffbbf7f, 0xfffdfddf, 0xf7ffffff},
+    {0xdeddfffe, 0xdffff7ed, 0xf7ffffff, 0xfeffdfff},
+    {0xfffff7ff, 0xffefffff, 0xffbfdffb, 0xfff7fffb},
+    {0xffffbfff, 0xfeffffff, 0xfffffbff, 0xbffffedf},
+    {0xffefffbf, 0xfffdeffe, 0xfffdffff, 0xffffdfff},
+    {0xfbfffff7, 0xfffffeff, 0xdeefff7f, 0xffffffff},
+    {0xfffdffff, 0xfdeffff7, 0xffffdfff, 0xfddfffff},
+    {0xffffdffe, 0xefffefff, 0xfffffff6, 0xfffdffde},
+    {0xeeffff7f, 0xfffefeff, 0xffdffbff, 0xdfffbdff},
+    {0xfffffbf7, 0xff7fffff, 0xefffffff, 0xffffffff},
+    {0xffef7fff, 0xffffffff, 0x7ffdffbf, 0xfff7ffff},
+    {0xffffffdf, 0xeff777fb, 0xff7ffbfe, 0xffbfffbf},
+    {0x77fdffff, 0xfdffffbf, 0xffffdfff, 0xbdffdff7},
+    {0xffdfffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xfffffbf7, 0xfffffbff, 0xdbbfff7d, 0xfffbfdff},
+    {0xffff7f7f, 0xfffbfffb, 0xfffdffff, 0xffffefff},
+    {0xdf7ffffe, 0xff7fffff, 0xffffefef, 0xffbffffd},
+    {0xfffbffef, 0xefffdf7f, 0xfeefffff, 0xeffdffdf},
+    {0xffffffff, 0xfffffffd, 0xdfffffff, 0xfffffbff},
+    {0xffffbfff, 0xfef7ffff, 0xffffbbfd, 0x7f7fffff},
+    {0xfdbbfdff, 0xf7ffdfff, 0xffffff7f, 0xfffbfffd},
+    {0xffffffef, 0xfffffef7, 0xdfffffff, 0xffffdfff},
+    {0x6fffff7d, 0x7fefffff, 0xfef6efff, 0xfffffbdf},
+    {0xffffefff, 0xfeff7bdf, 0xfffffdf7, 0xeefbfffb},
+    {0xffefffff, 0xf7ffffff, 0xbfffffff, 0xffffbfff},
+    {0xfffeffff, 0xfffffffb, 0xffffffbf, 0xfffffeff},
+    {0xdffff7f6, 0xffb7fdff, 0xf7dffff7, 0xffffffef},
+    {0xff7fff7f, 0xffff7fff, 0x7ffbbdff, 0xefefffff},
+    {0x7ffbffff, 0xbbffffef, 0xffffffff, 0xfeffffff},
+    {0xf7ffdfff, 0xffefffff, 0xfeffffdf, 0xfffeedff},
+    {0xffffff77, 0xffffbfff, 0xefeffdff, 0xbff7ffdf},
+    {0xff7bfbff, 0xfdfffddd, 0xffffbfff, 0xfffffffb},
+    {0xffffffff, 0x7fddffff, 0xffffffff, 0xffffffff},
+    {0x7fff7ffd, 0xfffff7ff, 0xeffbfffb, 0xffbf7fff},
+    {0xfff7ffff, 0xffffffff, 0xfeff7fbf, 0xf7fbfbde},
+    {0xfbffff7f, 0xfdfdffdf, 0xffffffff, 0xffffffff},
+    {0xffffefff, 0xdfdfdfff, 0xfffffbff, 0x7effff7f},
+    {0xfffb7df7, 0xfffffffb, 0xb7fffff7, 0xffffbfff},
+    {0xdfbfffff, 0xfffffeff, 0xffddff7e, 0xfffdfff7},
+    {0xfdfffffe, 0xfff7ffff, 0xffffbfff, 0xefdfffff},
+    {0xffffffdf, 0xf7ffbffb, 0xfbffffff, 0xfffffefe},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(31)
+  {  // level 31: redness 248
+    {0xfffdf7ff, 0xffffffff, 0xffffffdf, 0xffffffff},
+    {0xf7ffffff, 0xffefffff, 0xffffffff, 0xffffffff},
+    {0xfffffffe, 0xffffffff, 0xefffffff, 0xff7fffff},
+    {0xffffffff, 0xffffffff, 0xffbf7fff, 0xffff7fff},
+    {0xfffffeff, 0xfffffbef, 0xffffffff, 0xfffffffd},
+    {0xffffffff, 0xffffffff, 0xfffffffe, 0xffffff7f},
+    {0x7fffefff, 0xffffffff, 0xffffffbf, 0xffffefff},
+    {0xfbffffff, 0xffffbfff, 0xffffffff, 0xfffdffff},
+    {0xffefffff, 0xefffffff, 0xfffdffff, 0xffffffff},
+    {0xffffffef, 0xffefffff, 0xfdffffff, 0xeeffffff},
+    {0xffffffff, 0xffffffff, 0xfffffff7, 0xffffff7f},
+    {0xffffffff, 0xffffffdf, 0xbfffffff, 0xffffffff},
+    {0xff7fff7f, 0xffffbfff, 0xffffffff, 0xfffbffff},
+    {0xffffffff, 0xfefffffd, 0xfffeffff, 0xfffffff7},
+    {0xf7ffdfff, 0x7fffffff, 0xffffffff, 0x7fffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xfefff7ff},
+    {0xffefffff, 0xfffdffff, 0xffdffeff, 0xffffffff},
+    {0xfffffff7, 0xfffffeff, 0xf7ffffff, 0xffefffff},
+    {0xfffffbff, 0xfffffffb, 0xffff7ffb, 0xffffffff},
+    {0xfffeffff, 0xdfffffff, 0xffffffff, 0xffffffff},
+    {0xfdffffff, 0xffff7fff, 0xfffff7ff, 0xfefffffe},
+    {0xffffffdf, 0xffffffff, 0xffffffff, 0x7ffff7df},
+    {0xbfffffff, 0xffffffff, 0xffffffdf, 0xffff7fff},
+    {0xffefffff, 0xfeffffff, 0xffffffff, 0xffffffff},
+    {0xfffffdff, 0xfffffeff, 0xfdf7ffff, 0xffffffff},
+    {0xffffffff, 0xdffdffff, 0xbfffffff, 0xf7efffff},
+    {0xffffbfff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffefef, 0xfffffdff, 0xffffef7b},
+    {0xfefbffff, 0xffffffff, 0xffffbfff, 0xffffffff},
+    {0xfffffffe, 0xfffbffff, 0xffbfffef, 0xffffffff},
+    {0xbfffff7f, 0xffffffff, 0xffffffff, 0xffdfffff},
+    {0xffffffff, 0xbeffffbf, 0xeffbffff, 0xfdffffff},
+    {0xffffffff, 0xfffff7ff, 0xfffff7ff, 0xffffffbf},
+    {0xffefffff, 0xfffffffd, 0xffffffff, 0xfffeffff},
+    {0xffff7fff, 0xfffeffff, 0xffffffdf, 0xffffffff},
+    {0xfffffeff, 0xffbfffff, 0xffffffff, 0xffffffff},
+    {0xfefffffe, 0xffffffff, 0xfdfffffd, 0xffffffff},
+    {0xffffffff, 0xfbffffdf, 0xffffffff, 0xfeffbfef},
+    {0xffffffff, 0xffffbfff, 0xfffbffff, 0xfff7ffff},
+    {0xfffdffff, 0xffffffff, 0xdfffffff, 0xffffffff},
+    {0xfffff7ff, 0xfffffffd, 0xffffefff, 0xffffffff},
+    {0xeffffffb, 0x7fdfffff, 0xffffffff, 0xfffffdff},
+    {0xffdfffff, 0xfffffdff, 0xffffff7f, 0xdf7fffff},
+    {0xffff7fff, 0xffffffff, 0xfffdffff, 0xfffefffb},
+    {0xffffffbf, 0xffff7fdf, 0xff7fffff, 0xffffffff},
+    {0xfdffffff, 0xfdffffff, 0xdfffffff, 0xffffffff},
+    {0x7fffffff, 0xffffffff, 0xffffdfef, 0xf7efffff},
+    {0xfffbfffe, 0xfff7ffff, 0xfff7ffff, 0xfffffbff},
+    {0xffffffff, 0xfffffbff, 0xffffffff, 0xffffffff},
+    {0xffffdfff, 0xffffffff, 0xfffffefe, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xff7fffff, 0xffffffff},
+    {0xffffffbf, 0xffffffff, 0xefffffff, 0xbffbffef},
+    {0xffbfffff, 0xf7ffdfff, 0xfffeffff, 0xffffffff},
+    {0xf7ffffff, 0xffffffff, 0xfffffbdf, 0xfdfff7fe},
+    {0xffffffff, 0xfffdfefd, 0xffffffff, 0xffffffff},
+    {0xfffdfff7, 0xffbfffff, 0xffffffff, 0xffff7fff},
+    {0xffffffff, 0xffffffff, 0xefff7fff, 0xffffffff},
+    {0xfefffbff, 0xffffffff, 0xffefff7f, 0xffdfffff},
+    {0xffffffff, 0x7bfffbff, 0xffffffff, 0xbfffffef},
+    {0xefffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xfffdfffb, 0xffffffff, 0xff7fffff, 0xffff7fff},
+    {0xffffffff, 0xffefffff, 0xefffffff, 0xfffffbff},
+    {0xfffff7ff, 0xffffffef, 0xfffffdef, 0xff7fffff},
+    {0xfbffffff, 0xffff7dff, 0xffffbfff, 0xffffffff},
+    {0x7ff7ff7f, 0xffffffff, 0xfffffffe, 0xefffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffdf},
+    {0xffffffff, 0xfeffffff, 0xfefbffff, 0xfffffffe},
+    {0xfffffff7, 0xeffffff7, 0xffffffff, 0xfffdffff},
+    {0xffffffff, 0xfff7ffff, 0xfffffeff, 0xffbfffff},
+    {0xfffff7ff, 0xfffff7ff, 0xffffffff, 0xbfffffff},
+    {0x7fefffff, 0xffffffff, 0xffdfffff, 0xfffff7ff},
+    {0xfdffffff, 0xffffffdf, 0xefffefff, 0xfffffffd},
+    {0xffffffdf, 0xff7fffff, 0xffffffbf, 0xfffdffff},
+    {0xfffeffff, 0xdfffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xfbfffdff},
+    {0xfffffdff, 0xffff7fff, 0xffefffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0x7fffbfff, 0xffefffff},
+    {0xfbffffff, 0xfffffbfd, 0xfffffdef, 0xffffbfff},
+    {0xffffdffb, 0xffffffff, 0xffffffff, 0xdfffffff},
+    {0xffefffff, 0xffffffff, 0xfdffffff, 0xfffffeff},
+    {0xffffffff, 0xef7fbfff, 0xfffbffff, 0xff7fffff},
+    {0x7fffffff, 0xffffffef, 0xffffff7f, 0xffffffff},
+    {0xfbffffbe, 0xffffffff, 0xfffffffd, 0xffffffef},
+    {0xffffffff, 0xfff7fdff, 0xffffefff, 0xffffffff},
+    {0xffefffff, 0xffffffff, 0xf7dfffff, 0xfffff7ff},
+    {0xffffbfff, 0xffffffff, 0xffffffff, 0xffbdffff},
+    {0xffffffdf, 0xfbffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xfffffdff, 0xf7ffffff},
+    {0xdeffffff, 0xfffff7ef, 0xffffffff, 0xffffdfff},
+    {0xfffff7ff, 0xffffffff, 0xffffdffb, 0xfff7fffb},
+    {0xffffffff, 0xfeffffff, 0xffffffff, 0xbffffeff},
+    {0xffefffbf, 0xfffdffff, 0xfffdffff, 0xffffffff},
+    {0xffffffff, 0xfffffeff, 0xfeffff7f, 0xffffffff},
+    {0xffffffff, 0xfffffff7, 0xffffffff, 0xfdffffff},
+    {0xffffdfff, 0xefffefff, 0xffffffff, 0xfffffffe},
+    {0xfeffffff, 0xffffffff, 0xffffffff, 0xffffbdff},
+    {0xfffffff7, 0xff7fffff, 0xefffffff, 0xffffffff},
+    {0xffefffff, 0xffffffff, 0xfffdffbf, 0xfff7ffff},
+    {0xffffffff, 0xffff7fff, 0xff7ffffe, 0xffffffff},
+    {0xf7ffffff, 0xffffffbf, 0xffffffff, 0xbdffdff7},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xfffffbf7, 0xffffffff, 0xdfffffff, 0xffffffff},
+    {0xffff7fff, 0xfffbfffb, 0xfffdffff, 0xffffffff},
+    {0xdf7fffff, 0xff7fffff, 0xffffefef, 0xffbfffff},
+    {0xffffffff, 0xefffdf7f, 0xfeffffff, 0xeffdffdf},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xfffffbff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xfdfbfdff, 0xffffffff, 0xffffff7f, 0xffffffff},
+    {0xffffffef, 0xfffffef7, 0xdfffffff, 0xffffffff},
+    {0xffffffff, 0x7fefffff, 0xfef7efff, 0xffffffdf},
+    {0xffffefff, 0xffff7fff, 0xffffffff, 0xfefbffff},
+    {0xffefffff, 0xf7ffffff, 0xffffffff, 0xffffbfff},
+    {0xffffffff, 0xfffffffb, 0xffffffbf, 0xfffffeff},
+    {0xdffffffe, 0xffbffdff, 0xffffffff, 0xffffffff},
+    {0xffffff7f, 0xffffffff, 0x7fffbfff, 0xffffffff},
+    {0xfffbffff, 0xbfffffff, 0xffffffff, 0xfeffffff},
+    {0xffffffff, 0xffffffff, 0xfeffffff, 0xfffeffff},
+    {0xfffffff7, 0xffffbfff, 0xfffffdff, 0xbfffffdf},
+    {0xff7ffbff, 0xfdfffdff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0x7fffffff, 0xffffffff, 0xfffbffff, 0xffbfffff},
+    {0xfff7ffff, 0xffffffff, 0xfeffffff, 0xf7fbfbff},
+    {0xfbffff7f, 0xfffdffdf, 0xffffffff, 0xffffffff},
+    {0xffffefff, 0xdfdfffff, 0xfffffbff, 0xffffffff},
+    {0xfffffff7, 0xffffffff, 0xbffffff7, 0xffffbfff},
+    {0xffbfffff, 0xfffffeff, 0xffdfffff, 0xfffffff7},
+    {0xffffffff, 0xffffffff, 0xffffbfff, 0xefdfffff},
+    {0xffffffff, 0xf7ffbffb, 0xffffffff, 0xfffffeff},
+  },
+#endif
+#if DITHER_PLANE_SELECTED(32)
+  {  // level 32: redness 255
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+  },
+#endif
+};
+
+
+const int DITHER_PLANE_HEIGHT =
+  sizeof(*DITHER_PLANES) / sizeof(**DITHER_PLANES);
+const int DITHER_PLANE_WIDTH =
+  sizeof(**DITHER_PLANES) / sizeof(***DITHER_PLANES) * 32;
+
+#endif  // DITHER_LEVELS
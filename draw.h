@@ -1,11 +1,23 @@
 #pragma once
 
 #include <string>
+#include <algorithm>
 
 #include <esphome.h>
 
+#include "layout.h"
+#include "graphday.h"
+#include "graphstats.h"
+#include "displaylist.h"
+#include "price.h"
+#include "prices.h"
 #include "ticks.h"
+#include "gradient.h"
+#include "cheapest.h"
 #include "dither.h"
+#include "framebuffer.h"
+#include "refresh.h"
+#include "scheduler.h"
 
 
 // Localization settings.
@@ -31,241 +43,300 @@ bool price_at_warning_level = false;
 
 inline void on_price_warning_switch_change() {
   if (price_at_warning_level)
-    id(epaper).update();
+    request_display_update(UPDATE_COSMETIC);
 }
 
+inline void on_cheapest_window_settings_change() {
+  update_cheapest_window();
+  request_display_update(UPDATE_COSMETIC);
+}
 
-template<typename T>
-static void draw(T& it) {
-
-  const int BAR_WIDTH = 4;
-  const int GRAPH_MARGIN_TOP = 6;  // space for topmost axis label
+inline void on_gradient_change() {
+  invalidate_gradient();
+  request_display_update(UPDATE_COSMETIC);
+}
 
-  // This should be divisible by as many of 2, 3, 4, and 5 as
-  // possible (and also 7 and 9 as a secondary objective)
-  const int GRAPH_YGRID_HEIGHT = 100;
 
-  const int HOUR_INDICATOR_HEIGHT = 4;
+// Time axis of the frames drawn
+GraphDay shown_day;
+
+// Everything the layout of a frame depends on, besides the layout,
+// fonts and images. Frames with the same inputs have the same display
+// list (see displaylist.h).
+struct FrameInputs {
+  uint32_t price_builds;  // price_index.build_count()
+  time_t midnight;  // start of the day shown
+  int current_slot;  // from midnight
+  int slot_minutes;
+  bool show_past_hours;
+  bool price_warning;
+  uint32_t gradient;  // gradient_generation
+  float gradient_bottom;
+  float gradient_top;
+  int cheapest_start;
+  int cheapest_slots;
+
+  bool operator==(const FrameInputs& other) const {
+    return price_builds == other.price_builds &&
+      midnight == other.midnight &&
+      current_slot == other.current_slot &&
+      slot_minutes == other.slot_minutes &&
+      show_past_hours == other.show_past_hours &&
+      price_warning == other.price_warning &&
+      gradient == other.gradient &&
+      // (NaN never matches, so it's laid out again)
+      gradient_bottom == other.gradient_bottom &&
+      gradient_top == other.gradient_top &&
+      cheapest_start == other.cheapest_start &&
+      cheapest_slots == other.cheapest_slots;
+  }
+};
+
+// Inputs of the frame at now. Updates shown_day.
+inline FrameInputs frame_inputs(const ESPTime& now) {
+  const PriceStore& prices = id(price_store);
+  shown_day.update(now, prices);
+  return {
+    price_index.build_count(),
+    shown_day.midnight,
+    shown_day.slot_at(prices, now.timestamp),
+    prices.slot_minutes(),
+    id(show_past_hours_switch).state,
+    id(price_warning_switch).state,
+    gradient_generation,
+    id(gradient_bottom).state,
+    id(gradient_top).state,
+    cheapest_window.start,
+    cheapest_window.slots,
+  };
+}
 
-  const int CUR_PRICE_TOP = 3;
-  const int CUR_PRICE_WIDTH = 48;
 
-  const int GRAPH_WIDTH = 48*BAR_WIDTH;
-  const int GRAPH_HEIGHT = GRAPH_YGRID_HEIGHT + GRAPH_MARGIN_TOP;
-  static const int screen_width = it.get_width();
-  static const int graph_left =
-    CUR_PRICE_WIDTH + (screen_width - CUR_PRICE_WIDTH - GRAPH_WIDTH)/2;
-  static const int screen_height = it.get_height();
-  static const int graph_margin_bottom = screen_height - GRAPH_HEIGHT;
+// Lay out the frame of inputs (from frame_inputs(now)) into list.
+// Rebuilds redness_table if needed for the bars. it is only used to
+// measure text.
+template<typename Layout = Layout2in9, typename T>
+static void lay_out_frame(
+  T& it, const ESPTime& now, const FrameInputs& inputs,
+  DisplayList<Layout::GRAPH_WIDTH>& list,
+  RednessTable<Layout::SCREEN_HEIGHT>& redness_table)
+{
+  constexpr int BAR_WIDTH = Layout::BAR_WIDTH;
+  constexpr int GRAPH_YGRID_HEIGHT = Layout::GRAPH_YGRID_HEIGHT;
+  constexpr int HOUR_INDICATOR_HEIGHT = Layout::HOUR_INDICATOR_HEIGHT;
+  constexpr int CUR_PRICE_TOP = Layout::CUR_PRICE_TOP;
+  constexpr int CUR_PRICE_WIDTH = Layout::CUR_PRICE_WIDTH;
+  constexpr int GRAPH_WIDTH = Layout::GRAPH_WIDTH;
+  constexpr int GRAPH_HEIGHT = Layout::GRAPH_HEIGHT;
+  constexpr int screen_width = Layout::SCREEN_WIDTH;
+  constexpr int screen_height = Layout::SCREEN_HEIGHT;
+  constexpr int graph_left = Layout::GRAPH_LEFT;
+  constexpr int graph_margin_bottom = Layout::GRAPH_MARGIN_BOTTOM;
+
+  list.clear();
 
   esphome::font::Font* font = &id(main_font);
   esphome::font::Font* price_font = &id(cur_price_font);
-  const Color& color_red = id(red);
 
-  static const int cur_date_height = font->get_height();
-  static const int cur_date_baseline_from_bottom =
+  const int cur_date_height = font->get_height();
+  const int cur_date_baseline_from_bottom =
     cur_date_height - font->get_baseline();
-  static const int cur_date_bottom =
+  const int cur_date_bottom =
     screen_height - 1 + cur_date_baseline_from_bottom;
-  static const int price_alert_icon_bottom = cur_date_bottom - cur_date_height;
-
-  const auto& prices = id(hourly_prices);
-  auto prices_it = prices.cbegin();
-  const auto prices_end = prices.cend();
-
-  // prices contains values for 2 days. If we're at 2nd day, skip 1st
-  // day. If we're even further ahead, then we have no usable data.
-  ESPTime now = id(homeassistant_time).now();
-  ESPTime& start_date = id(prices_start_date);
-  if (now.year != start_date.year ||
-      now.month != start_date.month ||
-      now.day_of_month != start_date.day_of_month)
-  {
-    ESPTime next_day_from_start(start_date);
-    next_day_from_start.increment_day();
-
-    if (now.year == next_day_from_start.year &&
-        now.month == next_day_from_start.month &&
-        now.day_of_month == next_day_from_start.day_of_month)
-    {
-      prices_it += 24;
-    }
-    else {
-      prices_it = prices_end;
-      ESP_LOGW("draw", "No data available for today. Data starts at %s",
-               start_date.strftime(std::string("%F %T%z")).c_str());
-    }
-  }
-
-  float current_price = now.hour >= 0 && now.hour < 24
-    ? prices_it[now.hour]
-    : NAN;  // this shouldn't happen, but let's not crash if it does
-
-  bool show_past_hours = id(show_past_hours_switch).state;
-  if (!show_past_hours)
-    prices_it += now.hour;
-
-  float max_price = -INFINITY;
-  // Calculate max value NaN-safely.
-  // If there are no non-NaN values, max_price = -INFINITY.
-  for (auto it = prices_it; it != prices_end; ++it)
-    if (*it > max_price)
-      max_price = *it;
+  const int price_alert_icon_bottom = cur_date_bottom - cur_date_height;
+
+  const PriceStore& prices = id(price_store);
+  static_assert(PriceStore::DAYS * 24 == Layout::HOURS,
+                "Layout::HOURS doesn't match PriceStore");
+  const int slots_per_hour = prices.slots_per_hour();
+  // slots of today and tomorrow
+  const int shown_slots = Layout::HOURS * slots_per_hour;
+
+  // Slot and hour of the graph (see GraphDay) of current time, and
+  // the absolute slot (see PriceStore) of the start of today. Slots
+  // that prices don't have, e.g. tomorrow's before they're published,
+  // are missing.
+  const GraphDay& day = shown_day;
+  const int current_slot = inputs.current_slot;
+  const int current_hour = current_slot / slots_per_hour;
+  const int32_t day_first_slot = day.first_slot;
+  const price_t current_price = prices.at(day_first_slot + current_slot);
+
+  bool show_past_hours = inputs.show_past_hours;
+  // first shown slot, from start of day
+  const int first_shown = show_past_hours ? 0 : current_hour * slots_per_hour;
+
+  // Highest shown price, y-axis ticks and bar heights. Recalculated
+  // only when the prices, the day or the first shown slot changed.
+  static GraphStats<Layout> stats;
+  if (stats.update(prices, day_first_slot, first_shown))
+    ESP_LOGD("draw", "graph stats: max %d, scale %d c",
+             stats.max_price, stats.max_ygrid_val());
 
   // show alert icon if no actual values
-  if (!std::isfinite(max_price)) {
+  if (stats.max_price == PRICE_MISSING) {
     ESP_LOGW("draw", "No data!");
-    it.image(
+    list.image(
       screen_width / 2, screen_height / 2,
       &id(no_data_icon),
       ImageAlign::CENTER);
-    ESP_LOGD("draw", "Finished drawing.");
     return;
   }
 
   // print current price
   {
     char str[16];
-    if (std::isfinite(current_price)) {
-      snprintf(
-        str, sizeof(str), "%.*f",
-        current_price < 10.0f && current_price > -10.0f ? 1 : 0,
-        current_price);
-      for (char& c : str) {
-        if (c == '\0')
-          break;
-        if (c == '.') {
-          c = DECIMAL_SEPARATOR;
-          break;
-        }
-      }
-    }
-    else {
-      str[0] = '?';
-      str[1] = '\0';
-    }
+    format_price(str, sizeof(str), current_price, DECIMAL_SEPARATOR);
 
-    it.print(
-      0, CUR_PRICE_TOP,
+    list.text(
+      it, 0, CUR_PRICE_TOP,
       price_font, TextAlign::TOP_LEFT,
       str);
-    it.print(
-      0, CUR_PRICE_TOP + price_font->get_height(),
+    list.text(
+      it, 0, CUR_PRICE_TOP + price_font->get_height(),
       font, TextAlign::TOP_LEFT,
       PRICE_UNIT);
 
     // Check if price at warning level. Show warning if warnings
     // enabled. Use gradient values. If within gradient, show black
     // icon. If above gradient, show red icon.
-    price_at_warning_level = current_price >= id(gradient_bottom).state;
-    if (price_at_warning_level && id(price_warning_switch).state) {
+    price_at_warning_level =
+      price_at_least(current_price, inputs.gradient_bottom);
+    if (price_at_warning_level && inputs.price_warning) {
       esphome::image::Image* img = &id(price_alert_icon);
       bool center = img->get_width() < CUR_PRICE_WIDTH;
-      it.image(
+      list.image(
         center ? CUR_PRICE_WIDTH/2 : 0,
         price_alert_icon_bottom,
         img,
         center ? ImageAlign::BOTTOM_CENTER : ImageAlign::BOTTOM_LEFT,
-        current_price < id(gradient_top).state
-        ? esphome::display::COLOR_ON
-        : color_red);
+        price_at_least(current_price, inputs.gradient_top));
     }
   }
 
   // Print current date.
   // This should make it more noticable when device loses power and
   // displays old data.
-  it.printf(
-    CUR_PRICE_WIDTH/2, cur_date_bottom,
-    font, TextAlign::BOTTOM_CENTER,
-    CUR_DATE_PRINTF(start_date));
+  {
+    char str[16];
+    snprintf(str, sizeof(str), CUR_DATE_PRINTF(now));
+    list.text(
+      it, CUR_PRICE_WIDTH/2, cur_date_bottom,
+      font, TextAlign::BOTTOM_CENTER,
+      str);
+  }
 
   // calculate and draw graph
 
-  const auto yticks = pleasing_ticks(
-    // Use space above top y-gridline.
-    // Calculate tick placement using a scaled top value.
-    std::ceil((max_price * GRAPH_YGRID_HEIGHT) / GRAPH_HEIGHT));
-  const auto max_ygrid_val = yticks[0];
-
-  float pixels_per_cent = float(GRAPH_YGRID_HEIGHT) / float(max_ygrid_val);
-  float gradient_top_px =
-    GRAPH_HEIGHT - (id(gradient_top).state * pixels_per_cent);
-  float gradient_bottom_px =
-    GRAPH_HEIGHT - (id(gradient_bottom).state * pixels_per_cent);
-  ESP_LOGD(
-    "draw", "gradient: %g...%g c => %g...%g px",
-    id(gradient_bottom).state,
-    id(gradient_top).state,
-    gradient_bottom_px,
-    gradient_top_px);
+  const Ticks& yticks = stats.yticks;
+  const int max_ygrid_val = stats.max_ygrid_val();
+
+  // y coordinate of price (max_ygrid_val is in cents)
+  auto price_to_px = [&](price_t price) { return stats.price_to_px(price); };
+  // Redness of each row of the bars. Kept between frames, and rebuilt
+  // only when the gradient or the y-axis scale changes.
+  if (!redness_table.valid(max_ygrid_val)) {
+    GradientStop stops[MAX_GRADIENT_STOPS];
+    const int n = current_gradient_stops(stops);
+    redness_table.build(stops, n, price_to_px, max_ygrid_val);
+    ESP_LOGD("draw", "gradient: %d stops, rebuilt for scale %d c",
+             n, max_ygrid_val);
+  }
+  list.redness_builds = redness_table.build_count();
 
   BlackRedBars dithered_bar_drawer(
-    gradient_top_px, gradient_bottom_px,
+    redness_table.get(),
     GRAPH_HEIGHT,  // base y
     screen_height,  // y limit
     BAR_WIDTH - 1);  // bar width
 
-  // draw bars
+  // Bars of the heights in stats (see GraphStats). Only which columns
+  // are current or past depends on the time here. Columns are
+  // collected for the whole graph, and drawn row by row.
+  const int columns_per_hour =
+    slots_per_hour == 1 ? BAR_WIDTH - 1 : BAR_WIDTH;
+  const int column_gap = BAR_WIDTH - columns_per_hour;
+  int indicator_x = -1;  // current slot
+  int indicator_height = 0;  // highest bar at indicator
+  for (int hour = show_past_hours ? 0 : current_hour; hour < Layout::HOURS;
+       ++hour)
   {
-    int hour = 0;
-    int left_x = graph_left;
-    if (!show_past_hours) {
-      hour = now.hour;
-      left_x += hour * BAR_WIDTH;
+    const int first_slot = hour * slots_per_hour;
+    int current_first_col = -1, current_cols = 0;
+
+    for (int col = 0; col < columns_per_hour; ++col) {
+      // slots [begin, end) of this hour shown in this column
+      int begin, end;
+      column_slots(col, slots_per_hour, columns_per_hour, &begin, &end);
+      begin += first_slot;
+      end += first_slot;
+      const int x = hour * BAR_WIDTH + column_gap + col;
+      const int height = stats.height(x);
+
+      const bool current = current_slot >= begin && current_slot < end;
+      if (current) {
+        if (current_first_col < 0)
+          current_first_col = col;
+        ++current_cols;
+        if (height != BlackRedBars::NO_BAR)
+          indicator_height = std::max(indicator_height, height);
+      }
+      dithered_bar_drawer.set_column(
+        list.bars, x, height,
+        current,  // red if current slot
+        end <= current_slot);  // greyed out if in the past
     }
 
-    for (; prices_it != prices_end;
-         ++hour, ++prices_it, left_x += BAR_WIDTH)
-    {
-      float height = std::round(
-        GRAPH_YGRID_HEIGHT * *prices_it / max_ygrid_val);
-      ESP_LOGV("draw", "hour %02d: value = %g, height = %g px",
-               hour, *prices_it, height);
-
-      // draw bar
-      if (std::isfinite(height))
-        dithered_bar_drawer.draw_bar(
-          left_x + 1, height,
-          hour == now.hour,  // red if current hour
-          hour < now.hour);  // greyed out if in the past
-
-      // draw current hour indicator
-      if (hour == now.hour) {
-        int center_x = left_x + BAR_WIDTH/2;
-        for (int y=1; y < screen_height; y += 2)
-          it.draw_pixel_at(center_x, y, color_red);
-
-        // draw triangle at bottom and also at top if it doesn't
-        // overlap with price bar
-        for (int y = screen_height - HOUR_INDICATOR_HEIGHT, x = center_x, w = 1;
-             y < screen_height;
-             ++y, --x, w += 2)
-          it.horizontal_line(x, y, w, color_red);
-        if (GRAPH_HEIGHT - height > HOUR_INDICATOR_HEIGHT)
-          for (int y = HOUR_INDICATOR_HEIGHT - 1, x = center_x, w = 1;
-               y >= 0;
-               --y, --x, w += 2)
-            it.horizontal_line(x, y, w, color_red);
-      }
+    if (current_cols)
+      indicator_x = graph_left + hour * BAR_WIDTH + column_gap +
+        current_first_col + current_cols/2;
+  }
+  // Underline the cheapest window (see cheapest.h), below the x axis.
+  // Drawn before the bars: negative prices, which the window often
+  // has, are drawn below the x axis too, and the bars cover the line
+  // (except in the gaps between hourly bars).
+  if (inputs.cheapest_start >= 0) {
+    // slots relative to start of today, clipped to the shown ones
+    const int offset = int(day_first_slot - prices.first_slot());
+    const int begin =
+      std::max(inputs.cheapest_start - offset, first_shown);
+    const int end = std::min(
+      inputs.cheapest_start + inputs.cheapest_slots - offset, shown_slots);
+    if (begin < end) {
+      const int left_x =
+        graph_left + (begin * BAR_WIDTH) / slots_per_hour + column_gap;
+      const int right_x = graph_left + (end * BAR_WIDTH) / slots_per_hour;
+      list.rect(left_x, GRAPH_HEIGHT + 2, right_x - left_x, 2, true);
     }
   }
 
-  struct axis_label { int pos; const char* label; };
+  list.bar_graph(graph_left, GRAPH_HEIGHT, screen_height, BAR_WIDTH - 1);
 
-  // x-axis grid
-  for (auto [hour, label] : (axis_label[]) {
-    {0, "0"}, {6, "6"}, {12, "12"}, {18, "18"},
-    {24, "0"}, {30, "6"}, {36, "12"}, {42, "18"},
-    {48, "0"}
-  }) {
-    if (show_past_hours || hour >= now.hour) {
+  // draw current hour indicator, at the middle of current slot
+  if (indicator_x >= 0) {
+    list.dots_v(indicator_x, 1, screen_height - 1, 2, true);
+
+    // draw triangle at bottom and also at top if it doesn't
+    // overlap with price bar
+    list.triangle(indicator_x, screen_height - HOUR_INDICATOR_HEIGHT,
+                  HOUR_INDICATOR_HEIGHT, true);
+    if (GRAPH_HEIGHT - indicator_height > HOUR_INDICATOR_HEIGHT)
+      list.triangle(indicator_x, HOUR_INDICATOR_HEIGHT - 1,
+                    -HOUR_INDICATOR_HEIGHT, true);
+  }
+
+  // x-axis grid, labeled every 6 hours with the local hour
+  static_assert(Layout::HOURS / 6 < GRAPH_DAY_LABELS,
+                "Layout::HOURS doesn't match GraphDay");
+  for (int hour = 0; hour <= Layout::HOURS; hour += 6) {
+    char label[8];
+    snprintf(label, sizeof(label), "%d", day.labels[hour / 6]);
+    if (show_past_hours || hour >= current_hour) {
       int x = graph_left + hour*BAR_WIDTH;
-      for (int y=0; y < GRAPH_HEIGHT; y += 3)
-        it.draw_pixel_at(x, y);
-      it.vertical_line(x, screen_height - graph_margin_bottom, 5);
-      it.print(
-        x, screen_height - graph_margin_bottom + 4,
+      list.dots_v(x, 0, GRAPH_HEIGHT, 3);
+      list.rect(x, screen_height - graph_margin_bottom, 1, 5);
+      list.text(
+        it, x, screen_height - graph_margin_bottom + 4,
         font, TextAlign::TOP_CENTER,
         label);
     }
@@ -273,33 +344,77 @@ static void draw(T& it) {
 
   // y-axis grid
   {
-    int left_x = graph_left + (show_past_hours ? 0 : now.hour * BAR_WIDTH);
+    int left_x =
+      graph_left + (show_past_hours ? 0 : current_hour * BAR_WIDTH);
     int right_x = graph_left + GRAPH_WIDTH;
 
-    for (auto tick_val : yticks) {
+    const TickLabels labels(yticks);
+
+    for (int i = 0; i < yticks.size(); ++i) {
       int y = GRAPH_HEIGHT -
-        (GRAPH_YGRID_HEIGHT * tick_val) / max_ygrid_val;
-      auto label_str = std::to_string(tick_val);
-      const char* label = label_str.c_str();
-
-      for (int x = left_x; x < right_x; x += 3)
-        it.draw_pixel_at(x, y);
-      it.horizontal_line(left_x - 4, y, 4);
-      it.print(
-        left_x - 4 - 2, y,
+        (GRAPH_YGRID_HEIGHT * yticks[i]) / max_ygrid_val;
+      const char* label = labels[i];
+
+      list.dots_h(left_x, y, right_x - left_x, 3);
+      list.rect(left_x - 4, y, 4, 1);
+      list.text(
+        it, left_x - 4 - 2, y,
         font, TextAlign::CENTER_RIGHT,
         label);
-      it.horizontal_line(right_x, y, 4);
-      it.print(
-        right_x + 4 + 2, y,
+      list.rect(right_x, y, 4, 1);
+      list.text(
+        it, right_x + 4 + 2, y,
         font, TextAlign::CENTER_LEFT,
         label);
     }
     // gridline 0 without text or solid tick lines
     // (text would overlap with x-axis labels)
-    for (int x = left_x - 4; x < right_x + 4; x += 3)
-      it.draw_pixel_at(x, GRAPH_HEIGHT);
+    list.dots_h(left_x - 4, GRAPH_HEIGHT, right_x - left_x + 8, 3);
+  }
+}
+
+
+// Layout is a GraphLayout, and it must match the display size.
+//
+// The frame is laid out into a display list only when its inputs
+// (see FrameInputs) change, e.g. the hourly update; other redraws
+// rasterize the list kept from the previous frame.
+template<typename Layout = Layout2in9, typename T>
+static void draw(T& it) {
+  constexpr int screen_width = Layout::SCREEN_WIDTH;
+  constexpr int screen_height = Layout::SCREEN_HEIGHT;
+
+  if (it.get_width() != screen_width || it.get_height() != screen_height) {
+    ESP_LOGE("draw", "Layout is for %dx%d, but display is %dx%d.",
+             screen_width, screen_height, it.get_width(), it.get_height());
+    return;
+  }
+
+  // this frame's and the previous frame's lists
+  static DisplayList<Layout::GRAPH_WIDTH> lists[2];
+  static int current = 0;
+  static bool laid_out = false;
+  static FrameInputs laid_out_inputs;
+  static RednessTable<screen_height> redness_table;
+
+  const ESPTime now = display_now();
+  const FrameInputs inputs = frame_inputs(now);
+  if (!laid_out || !(inputs == laid_out_inputs)) {
+    current ^= 1;
+    lay_out_frame<Layout>(it, now, inputs, lists[current], redness_table);
+    laid_out = true;
+    laid_out_inputs = inputs;
+    display_list_changed = lists[current].changed_area(lists[current ^ 1]);
+    ESP_LOGD("draw", "Laid out %d operations; changed x=%d y=%d w=%d h=%d",
+             lists[current].size(),
+             display_list_changed.x, display_list_changed.y,
+             display_list_changed.width, display_list_changed.height);
+  }
+  else {
+    display_list_changed = {0, 0, 0, 0};
   }
 
+  rasterize<Layout>(it, lists[current], redness_table);
+  ++display_list_frames;
   ESP_LOGD("draw", "Finished drawing.");
 }
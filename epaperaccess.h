@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <esphome.h>
+
+
+// Grants access to the protected members of the e-paper display
+// driver, for FrameBuffer and PanelRefresh. Never instantiated; only
+// used to form member pointers.
+struct EPaperAccess : esphome::waveshare_epaper::WaveshareEPaper {
+  static uint8_t* buffer(esphome::waveshare_epaper::WaveshareEPaper& d) {
+    return d.*(&EPaperAccess::buffer_);
+  }
+  static uint32_t buffer_length(esphome::waveshare_epaper::WaveshareEPaper& d)
+  {
+    return (d.*(&EPaperAccess::get_buffer_length_))();
+  }
+  static int width_internal(esphome::waveshare_epaper::WaveshareEPaper& d) {
+    return (d.*(&EPaperAccess::get_width_internal))();
+  }
+  static int height_internal(esphome::waveshare_epaper::WaveshareEPaper& d) {
+    return (d.*(&EPaperAccess::get_height_internal))();
+  }
+  static esphome::display::DisplayRotation rotation(
+    esphome::waveshare_epaper::WaveshareEPaper& d)
+  {
+    return d.*(&EPaperAccess::rotation_);
+  }
+  static void do_update(esphome::waveshare_epaper::WaveshareEPaper& d) {
+    (d.*(&EPaperAccess::do_update_))();
+  }
+  static void write_data(esphome::waveshare_epaper::WaveshareEPaper& d,
+                         const uint8_t* data, size_t length)
+  {
+    (d.*(&EPaperAccess::start_data_))();
+    d.write_array(data, length);
+    (d.*(&EPaperAccess::end_data_))();
+  }
+  // (without a BUSY pin, the driver doesn't wait either)
+  static bool busy(esphome::waveshare_epaper::WaveshareEPaper& d) {
+    esphome::GPIOPin* pin = d.*(&EPaperAccess::busy_pin_);
+    return pin && pin->digital_read();
+  }
+  // Drive the reset pin, if any; active low
+  static void set_reset(esphome::waveshare_epaper::WaveshareEPaper& d,
+                        bool active)
+  {
+    esphome::GPIOPin* pin = d.*(&EPaperAccess::reset_pin_);
+    if (pin)
+      pin->digital_write(!active);
+  }
+  static uint32_t reset_duration(
+    esphome::waveshare_epaper::WaveshareEPaper& d)
+  {
+    return d.*(&EPaperAccess::reset_duration_);
+  }
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <esphome.h>
+
+#include "epaperaccess.h"
+
+
+// Direct access to the frame buffer of the 3-colour e-paper display.
+//
+// Display::draw_pixel_at() is a virtual call that rotates and clips
+// every pixel before writing a single bit. FrameBuffer resolves the
+// rotation once per span and writes the bits of a whole span
+// directly. The bit layout must match the display driver's
+// draw_absolute_pixel_internal(): two planes of native width x native
+// height bits, MSB first; black plane (bit set = white) followed by
+// red plane (bit set = red).
+class FrameBuffer {
+  uint8_t* const black_plane;
+  const uint32_t plane_length;
+  uint8_t* const red_plane;
+  const int native_width;
+  const int native_height;
+  const esphome::display::DisplayRotation rotation;
+  const int width;   // rotated
+  const int height;  // rotated
+
+public:
+  explicit FrameBuffer(esphome::waveshare_epaper::WaveshareEPaper& display)
+    : black_plane(EPaperAccess::buffer(display))
+    , plane_length(EPaperAccess::buffer_length(display) / 2u)
+    , red_plane(black_plane + plane_length)
+    , native_width(EPaperAccess::width_internal(display))
+    , native_height(EPaperAccess::height_internal(display))
+    , rotation(EPaperAccess::rotation(display))
+    , width(display.get_width())
+    , height(display.get_height())
+  {}
+
+  // Clear the frame buffer and run the display lambda, without
+  // sending the result to the display. (This is the first half of
+  // WaveshareEPaper::update(); display() is the second.)
+  static void render(esphome::waveshare_epaper::WaveshareEPaper& display) {
+    EPaperAccess::do_update(display);
+  }
+
+  int get_native_width() const { return native_width; }
+  int get_native_height() const { return native_height; }
+  esphome::display::DisplayRotation get_rotation() const { return rotation; }
+
+  // FNV-1a hash of native rows [begin, end) of both planes
+  uint32_t hash_native_rows(int begin, int end) const {
+    const uint32_t row_bytes = native_width / 8u;
+    uint32_t hash = 2166136261u;
+    for (const uint8_t* plane : {black_plane, red_plane})
+      for (const uint8_t* p = plane + begin * row_bytes;
+           p != plane + end * row_bytes;
+           ++p)
+        hash = (hash ^ *p) * 16777619u;
+    return hash;
+  }
+
+  struct Rect {
+    int x, y, width, height;
+  };
+
+  // Area covered by native rows [begin, end), in rotated coordinates
+  Rect native_rows_to_rect(int begin, int end) const {
+    switch (rotation) {
+    case esphome::display::DISPLAY_ROTATION_90_DEGREES:
+      return {begin, 0, end - begin, height};
+    case esphome::display::DISPLAY_ROTATION_180_DEGREES:
+      return {0, native_height - end, width, end - begin};
+    case esphome::display::DISPLAY_ROTATION_270_DEGREES:
+      return {native_height - end, 0, end - begin, height};
+    default:
+      return {0, begin, width, end - begin};
+    }
+  }
+
+  // Write a horizontal span of n <= 32 pixels starting at (x, y), in
+  // rotated coordinates. Bit i of the masks is pixel x + i. Pixels
+  // not in draw_mask are left untouched; pixels in draw_mask are made
+  // red if in red_mask and black otherwise.
+  void write_span(int x, int y, int n, uint32_t draw_mask, uint32_t red_mask) {
+    if (y < 0 || y >= height)
+      return;
+    if (x < 0) {
+      if (x + n <= 0)
+        return;
+      draw_mask >>= -x;
+      red_mask >>= -x;
+      n += x;
+      x = 0;
+    }
+    if (x + n > width)
+      n = width - x;
+    if (n <= 0)
+      return;
+
+    // native bit index of (x, y) and step for x + 1
+    int32_t bit, step;
+    switch (rotation) {
+    case esphome::display::DISPLAY_ROTATION_90_DEGREES:
+      bit = (native_width - y - 1) + x * native_width;
+      step = native_width;
+      break;
+    case esphome::display::DISPLAY_ROTATION_180_DEGREES:
+      bit = (native_width - x - 1) + (native_height - y - 1) * native_width;
+      step = -1;
+      break;
+    case esphome::display::DISPLAY_ROTATION_270_DEGREES:
+      bit = y + (native_height - x - 1) * native_width;
+      step = -native_width;
+      break;
+    default:
+      bit = x + y * native_width;
+      step = 1;
+      break;
+    }
+
+    // only the pixels to draw, lowest first
+    if (n < 32)
+      draw_mask &= (uint32_t(1) << n) - 1;
+    for (; draw_mask; draw_mask &= draw_mask - 1) {
+      const int i = __builtin_ctz(draw_mask);
+      const int32_t pixel_bit = bit + i * step;
+      const uint32_t pos = pixel_bit >> 3;
+      const uint8_t mask = 0x80 >> (pixel_bit & 7);
+      black_plane[pos] &= ~mask;
+      if (red_mask & (uint32_t(1) << i))
+        red_plane[pos] |= mask;
+      else
+        red_plane[pos] &= ~mask;
+    }
+  }
+
+  // Write native bits [begin, end) of native row `row`, without
+  // rotation or clipping. Bits set in draw_bits (the same for every
+  // byte) are made red if set in red_bits (one byte per byte of the
+  // row, or nullptr for all red) and black otherwise.
+  void write_native_run(int row, int begin, int end,
+                        uint8_t draw_bits, const uint8_t* red_bits)
+  {
+    uint8_t* const black = black_plane + row * (native_width / 8u);
+    uint8_t* const red = red_plane + row * (native_width / 8u);
+    const int first = begin / 8, last = (end - 1) / 8;
+    for (int b = first; b <= last; ++b) {
+      uint8_t mask = draw_bits;
+      if (b == first)
+        mask &= 0xff >> (begin % 8);
+      if (b == last)
+        mask &= uint8_t(0xff << (7 - (end - 1) % 8));
+      const uint8_t red_mask = red_bits ? red_bits[b] & mask : mask;
+      black[b] &= ~mask;
+      red[b] = (red[b] & ~mask) | red_mask;
+    }
+  }
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <esphome.h>
+
+#include "price.h"
+
+
+// Redness of the bars is a gradient by price, defined by stops. Below
+// the cheapest stop, bars have its redness, and above the most
+// expensive stop, its redness. Between stops, redness is interpolated
+// linearly by pixel row.
+struct GradientStop {
+  price_t price;
+  uint8_t redness;  // 0 = black, 0xff = red
+};
+
+const int MAX_GRADIENT_STOPS = 8;
+
+// Custom gradient, set with set_gradient_stops() (the set_gradient
+// service). If there are no stops, the gradient goes from black at
+// "Gradient bottom price" to red at "Gradient top price".
+GradientStop gradient_stops[MAX_GRADIENT_STOPS];
+int gradient_stop_count = 0;
+
+// Incremented whenever the gradient changes, to invalidate cached
+// RednessTables
+uint32_t gradient_generation = 0;
+
+
+inline void invalidate_gradient() {
+  ++gradient_generation;
+}
+
+// Set a custom gradient of up to MAX_GRADIENT_STOPS stops, in any
+// order, or go back to the gradient numbers with n = 0.
+inline void set_gradient_stops(const GradientStop* stops, int n) {
+  n = std::min(n, MAX_GRADIENT_STOPS);
+  std::copy(stops, stops + n, gradient_stops);
+  gradient_stop_count = n;
+  invalidate_gradient();
+}
+
+// Set a custom gradient received with the set_gradient service:
+// redness[i] (0 = black ... 255 = red) at prices[i] cents. Empty lists
+// go back to the gradient numbers. Returns false, changing nothing, if
+// the lists differ in length.
+inline bool receive_gradient_stops(const std::vector<float>& prices,
+                                   const std::vector<int32_t>& redness)
+{
+  if (prices.size() != redness.size()) {
+    ESP_LOGE("gradient", "%u prices but %u redness values. Ignored.",
+             (unsigned) prices.size(), (unsigned) redness.size());
+    return false;
+  }
+  if (int(prices.size()) > MAX_GRADIENT_STOPS)
+    ESP_LOGW("gradient", "More than %d stops received. Discarding rest.",
+             MAX_GRADIENT_STOPS);
+
+  GradientStop stops[MAX_GRADIENT_STOPS];
+  const int n = std::min(int(prices.size()), MAX_GRADIENT_STOPS);
+  for (int i = 0; i < n; ++i)
+    stops[i] = {price_from_cents(prices[i]),
+                uint8_t(std::max(0, std::min(int(redness[i]), 0xff)))};
+  set_gradient_stops(stops, n);
+  if (n)
+    ESP_LOGI("gradient", "Custom gradient of %d stops.", n);
+  else
+    ESP_LOGI("gradient", "Gradient from the gradient numbers.");
+  return true;
+}
+
+// Copy the stops of the current gradient to stops (which has room for
+// MAX_GRADIENT_STOPS), sorted by price, without missing prices.
+// Returns the number of stops.
+inline int current_gradient_stops(GradientStop* stops) {
+  int n;
+  if (gradient_stop_count > 0) {
+    std::copy(gradient_stops, gradient_stops + gradient_stop_count, stops);
+    n = gradient_stop_count;
+  }
+  else {
+    stops[0] = {price_from_cents(id(gradient_bottom).state), 0};
+    stops[1] = {price_from_cents(id(gradient_top).state), 0xff};
+    n = 2;
+  }
+  n = std::remove_if(stops, stops + n, [](const GradientStop& stop) {
+    return stop.price == PRICE_MISSING;
+  }) - stops;
+  std::stable_sort(stops, stops + n,
+                   [](const GradientStop& a, const GradientStop& b) {
+                     return a.price < b.price;
+                   });
+  return n;
+}
+
+
+// Redness of each pixel row of the bars, so that drawing a row
+// doesn't need a division (ESP8266 has no hardware divider). The
+// table depends on the gradient and the y-axis scale, and is kept
+// between frames until either changes.
+template<int ROWS>
+class RednessTable {
+  uint8_t rows[ROWS];
+  bool built = false;
+  uint32_t generation = 0;
+  int scale = 0;
+  uint32_t builds = 0;
+
+public:
+  // True if built for the current gradient and the given scale (any
+  // value that determines price_to_y of build())
+  bool valid(int scale) const {
+    return built &&
+      generation == gradient_generation &&
+      this->scale == scale;
+  }
+
+  // Build for n stops sorted by price. price_to_y maps a price to a
+  // pixel row, higher prices to smaller y. With no stops, everything
+  // is red.
+  template<typename PriceToY>
+  void build(const GradientStop* stops, int n, PriceToY price_to_y,
+             int scale)
+  {
+    int ys[MAX_GRADIENT_STOPS];
+    for (int i = 0; i < n; ++i)
+      ys[i] = price_to_y(stops[i].price);
+
+    for (int y = 0; y < ROWS; ++y) {
+      if (n == 0) {
+        rows[y] = 0xff;
+      }
+      else if (y >= ys[0]) {
+        rows[y] = stops[0].redness;
+      }
+      else if (y <= ys[n - 1]) {
+        rows[y] = stops[n - 1].redness;
+      }
+      else {
+        // ys[i] > y >= ys[i + 1]
+        int i = 0;
+        while (ys[i + 1] > y)
+          ++i;
+        const int hi = stops[i + 1].redness, lo = stops[i].redness;
+        rows[y] = hi - ((hi - lo) * (y - ys[i + 1])) / (ys[i] - ys[i + 1]);
+      }
+    }
+
+    built = true;
+    generation = gradient_generation;
+    this->scale = scale;
+    ++builds;
+  }
+
+  const uint8_t* get() const { return rows; }
+  // incremented by each build(), to invalidate what is derived from it
+  uint32_t build_count() const { return builds; }
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+#include <esphome.h>
+
+#include "prices.h"
+
+
+// Local midnight of the given date, as Unix time in timestamp
+inline ESPTime local_midnight(int year, int month, int day) {
+  ESPTime midnight = ESPTime::from_epoch_local(0);
+  midnight.year = year;
+  midnight.month = month;
+  midnight.day_of_month = day;
+  midnight.hour = midnight.minute = midnight.second = 0;
+  midnight.recalc_timestamp_local(false);
+  return midnight;
+}
+
+
+// Number of x-axis labels: one every 6 hours of the graph, both ends
+// included
+const int GRAPH_DAY_LABELS = PriceStore::DAYS * 24 / 6 + 1;
+
+// The time axis of the graph: PriceStore::DAYS * 24 hours in real
+// time from local midnight of today. Each hour of the graph is an
+// hour of Unix time, so slots are found by subtracting the slot of
+// midnight. On the days DST starts or ends, today has 23 or 25 hours,
+// and the graph's hours aren't the local hours: the labels are the
+// local hours of the labeled graph hours, instead of 0, 6, 12, 18.
+//
+// Calendar math (localtime, mktime) is only needed when the day
+// changes, in update().
+struct GraphDay {
+  time_t midnight = 0;  // start of today
+  time_t next_midnight = 0;  // start of tomorrow
+  // local hour at graph hours 0, 6, 12, ...
+  int8_t labels[GRAPH_DAY_LABELS] = {0};
+
+  int32_t first_slot = 0;  // absolute slot (see PriceStore) of midnight
+  int slot_minutes = 0;  // of first_slot
+
+  // Update for the day of now and the slot length of prices, if
+  // either changed
+  void update(const ESPTime& now, const PriceStore& prices) {
+    if (now.timestamp < midnight || now.timestamp >= next_midnight) {
+      midnight = local_midnight(now.year, now.month,
+                                now.day_of_month).timestamp;
+      // (a day is at most 25 hours)
+      const ESPTime tomorrow = ESPTime::from_epoch_local(midnight + 30 * 3600);
+      next_midnight = local_midnight(tomorrow.year, tomorrow.month,
+                                     tomorrow.day_of_month).timestamp;
+
+      for (int i = 0; i < GRAPH_DAY_LABELS; ++i)
+        labels[i] = ESPTime::from_epoch_local(midnight + i * 6 * 3600).hour;
+      slot_minutes = 0;
+    }
+    if (prices.slot_minutes() != slot_minutes) {
+      slot_minutes = prices.slot_minutes();
+      first_slot = prices.slot_at(midnight);
+    }
+  }
+
+  // Hours in today: 23, 24 or 25
+  int hours() const { return int(next_midnight - midnight) / 3600; }
+
+  // Slot at t (in slots of update()'s prices) from midnight
+  int slot_at(const PriceStore& prices, time_t t) const {
+    return prices.slot_at(t) - first_slot;
+  }
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <esphome.h>
+
+#include "price.h"
+#include "prices.h"
+#include "priceindex.h"
+#include "ticks.h"
+#include "dither.h"
+
+
+// Slots [begin, end) of an hour shown in column col of its
+// columns_per_hour columns. With more columns than slots, a slot
+// spans several columns.
+inline void column_slots(int col, int slots_per_hour, int columns_per_hour,
+                         int* begin, int* end)
+{
+  *begin = (col * slots_per_hour) / columns_per_hour;
+  *end = std::max(*begin + 1,
+                  ((col + 1) * slots_per_hour) / columns_per_hour);
+}
+
+
+// What draw() derives from the shown prices: the highest price, the
+// y-axis ticks and the bar height of each column. Kept between
+// frames, and updated only when the prices (price_index is rebuilt),
+// the day or the first shown slot change. With past hours hidden, the
+// first shown slot changes every hour; then the highest price is
+// looked up from price_index in O(1), and the bar heights are
+// recalculated only if the y-axis scale changes.
+template<typename Layout>
+class GraphStats {
+public:
+  // highest shown price, PRICE_MISSING if none
+  price_t max_price = PRICE_MISSING;
+  Ticks yticks = {{1}, 1};
+
+  // top y-axis tick in cents, the scale of the graph
+  int max_ygrid_val() const { return yticks[0]; }
+
+  // y coordinate of price
+  int price_to_px(price_t price) const {
+    return Layout::GRAPH_HEIGHT -
+      div_round(price * Layout::GRAPH_YGRID_HEIGHT,
+                max_ygrid_val() * PRICE_SCALE);
+  }
+
+  // Height of the bar of graph column x, or BlackRedBars::NO_BAR if
+  // its slots have no prices
+  int height(int x) const { return heights_[x]; }
+
+  // Update for prices (price_index must be built for them), the
+  // absolute slot of midnight (see GraphDay) and the first shown slot
+  // from midnight. Returns false if nothing changed.
+  bool update(const PriceStore& prices, int32_t day_first_slot,
+              int first_shown)
+  {
+    const bool prices_changed = !valid_ ||
+      price_index.build_count() != index_builds_ ||
+      day_first_slot != day_first_slot_;
+    if (!prices_changed && first_shown == first_shown_)
+      return false;
+
+    // (price_index is relative to the first slot of prices)
+    const int offset = int(day_first_slot - prices.first_slot());
+    const int shown_slots = Layout::HOURS * prices.slots_per_hour();
+    max_price =
+      price_index.range(offset + first_shown, offset + shown_slots).max;
+    if (max_price != PRICE_MISSING)
+      yticks = pleasing_ticks(
+        // Use space above top y-gridline.
+        // Calculate tick placement using a scaled top value.
+        div_ceil(max_price * Layout::GRAPH_YGRID_HEIGHT,
+                 Layout::GRAPH_HEIGHT * PRICE_SCALE));
+
+    if (prices_changed || max_ygrid_val() != heights_scale_) {
+      update_heights(prices, day_first_slot);
+      heights_scale_ = max_ygrid_val();
+    }
+
+    valid_ = true;
+    index_builds_ = price_index.build_count();
+    day_first_slot_ = day_first_slot;
+    first_shown_ = first_shown;
+    return true;
+  }
+
+private:
+  // Bars of all hours of the graph, one group of columns per hour.
+  // Hourly prices are drawn as bars separated by a gap. Shorter slots
+  // fill all columns of the hour, and each column shows the mean of
+  // the slots it covers.
+  void update_heights(const PriceStore& prices, int32_t day_first_slot) {
+    const int slots_per_hour = prices.slots_per_hour();
+    const int columns_per_hour =
+      slots_per_hour == 1 ? Layout::BAR_WIDTH - 1 : Layout::BAR_WIDTH;
+    const int column_gap = Layout::BAR_WIDTH - columns_per_hour;
+
+    for (int hour = 0; hour < Layout::HOURS; ++hour) {
+      const int32_t first_slot = day_first_slot + hour * slots_per_hour;
+      int16_t* hour_heights = heights_ + hour * Layout::BAR_WIDTH;
+      for (int col = 0; col < column_gap; ++col)
+        hour_heights[col] = BlackRedBars::NO_BAR;
+
+      for (int col = 0; col < columns_per_hour; ++col) {
+        int begin, end;
+        column_slots(col, slots_per_hour, columns_per_hour, &begin, &end);
+        const ColumnStats stats =
+          aggregate_slots(prices, first_slot + begin, first_slot + end);
+        const int height = stats.mean == PRICE_MISSING
+          ? BlackRedBars::NO_BAR
+          : Layout::GRAPH_HEIGHT - price_to_px(stats.mean);
+        ESP_LOGV("draw", "hour %02d col %d: min/mean/max = %d/%d/%d,"
+                 " height = %d px",
+                 hour, col, stats.min, stats.mean, stats.max, height);
+        hour_heights[column_gap + col] = height;
+      }
+    }
+  }
+
+  bool valid_ = false;
+  uint32_t index_builds_ = 0;
+  int32_t day_first_slot_ = 0;
+  int first_shown_ = 0;
+  int heights_scale_ = 0;
+  int16_t heights_[Layout::GRAPH_WIDTH];
+};
@@ -0,0 +1,110 @@
+// Checks the time axis of the graph (GraphDay in graphday.h) on the
+// days DST starts and ends in Europe/Helsinki, and on an ordinary
+// day, with hourly and 15 minute prices: for every slot of the day,
+// that the current price is looked up from the right slot, that the
+// current hour indicator is drawn at the right graph hour, and that
+// the x-axis labels are the local hours.
+//
+// usage: dst_host
+// Exits with status 1 if anything is wrong.
+
+#include <esphome.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "draw.h"
+#include "ingest.h"
+
+
+struct Day {
+  const char* name;
+  int year, month, day;
+  time_t midnight;  // Unix time, worked out by hand
+  int hours;
+  int labels[GRAPH_DAY_LABELS];
+};
+
+static const Day DAYS[] = {
+  // 03:00 EET -> 04:00 EEST
+  {"DST starts", 2024, 3, 31, 1711836000,  // 2024-03-30 22:00 UTC
+   23, {0, 7, 13, 19, 1, 7, 13, 19, 1}},
+  // 04:00 EEST -> 03:00 EET
+  {"DST ends", 2024, 10, 27, 1729976400,  // 2024-10-26 21:00 UTC
+   25, {0, 5, 11, 17, 23, 5, 11, 17, 23}},
+  {"ordinary day", 2024, 6, 20, 1718830800,  // 2024-06-19 21:00 UTC
+   24, {0, 6, 12, 18, 0, 6, 12, 18, 0}},
+};
+
+// distinct price of each slot from midnight, in tenths of a cent
+static price_t example_price(int slot) {
+  return 10 + slot;
+}
+
+
+int main() {
+  host_setup();
+  auto& display = id(epaper);
+  display.set_writer([](Display& it) { draw(it); });
+  // all bars black, so that the indicator is the only red at the top
+  id(gradient_bottom).state = 1000;
+  id(gradient_top).state = 2000;
+  invalidate_gradient();
+
+  using Layout = Layout2in9;
+  int wrong = 0;
+  for (const Day& day : DAYS) {
+    for (int slot_minutes : {60, 15}) {
+      const int slots_per_hour = 60 / slot_minutes;
+
+      // today and tomorrow, as the automation sends them (the store
+      // holds 48 hours, so the last hour after a 25 hour day doesn't
+      // fit)
+      std::vector<float> payload;
+      for (int i = 0; i < (day.hours + 24) * slots_per_hour; ++i)
+        payload.push_back(price_to_cents(example_price(i)));
+      id(price_store).clear();
+      id(prices_start_date) = ESPTime::from_epoch_utc(0);
+      receive_prices(payload, slot_minutes, day.year, day.month, day.day);
+      const PriceStore& prices = id(price_store);
+
+      int day_wrong = 0;
+      for (int slot = 0; slot < day.hours * slots_per_hour; ++slot) {
+        const time_t t = day.midnight + slot * slot_minutes * 60 + 60;
+        id(homeassistant_time).set_epoch_time(t);
+
+        GraphDay graph_day;
+        graph_day.update(ESPTime::from_epoch_local(t), prices);
+        bool ok = graph_day.midnight == day.midnight &&
+          graph_day.hours() == day.hours &&
+          graph_day.slot_at(prices, t) == slot &&
+          prices.at(graph_day.first_slot + slot) == example_price(slot);
+        for (int i = 0; i < GRAPH_DAY_LABELS; ++i)
+          ok = ok && graph_day.labels[i] == day.labels[i];
+
+        // indicator at the middle of the columns of the slot
+        FrameBuffer::render(display);
+        const int hour = slot / slots_per_hour;
+        const int x = Layout::GRAPH_LEFT + hour * Layout::BAR_WIDTH +
+          (slots_per_hour == 1 ? 2 : slot % slots_per_hour);
+        const Color color_red = id(red);
+        for (int other : {x - Layout::BAR_WIDTH, x + Layout::BAR_WIDTH})
+          ok = ok && !(display.get_pixel(other, 1) == color_red);
+        ok = ok && display.get_pixel(x, 1) == color_red;
+
+        if (!ok) {
+          ++day_wrong;
+          if (day_wrong <= 3)
+            printf("  %s, %d min slots: slot %d (t = %lld) wrong\n",
+                   day.name, slot_minutes, slot, (long long) t);
+        }
+      }
+
+      printf("%-13s %2d min: %d hours, %3d slots, %d wrong\n",
+             day.name, slot_minutes, day.hours,
+             day.hours * slots_per_hour, day_wrong);
+      wrong += day_wrong;
+    }
+  }
+  return wrong ? 1 : 0;
+}
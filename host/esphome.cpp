@@ -0,0 +1,902 @@
+#include "esphome.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+
+namespace esphome {
+
+int host_log_level = ESPHOME_LOG_LEVEL_WARN;
+
+void host_log(int level, const char* tag, const char* format, ...) {
+  if (level > host_log_level)
+    return;
+
+  static const char LEVEL_LETTERS[] = "?EWI?DVV";
+  fprintf(stderr, "[%c][%s]: ", LEVEL_LETTERS[level], tag);
+  va_list arg;
+  va_start(arg, format);
+  vfprintf(stderr, format, arg);
+  va_end(arg);
+  fputc('\n', stderr);
+}
+
+uint16_t crc16(const uint8_t* data, uint16_t len, uint16_t crc) {
+  // same as ESPHome: reflected polynomial 0x8005
+  while (len--) {
+    crc ^= *data++;
+    for (int i = 0; i < 8; ++i)
+      crc = crc & 1 ? (crc >> 1) ^ 0xa001 : crc >> 1;
+  }
+  return crc;
+}
+
+ESPPreferences* global_preferences = new ESPPreferences();
+
+static uint32_t millis_offset = 0;
+
+uint32_t millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return millis_offset + std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+void host_advance_millis(uint32_t ms) {
+  millis_offset += ms;
+}
+
+void delay(uint32_t ms) {
+  host_advance_millis(ms);
+}
+
+
+// ESPTime
+
+std::string ESPTime::strftime(const std::string& format) const {
+  struct tm c_tm = to_c_tm();
+  char buf[128];
+  size_t len = ::strftime(buf, sizeof(buf), format.c_str(), &c_tm);
+  return len ? std::string(buf, len) : std::string("ERROR");
+}
+
+bool ESPTime::fields_in_range() const {
+  return second < 61 && minute < 60 && hour < 24 &&
+    day_of_week > 0 && day_of_week < 8 &&
+    day_of_month > 0 && day_of_month < 32 &&
+    day_of_year > 0 && day_of_year < 367 &&
+    month > 0 && month < 13;
+}
+
+static bool is_leap_year(unsigned year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static uint8_t days_in_month(uint8_t month, uint16_t year) {
+  static const uint8_t DAYS[] = {
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return month == 2 && is_leap_year(year) ? 29 : DAYS[month - 1];
+}
+
+void ESPTime::increment_second() {
+  ++timestamp;
+  if (++second != 60)
+    return;
+  second = 0;
+  if (++minute != 60)
+    return;
+  minute = 0;
+  if (++hour != 24)
+    return;
+  hour = 0;
+  --timestamp;  // increment_day() adds the day
+  increment_day();
+  ++timestamp;
+}
+
+void ESPTime::increment_day() {
+  timestamp += 86400;
+
+  day_of_week = day_of_week % 7 + 1;
+  ++day_of_year;
+  if (++day_of_month > days_in_month(month, year)) {
+    day_of_month = 1;
+    if (++month > 12) {
+      month = 1;
+      ++year;
+      day_of_year = 1;
+    }
+  }
+}
+
+struct tm ESPTime::to_c_tm() const {
+  struct tm c_tm {};
+  c_tm.tm_sec = second;
+  c_tm.tm_min = minute;
+  c_tm.tm_hour = hour;
+  c_tm.tm_mday = day_of_month;
+  c_tm.tm_mon = month - 1;
+  c_tm.tm_year = year - 1900;
+  c_tm.tm_wday = day_of_week - 1;
+  c_tm.tm_yday = day_of_year - 1;
+  c_tm.tm_isdst = is_dst;
+  return c_tm;
+}
+
+void ESPTime::recalc_timestamp_utc(bool use_day_of_year) {
+  struct tm c_tm = to_c_tm();
+  if (use_day_of_year) {
+    c_tm.tm_mon = 0;
+    c_tm.tm_mday = day_of_year;
+  }
+  timestamp = timegm(&c_tm);
+}
+
+void ESPTime::recalc_timestamp_local(bool use_day_of_year) {
+  struct tm c_tm = to_c_tm();
+  if (use_day_of_year) {
+    c_tm.tm_mon = 0;
+    c_tm.tm_mday = day_of_year;
+  }
+  c_tm.tm_isdst = -1;
+  timestamp = mktime(&c_tm);
+}
+
+ESPTime ESPTime::from_c_tm(const struct tm* c_tm, time_t c_time) {
+  ESPTime res {};
+  res.second = c_tm->tm_sec;
+  res.minute = c_tm->tm_min;
+  res.hour = c_tm->tm_hour;
+  res.day_of_week = c_tm->tm_wday + 1;
+  res.day_of_month = c_tm->tm_mday;
+  res.day_of_year = c_tm->tm_yday + 1;
+  res.month = c_tm->tm_mon + 1;
+  res.year = c_tm->tm_year + 1900;
+  res.is_dst = c_tm->tm_isdst > 0;
+  res.timestamp = c_time;
+  return res;
+}
+
+ESPTime ESPTime::from_epoch_local(time_t epoch) {
+  struct tm c_tm;
+  localtime_r(&epoch, &c_tm);
+  return from_c_tm(&c_tm, epoch);
+}
+
+ESPTime ESPTime::from_epoch_utc(time_t epoch) {
+  struct tm c_tm;
+  gmtime_r(&epoch, &c_tm);
+  return from_c_tm(&c_tm, epoch);
+}
+
+
+namespace display {
+
+const Color COLOR_OFF(0, 0, 0, 0);
+const Color COLOR_ON(255, 255, 255, 255);
+
+void Display::fill(Color color) {
+  filled_rectangle(0, 0, get_width(), get_height(), color);
+}
+
+void Display::line(int x1, int y1, int x2, int y2, Color color) {
+  // Bresenham, as in ESPHome
+  const int dx = std::abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
+  const int dy = -std::abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
+  int err = dx + dy;
+  while (true) {
+    draw_pixel_at(x1, y1, color);
+    if (x1 == x2 && y1 == y2)
+      break;
+    int e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x1 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y1 += sy;
+    }
+  }
+}
+
+void Display::horizontal_line(int x, int y, int width, Color color) {
+  for (int i = x; i < x + width; i++)
+    draw_pixel_at(i, y, color);
+}
+
+void Display::vertical_line(int x, int y, int height, Color color) {
+  for (int i = y; i < y + height; i++)
+    draw_pixel_at(x, i, color);
+}
+
+void Display::rectangle(int x1, int y1, int width, int height, Color color) {
+  horizontal_line(x1, y1, width, color);
+  horizontal_line(x1, y1 + height - 1, width, color);
+  vertical_line(x1, y1, height, color);
+  vertical_line(x1 + width - 1, y1, height, color);
+}
+
+void Display::filled_rectangle(int x1, int y1, int width, int height,
+                               Color color) {
+  for (int i = y1; i < y1 + height; i++)
+    horizontal_line(x1, i, width, color);
+}
+
+void Display::get_text_bounds(int x, int y, const char* text, BaseFont* font,
+                              TextAlign align, int* x1, int* y1,
+                              int* width, int* height) {
+  int x_offset, baseline;
+  font->measure(text, width, &x_offset, &baseline, height);
+
+  auto x_align = TextAlign(int(align) & 0x18);
+  auto y_align = TextAlign(int(align) & 0x07);
+
+  switch (x_align) {
+  case TextAlign::RIGHT:
+    *x1 = x - *width;
+    break;
+  case TextAlign::CENTER_HORIZONTAL:
+    *x1 = x - (*width) / 2;
+    break;
+  case TextAlign::LEFT:
+  default:
+    *x1 = x;
+    break;
+  }
+
+  switch (y_align) {
+  case TextAlign::BOTTOM:
+    *y1 = y - *height;
+    break;
+  case TextAlign::BASELINE:
+    *y1 = y - baseline;
+    break;
+  case TextAlign::CENTER_VERTICAL:
+    *y1 = y - (*height) / 2;
+    break;
+  case TextAlign::TOP:
+  default:
+    *y1 = y;
+    break;
+  }
+}
+
+void Display::print(int x, int y, BaseFont* font, Color color,
+                    TextAlign align, const char* text) {
+  int x_start, y_start, width, height;
+  get_text_bounds(x, y, text, font, align, &x_start, &y_start,
+                  &width, &height);
+  font->print(x_start, y_start, this, color, text);
+}
+
+void Display::vprintf_(int x, int y, BaseFont* font, Color color,
+                       TextAlign align, const char* format, va_list arg) {
+  char buffer[256];
+  int ret = vsnprintf(buffer, sizeof(buffer), format, arg);
+  if (ret > 0)
+    print(x, y, font, color, align, buffer);
+}
+
+void Display::printf(int x, int y, BaseFont* font, Color color,
+                     TextAlign align, const char* format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  vprintf_(x, y, font, color, align, format, arg);
+  va_end(arg);
+}
+
+void Display::printf(int x, int y, BaseFont* font, TextAlign align,
+                     const char* format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  vprintf_(x, y, font, COLOR_ON, align, format, arg);
+  va_end(arg);
+}
+
+void Display::image(int x, int y, BaseImage* image, ImageAlign align,
+                    Color color_on, Color color_off) {
+  auto x_align = ImageAlign(int(align) & 0x0C);
+  auto y_align = ImageAlign(int(align) & 0x03);
+
+  switch (x_align) {
+  case ImageAlign::RIGHT:
+    x -= image->get_width();
+    break;
+  case ImageAlign::CENTER_HORIZONTAL:
+    x -= image->get_width() / 2;
+    break;
+  default:
+    break;
+  }
+
+  switch (y_align) {
+  case ImageAlign::BOTTOM:
+    y -= image->get_height();
+    break;
+  case ImageAlign::CENTER_VERTICAL:
+    y -= image->get_height() / 2;
+    break;
+  default:
+    break;
+  }
+
+  image->draw(x, y, this, color_on, color_off);
+}
+
+
+int DisplayBuffer::get_width() {
+  switch (rotation_) {
+  case DISPLAY_ROTATION_90_DEGREES:
+  case DISPLAY_ROTATION_270_DEGREES:
+    return get_height_internal();
+  default:
+    return get_width_internal();
+  }
+}
+
+int DisplayBuffer::get_height() {
+  switch (rotation_) {
+  case DISPLAY_ROTATION_90_DEGREES:
+  case DISPLAY_ROTATION_270_DEGREES:
+    return get_width_internal();
+  default:
+    return get_height_internal();
+  }
+}
+
+void DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
+  ++pixel_calls;
+
+  switch (rotation_) {
+  case DISPLAY_ROTATION_0_DEGREES:
+    break;
+  case DISPLAY_ROTATION_90_DEGREES:
+    std::swap(x, y);
+    x = get_width_internal() - x - 1;
+    break;
+  case DISPLAY_ROTATION_180_DEGREES:
+    x = get_width_internal() - x - 1;
+    y = get_height_internal() - y - 1;
+    break;
+  case DISPLAY_ROTATION_270_DEGREES:
+    std::swap(x, y);
+    y = get_height_internal() - y - 1;
+    break;
+  }
+  if (x < 0 || x >= get_width_internal() ||
+      y < 0 || y >= get_height_internal())
+    return;
+  draw_absolute_pixel_internal(x, y, color);
+}
+
+void DisplayBuffer::init_internal_(uint32_t buffer_length) {
+  storage_.assign(buffer_length, 0);
+  buffer_ = storage_.data();
+}
+
+void DisplayBuffer::do_update_() {
+  clear();
+  if (writer_)
+    writer_(*this);
+}
+
+}  // namespace display
+
+
+namespace font {
+
+// decode one UTF-8 sequence, advancing str
+static uint32_t next_codepoint(const char*& str) {
+  auto c = (unsigned char) *str++;
+  if (c < 0x80)
+    return c;
+  int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : 1;
+  uint32_t cp = c & (0x3F >> extra);
+  while (extra-- && (*str & 0xC0) == 0x80)
+    cp = (cp << 6) | (*str++ & 0x3F);
+  return cp;
+}
+
+int Font::glyph_width(uint32_t codepoint) const {
+  switch (codepoint) {
+  case 0x2009:  // thin space
+    return size_ / 6;
+  case 0x200A:  // hair space
+    return size_ / 10;
+  case '.': case ',':
+    return size_ / 4;
+  case '/':
+    return size_ / 4;
+  default:
+    return size_ * 9 / 20;
+  }
+}
+
+void Font::measure(const char* str, int* width, int* x_offset,
+                   int* baseline, int* height) {
+  *x_offset = 0;
+  *baseline = baseline_;
+  *height = height_;
+  *width = 0;
+  while (*str)
+    *width += glyph_width(next_codepoint(str));
+}
+
+void Font::print(int x, int y, display::Display* display, Color color,
+                 const char* text) {
+  // Each glyph is drawn as the outline of a box between the cap
+  // height and the baseline, one pixel at a time, with a horizontal
+  // stroke whose position depends on the character, so that
+  // different text gives a different picture.
+  const int top = y + baseline_ - (size_ * 7) / 10;
+  const int bottom = y + baseline_ - 1;
+  while (*text) {
+    uint32_t codepoint = next_codepoint(text);
+    int w = glyph_width(codepoint);
+    if (codepoint != ' ' && codepoint != 0x2009 && codepoint != 0x200A) {
+      int x1 = x + 1, x2 = x + w - 2;
+      if (codepoint == '.' || codepoint == ',') {
+        display->filled_rectangle(x1, bottom - 1, 2, 2, color);
+      }
+      else {
+        const int stroke = top + 1 + (codepoint % 8) * (bottom - top - 1) / 8;
+        for (int gy = top; gy <= bottom; ++gy) {
+          if (gy == top || gy == bottom || gy == stroke) {
+            for (int gx = x1; gx <= x2; ++gx)
+              display->draw_pixel_at(gx, gy, color);
+          }
+          else {
+            display->draw_pixel_at(x1, gy, color);
+            display->draw_pixel_at(x2, gy, color);
+          }
+        }
+      }
+    }
+    x += w;
+  }
+}
+
+}  // namespace font
+
+
+namespace image {
+
+bool Image::get_pixel(int x, int y) const {
+  // triangle outline, 2 px thick
+  int half = width_ / 2;
+  int dx = std::abs(x - half);
+  int edge = (y * half) / std::max(height_ - 1, 1);
+  return y >= height_ - 2 || (dx <= edge && dx >= edge - 2);
+}
+
+void Image::draw(int x, int y, display::Display* display,
+                 Color color_on, Color color_off) {
+  for (int img_y = 0; img_y < height_; ++img_y)
+    for (int img_x = 0; img_x < width_; ++img_x) {
+      if (get_pixel(img_x, img_y))
+        display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      else if (type_ == IMAGE_TYPE_BINARY)
+        display->draw_pixel_at(x + img_x, y + img_y, color_off);
+    }
+}
+
+}  // namespace image
+
+
+namespace waveshare_epaper {
+
+void WaveshareEPaper::fill(Color color) {
+  // flip logic, as in draw_absolute_pixel_internal()
+  const uint32_t half = get_buffer_length_() / 2u;
+  const bool red = color.red > 0 && color.green == 0 && color.blue == 0;
+  std::memset(buffer_, color.is_on() ? 0x00 : 0xFF, half);
+  std::memset(buffer_ + half, red ? 0xFF : 0x00, half);
+}
+
+void WaveshareEPaper::command(uint8_t value) {
+  spi_(false, &value, 1);
+}
+
+void WaveshareEPaper::data(uint8_t value) {
+  spi_(true, &value, 1);
+}
+
+void WaveshareEPaper::reset_() {
+  if (reset_pin_ != nullptr) {
+    reset_pin_->digital_write(false);
+    delay(reset_duration_);
+    reset_pin_->digital_write(true);
+    delay(20);
+  }
+}
+
+bool WaveshareEPaper::wait_until_idle_() {
+  if (busy_pin_ == nullptr)
+    return true;
+  const uint32_t start = millis();
+  while (busy_pin_->digital_read()) {
+    if (millis() - start > 30000) {
+      ESP_LOGE("waveshare_epaper", "Timeout while displaying image!");
+      return false;
+    }
+    delay(10);
+  }
+  return true;
+}
+
+
+Ssd1680::Ssd1680(int width, int height) : width_(width), height_(height) {
+  for (int plane = 0; plane < 2; ++plane) {
+    // (RAM content is undefined at power on)
+    ram_[plane].assign(RAM_X_BYTES * RAM_Y, 0xA5);
+    shown_[plane].assign(RAM_X_BYTES * RAM_Y, 0xA5);
+  }
+  reset_registers();
+}
+
+void Ssd1680::reset_registers() {
+  entry_mode_ = 0x03;
+  x_start_ = 0;
+  x_end_ = RAM_X_BYTES - 1;
+  y_start_ = 0;
+  y_end_ = RAM_Y - 1;
+  x_ = 0;
+  y_ = 0;
+  update_control_2_ = 0xFF;
+}
+
+void Ssd1680::set_reset_pin(bool level) {
+  if (!level) {
+    in_reset_ = true;
+    return;
+  }
+  if (!in_reset_)
+    return;
+  // Hardware reset, also out of deep sleep. RAM is kept.
+  in_reset_ = false;
+  asleep_ = false;
+  reset_registers();
+  busy_until_ = millis() + 2;
+}
+
+void Ssd1680::command(uint8_t value) {
+  if (in_reset_ || asleep_ || busy()) {
+    ++ignored;
+    command_ = 0;  // (its data too)
+    return;
+  }
+  command_ = value;
+  data_index_ = 0;
+  switch (value) {
+  case 0x12:  // SW reset
+    reset_registers();
+    busy_until_ = millis() + 10;
+    break;
+  case 0x20:  // master activation
+    if (update_control_2_ & 0x04) {  // display
+      shown_[0] = ram_[0];
+      shown_[1] = ram_[1];
+      ++refresh_count;
+      busy_until_ = millis() + refresh_ms;
+    }
+    else {
+      busy_until_ = millis() + 1;
+    }
+    break;
+  }
+}
+
+void Ssd1680::data(uint8_t value) {
+  if (in_reset_ || asleep_ || busy() || command_ == 0) {
+    ++ignored;
+    return;
+  }
+  const int i = data_index_++;
+  switch (command_) {
+  case 0x10:  // deep sleep mode
+    if (i == 0 && (value & 0x03))
+      asleep_ = true;
+    break;
+  case 0x11:  // data entry mode
+    if (i == 0)
+      entry_mode_ = value & 0x07;
+    break;
+  case 0x22:  // display update control 2
+    if (i == 0)
+      update_control_2_ = value;
+    break;
+  case 0x24:  // write RAM (black/white)
+  case 0x26:  // write RAM (red)
+    write_ram(value);
+    break;
+  case 0x44:  // RAM X start/end, bytes
+    if (i == 0)
+      x_start_ = value & 0x3F;
+    else if (i == 1)
+      x_end_ = value & 0x3F;
+    break;
+  case 0x45:  // RAM Y start/end, 9 bits each
+    if (i == 0)
+      y_start_ = value;
+    else if (i == 1)
+      y_start_ |= (value & 0x01) << 8;
+    else if (i == 2)
+      y_end_ = value;
+    else if (i == 3)
+      y_end_ |= (value & 0x01) << 8;
+    break;
+  case 0x4E:  // RAM X address counter
+    if (i == 0)
+      x_ = value & 0x3F;
+    break;
+  case 0x4F:  // RAM Y address counter
+    if (i == 0)
+      y_ = value;
+    else if (i == 1)
+      y_ |= (value & 0x01) << 8;
+    break;
+  }
+}
+
+void Ssd1680::write_ram(uint8_t value) {
+  if (x_ < RAM_X_BYTES && y_ < RAM_Y)
+    ram_[command_ == 0x26][y_ * RAM_X_BYTES + x_] = value;
+  // entry mode: bit 0 X increments, bit 1 Y increments, bit 2 Y first
+  if (entry_mode_ & 0x04) {
+    if (advance_y())
+      advance_x();
+  }
+  else {
+    if (advance_x())
+      advance_y();
+  }
+}
+
+bool Ssd1680::advance_x() {
+  const bool increment = entry_mode_ & 0x01;
+  if (x_ == (increment ? x_end_ : x_start_)) {
+    x_ = increment ? x_start_ : x_end_;
+    return true;
+  }
+  x_ += increment ? 1 : -1;
+  return false;
+}
+
+bool Ssd1680::advance_y() {
+  const bool increment = entry_mode_ & 0x02;
+  if (y_ == (increment ? y_end_ : y_start_)) {
+    y_ = increment ? y_start_ : y_end_;
+    return true;
+  }
+  y_ += increment ? 1 : -1;
+  return false;
+}
+
+bool Ssd1680::shows(const uint8_t* planes) const {
+  const int row_bytes = width_ / 8;
+  for (int plane = 0; plane < 2; ++plane)
+    for (int y = 0; y < height_; ++y) {
+      const uint8_t* row = planes + (plane * height_ + y) * row_bytes;
+      if (std::memcmp(shown_[plane].data() + y * RAM_X_BYTES, row,
+                      row_bytes) != 0)
+        return false;
+    }
+  return true;
+}
+
+
+void WaveshareEPaper2P9InBV4::initialize() {
+  init_internal_(get_buffer_length_());
+  busy_pin_model_.panel = &panel_;
+  busy_pin_ = &busy_pin_model_;
+  reset_pin_model_.panel = &panel_;
+  reset_pin_ = &reset_pin_model_;
+  init_panel_();
+}
+
+void WaveshareEPaper2P9InBV4::init_panel_() {
+  reset_();
+  wait_until_idle_();
+  command(0x12);  // SW reset
+  wait_until_idle_();
+
+  command(0x01);  // driver output control
+  data((get_height_internal() - 1) % 256);
+  data((get_height_internal() - 1) / 256);
+  data(0x00);
+  command(0x11);  // data entry mode
+  data(0x03);
+  command(0x44);  // RAM X start/end
+  data(0x00);
+  data(get_width_internal() / 8 - 1);
+  command(0x45);  // RAM Y start/end
+  data(0x00);
+  data(0x00);
+  data((get_height_internal() - 1) % 256);
+  data((get_height_internal() - 1) / 256);
+  command(0x3C);  // border waveform
+  data(0x05);
+  command(0x21);  // display update control 1
+  data(0x00);
+  data(0x80);
+  command(0x18);  // temperature sensor
+  data(0x80);
+  wait_until_idle_();
+}
+
+void WaveshareEPaper2P9InBV4::display() {
+  const uint32_t half = get_buffer_length_() / 2u;
+  // woken from the deep sleep after the last refresh
+  init_panel_();
+  for (uint8_t ram : {0x24, 0x26}) {
+    command(0x4E);  // RAM X counter
+    data(0x00);
+    command(0x4F);  // RAM Y counter
+    data(0x00);
+    data(0x00);
+    command(ram);
+    write_array(buffer_ + (ram == 0x26 ? half : 0), half);
+  }
+  command(0x22);
+  data(0xF7);
+  command(0x20);
+  wait_until_idle_();
+  command(0x10);  // deep sleep
+  data(0x01);
+}
+
+void WaveshareEPaper2P9InBV4::spi_(bool is_data, const uint8_t* data,
+                                   size_t length)
+{
+  if (!is_data) {
+    panel_.command(*data);
+    return;
+  }
+  for (size_t i = 0; i < length; ++i)
+    panel_.data(data[i]);
+}
+
+bool WaveshareEPaper2P9InBV4::panel_matches_buffer() {
+  return panel_.shows(buffer_);
+}
+
+void WaveshareEPaper2P9InBV4::draw_absolute_pixel_internal(
+  int x, int y, Color color)
+{
+  const uint32_t half = get_buffer_length_() / 2u;
+  const uint32_t pos = (x + y * get_width_internal()) / 8u;
+  const uint8_t subpos = x & 0x07;
+  // black plane: bit set = white
+  if (!color.is_on())
+    buffer_[pos] |= 0x80 >> subpos;
+  else
+    buffer_[pos] &= ~(0x80 >> subpos);
+  // red plane: bit set = red; only pure red is red
+  if (color.red > 0 && color.green == 0 && color.blue == 0)
+    buffer_[pos + half] |= 0x80 >> subpos;
+  else
+    buffer_[pos + half] &= ~(0x80 >> subpos);
+}
+
+Color WaveshareEPaper2P9InBV4::get_pixel(int x, int y) {
+  // inverse of the rotation in DisplayBuffer::draw_pixel_at()
+  int nx = x, ny = y;
+  switch (rotation_) {
+  case display::DISPLAY_ROTATION_0_DEGREES:
+    break;
+  case display::DISPLAY_ROTATION_90_DEGREES:
+    nx = get_width_internal() - y - 1;
+    ny = x;
+    break;
+  case display::DISPLAY_ROTATION_180_DEGREES:
+    nx = get_width_internal() - x - 1;
+    ny = get_height_internal() - y - 1;
+    break;
+  case display::DISPLAY_ROTATION_270_DEGREES:
+    nx = y;
+    ny = get_height_internal() - x - 1;
+    break;
+  }
+  const uint32_t half = get_buffer_length_() / 2u;
+  const uint32_t pos = (nx + ny * get_width_internal()) / 8u;
+  const uint8_t mask = 0x80 >> (nx & 0x07);
+  if (buffer_[pos + half] & mask)
+    return Color(255, 0, 0);
+  return buffer_[pos] & mask ? display::COLOR_OFF : display::COLOR_ON;
+}
+
+bool WaveshareEPaper2P9InBV4::write_ppm(const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f)
+    return false;
+  const int w = get_width(), h = get_height();
+  fprintf(f, "P6\n%d %d\n255\n", w, h);
+  for (int y = 0; y < h; ++y)
+    for (int x = 0; x < w; ++x) {
+      Color c = get_pixel(x, y);
+      unsigned char rgb[3];
+      if (c.is_on() && c.green == 0) {  // red
+        rgb[0] = 0xC0; rgb[1] = 0x10; rgb[2] = 0x10;
+      }
+      else if (c.is_on()) {  // black
+        rgb[0] = rgb[1] = rgb[2] = 0x00;
+      }
+      else {  // white
+        rgb[0] = rgb[1] = rgb[2] = 0xFF;
+      }
+      fwrite(rgb, 1, 3, f);
+    }
+  return fclose(f) == 0;
+}
+
+}  // namespace waveshare_epaper
+
+}  // namespace esphome
+
+
+globals::GlobalsComponent<PriceStore>* price_store;
+globals::GlobalsComponent<ESPTime>* prices_start_date;
+globals::GlobalsComponent<bool>* update_on_time_sync;
+
+Color* red;
+font::Font* main_font;
+font::Font* cur_price_font;
+image::Image* no_data_icon;
+image::Image* price_alert_icon;
+waveshare_epaper::WaveshareEPaper2P9InBV4* epaper;
+template_::TemplateNumber* gradient_top;
+template_::TemplateNumber* gradient_bottom;
+template_::TemplateNumber* display_update_delay;
+template_::TemplateNumber* refresh_lead_time;
+template_::TemplateNumber* cheapest_window_hours;
+template_::TemplateNumber* cheapest_window_deadline;
+template_::TemplateSwitch* show_past_hours_switch;
+template_::TemplateSwitch* price_warning_switch;
+homeassistant::HomeassistantTime* homeassistant_time;
+
+void host_set_local_timezone(bool local) {
+  setenv("TZ", local ? "EET-2EEST,M3.5.0/3,M10.5.0/4" : "UTC0", 1);
+  tzset();
+}
+
+void host_setup() {
+  host_set_local_timezone(true);
+
+  price_store = new globals::GlobalsComponent<PriceStore>();
+  price_store->value().clear();
+  prices_start_date = new globals::GlobalsComponent<ESPTime>();
+  prices_start_date->value() = ESPTime::from_epoch_utc(0);
+  update_on_time_sync = new globals::GlobalsComponent<bool>();
+
+  red = new Color(255, 0, 0);
+  // approximate metrics of Arial Narrow 18 px and 36 px
+  main_font = new font::Font(18, 21, 17);
+  cur_price_font = new font::Font(36, 41, 33);
+  no_data_icon = new image::Image(128, 128, image::IMAGE_TYPE_BINARY);
+  price_alert_icon =
+    new image::Image(50, 44, image::IMAGE_TYPE_TRANSPARENT_BINARY);
+
+  epaper = new waveshare_epaper::WaveshareEPaper2P9InBV4();
+  epaper->set_rotation(display::DISPLAY_ROTATION_90_DEGREES);
+  epaper->initialize();
+
+  gradient_top = new template_::TemplateNumber();
+  gradient_top->state = 40;
+  gradient_bottom = new template_::TemplateNumber();
+  gradient_bottom->state = 20;
+  display_update_delay = new template_::TemplateNumber();
+  display_update_delay->state = 10;
+  refresh_lead_time = new template_::TemplateNumber();
+  refresh_lead_time->state = 0;
+  cheapest_window_hours = new template_::TemplateNumber();
+  cheapest_window_hours->state = 3;
+  cheapest_window_deadline = new template_::TemplateNumber();
+  cheapest_window_deadline->state = -1;
+  show_past_hours_switch = new template_::TemplateSwitch();
+  show_past_hours_switch->state = true;
+  price_warning_switch = new template_::TemplateSwitch();
+  price_warning_switch->state = true;
+
+  homeassistant_time = new homeassistant::HomeassistantTime();
+}
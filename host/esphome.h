@@ -0,0 +1,664 @@
+#pragma once
+
+// Host stand-in for the parts of ESPHome that draw.h, dither.h and
+// ticks.h use. Only enough is implemented to compile the display code
+// natively and let it render into an in-memory three-colour frame
+// buffer with the same layout, rotation and clipping as on the device.
+//
+// Names and signatures follow ESPHome (2024.6) so that the headers in
+// the repository root can be included unmodified.
+
+#include <array>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+
+// logging
+
+#define ESPHOME_LOG_LEVEL_NONE 0
+#define ESPHOME_LOG_LEVEL_ERROR 1
+#define ESPHOME_LOG_LEVEL_WARN 2
+#define ESPHOME_LOG_LEVEL_INFO 3
+#define ESPHOME_LOG_LEVEL_DEBUG 5
+#define ESPHOME_LOG_LEVEL_VERBOSE 6
+#define ESPHOME_LOG_LEVEL_VERY_VERBOSE 7
+
+namespace esphome {
+
+// Messages above this level are discarded. Set from the command line
+// of the host tools; defaults to warnings so that benchmarks are not
+// dominated by printing.
+extern int host_log_level;
+
+void host_log(int level, const char* tag, const char* format, ...)
+  __attribute__((format(printf, 3, 4)));
+
+}  // namespace esphome
+
+#define ESP_LOGE(tag, ...) \
+  ::esphome::host_log(ESPHOME_LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) \
+  ::esphome::host_log(ESPHOME_LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) \
+  ::esphome::host_log(ESPHOME_LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) \
+  ::esphome::host_log(ESPHOME_LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) \
+  ::esphome::host_log(ESPHOME_LOG_LEVEL_VERBOSE, tag, __VA_ARGS__)
+#define ESP_LOGVV(tag, ...) \
+  ::esphome::host_log(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __VA_ARGS__)
+
+
+namespace esphome {
+
+uint32_t millis();
+
+// Host only: make millis() jump ahead, to simulate waiting without
+// sleeping.
+void host_advance_millis(uint32_t ms);
+
+// (advances millis(), see host_advance_millis())
+void delay(uint32_t ms);
+
+uint16_t crc16(const uint8_t* data, uint16_t len, uint16_t crc = 0xffff);
+
+
+// Preferences. Host only: "flash" is a byte vector per key, which
+// survives host_setup(), so tools can simulate a reboot.
+
+class ESPPreferenceObject {
+public:
+  ESPPreferenceObject() = default;
+  ESPPreferenceObject(std::vector<uint8_t>* data, uint32_t* writes)
+    : data_(data), writes_(writes) {}
+
+  template<typename T> bool save(const T* src) {
+    if (!data_ || data_->size() != sizeof(T))
+      return false;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+    data_->assign(bytes, bytes + sizeof(T));
+    ++*writes_;
+    return true;
+  }
+
+  template<typename T> bool load(T* dest) {
+    if (!data_ || data_->size() != sizeof(T) || !*writes_)
+      return false;
+    memcpy(dest, data_->data(), sizeof(T));
+    return true;
+  }
+
+private:
+  std::vector<uint8_t>* data_ = nullptr;
+  uint32_t* writes_ = nullptr;
+};
+
+class ESPPreferences {
+public:
+  template<typename T>
+  ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
+    Slot& slot = slots_[type];
+    slot.data.resize(sizeof(T));
+    return ESPPreferenceObject(&slot.data, &slot.writes);
+  }
+
+  // Host only: number of save() calls for key
+  uint32_t writes(uint32_t type) { return slots_[type].writes; }
+
+private:
+  struct Slot {
+    std::vector<uint8_t> data;
+    uint32_t writes = 0;
+  };
+  std::map<uint32_t, Slot> slots_;
+};
+
+extern ESPPreferences* global_preferences;
+
+
+struct Color {
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint8_t white;
+
+  constexpr Color() : red(0), green(0), blue(0), white(0) {}
+  constexpr Color(uint8_t red, uint8_t green, uint8_t blue,
+                  uint8_t white = 0)
+    : red(red), green(green), blue(blue), white(white) {}
+
+  bool is_on() const { return red || green || blue || white; }
+
+  bool operator==(const Color& other) const {
+    return red == other.red && green == other.green &&
+      blue == other.blue && white == other.white;
+  }
+  bool operator!=(const Color& other) const { return !(*this == other); }
+};
+
+
+struct ESPTime {
+  uint8_t second;
+  uint8_t minute;
+  uint8_t hour;
+  uint8_t day_of_week;  // 1 = Sunday
+  uint8_t day_of_month;
+  uint16_t day_of_year;
+  uint8_t month;
+  uint16_t year;
+  bool is_dst;
+  time_t timestamp;
+
+  std::string strftime(const std::string& format) const;
+
+  bool is_valid() const { return year >= 2019 && fields_in_range(); }
+  bool fields_in_range() const;
+
+  void increment_second();
+  void increment_day();
+
+  void recalc_timestamp_utc(bool use_day_of_year = true);
+  void recalc_timestamp_local(bool use_day_of_year = true);
+
+  static ESPTime from_c_tm(const struct tm* c_tm, time_t c_time);
+  static ESPTime from_epoch_local(time_t epoch);
+  static ESPTime from_epoch_utc(time_t epoch);
+
+private:
+  struct tm to_c_tm() const;
+};
+
+
+template<typename T> T& id(T* value) { return *value; }
+
+
+namespace display {
+
+extern const Color COLOR_OFF;
+extern const Color COLOR_ON;
+
+enum class TextAlign {
+  TOP = 0x00,
+  CENTER_VERTICAL = 0x01,
+  BASELINE = 0x02,
+  BOTTOM = 0x04,
+
+  LEFT = 0x00,
+  CENTER_HORIZONTAL = 0x08,
+  RIGHT = 0x10,
+
+  TOP_LEFT = TOP | LEFT,
+  TOP_CENTER = TOP | CENTER_HORIZONTAL,
+  TOP_RIGHT = TOP | RIGHT,
+
+  CENTER_LEFT = CENTER_VERTICAL | LEFT,
+  CENTER = CENTER_VERTICAL | CENTER_HORIZONTAL,
+  CENTER_RIGHT = CENTER_VERTICAL | RIGHT,
+
+  BASELINE_LEFT = BASELINE | LEFT,
+  BASELINE_CENTER = BASELINE | CENTER_HORIZONTAL,
+  BASELINE_RIGHT = BASELINE | RIGHT,
+
+  BOTTOM_LEFT = BOTTOM | LEFT,
+  BOTTOM_CENTER = BOTTOM | CENTER_HORIZONTAL,
+  BOTTOM_RIGHT = BOTTOM | RIGHT,
+};
+
+enum class ImageAlign {
+  TOP = 0x00,
+  CENTER_VERTICAL = 0x01,
+  BOTTOM = 0x02,
+
+  LEFT = 0x00,
+  CENTER_HORIZONTAL = 0x04,
+  RIGHT = 0x08,
+
+  TOP_LEFT = TOP | LEFT,
+  TOP_CENTER = TOP | CENTER_HORIZONTAL,
+  TOP_RIGHT = TOP | RIGHT,
+
+  CENTER_LEFT = CENTER_VERTICAL | LEFT,
+  CENTER = CENTER_VERTICAL | CENTER_HORIZONTAL,
+  CENTER_RIGHT = CENTER_VERTICAL | RIGHT,
+
+  BOTTOM_LEFT = BOTTOM | LEFT,
+  BOTTOM_CENTER = BOTTOM | CENTER_HORIZONTAL,
+  BOTTOM_RIGHT = BOTTOM | RIGHT,
+};
+
+enum DisplayRotation {
+  DISPLAY_ROTATION_0_DEGREES = 0,
+  DISPLAY_ROTATION_90_DEGREES = 90,
+  DISPLAY_ROTATION_180_DEGREES = 180,
+  DISPLAY_ROTATION_270_DEGREES = 270,
+};
+
+class Display;
+
+class BaseFont {
+public:
+  virtual ~BaseFont() = default;
+  virtual void print(int x, int y, Display* display, Color color,
+                     const char* text) = 0;
+  virtual void measure(const char* str, int* width, int* x_offset,
+                       int* baseline, int* height) = 0;
+};
+
+class BaseImage {
+public:
+  virtual ~BaseImage() = default;
+  virtual void draw(int x, int y, Display* display,
+                    Color color_on, Color color_off) = 0;
+  virtual int get_width() const = 0;
+  virtual int get_height() const = 0;
+};
+
+
+class Display {
+public:
+  virtual ~Display() = default;
+
+  virtual int get_width() = 0;
+  virtual int get_height() = 0;
+
+  virtual void fill(Color color);
+  void clear() { fill(COLOR_OFF); }
+
+  void draw_pixel_at(int x, int y) { draw_pixel_at(x, y, COLOR_ON); }
+  virtual void draw_pixel_at(int x, int y, Color color) = 0;
+
+  void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
+  void horizontal_line(int x, int y, int width, Color color = COLOR_ON);
+  void vertical_line(int x, int y, int height, Color color = COLOR_ON);
+  void rectangle(int x1, int y1, int width, int height,
+                 Color color = COLOR_ON);
+  void filled_rectangle(int x1, int y1, int width, int height,
+                        Color color = COLOR_ON);
+
+  void print(int x, int y, BaseFont* font, Color color, TextAlign align,
+             const char* text);
+  void print(int x, int y, BaseFont* font, TextAlign align,
+             const char* text) {
+    print(x, y, font, COLOR_ON, align, text);
+  }
+  void printf(int x, int y, BaseFont* font, Color color, TextAlign align,
+              const char* format, ...)
+    __attribute__((format(printf, 7, 8)));
+  void printf(int x, int y, BaseFont* font, TextAlign align,
+              const char* format, ...)
+    __attribute__((format(printf, 6, 7)));
+
+  void image(int x, int y, BaseImage* image,
+             Color color_on = COLOR_ON, Color color_off = COLOR_OFF) {
+    this->image(x, y, image, ImageAlign::TOP_LEFT, color_on, color_off);
+  }
+  void image(int x, int y, BaseImage* image, ImageAlign align,
+             Color color_on = COLOR_ON, Color color_off = COLOR_OFF);
+
+  void get_text_bounds(int x, int y, const char* text, BaseFont* font,
+                       TextAlign align, int* x1, int* y1,
+                       int* width, int* height);
+
+protected:
+  void vprintf_(int x, int y, BaseFont* font, Color color, TextAlign align,
+                const char* format, va_list arg);
+};
+
+
+using display_writer_t = std::function<void(Display&)>;
+
+class DisplayBuffer : public Display {
+public:
+  int get_width() override;
+  int get_height() override;
+
+  void draw_pixel_at(int x, int y, Color color) override;
+  using Display::draw_pixel_at;
+
+  void set_rotation(DisplayRotation rotation) { rotation_ = rotation; }
+  void set_writer(display_writer_t&& writer) { writer_ = writer; }
+
+  // Number of draw_pixel_at() calls since construction. Host only;
+  // used by the benchmarks to show how much work goes through the
+  // virtual per-pixel interface.
+  uint64_t pixel_calls = 0;
+
+protected:
+  virtual int get_width_internal() = 0;
+  virtual int get_height_internal() = 0;
+  virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+
+  void init_internal_(uint32_t buffer_length);
+  void do_update_();
+
+  std::vector<uint8_t> storage_;
+  uint8_t* buffer_ = nullptr;
+  DisplayRotation rotation_ = DISPLAY_ROTATION_0_DEGREES;
+  display_writer_t writer_;
+};
+
+}  // namespace display
+
+
+namespace font {
+
+// Stand-in for a rasterised font. Glyphs are boxes of roughly the
+// right size, drawn pixel by pixel like ESPHome draws glyph bitmaps,
+// so that text costs about as much as on the device.
+class Font : public display::BaseFont {
+public:
+  Font(int size, int height, int baseline)
+    : size_(size), height_(height), baseline_(baseline) {}
+
+  void print(int x, int y, display::Display* display, Color color,
+             const char* text) override;
+  void measure(const char* str, int* width, int* x_offset,
+               int* baseline, int* height) override;
+
+  int get_height() const { return height_; }
+  int get_baseline() const { return baseline_; }
+
+private:
+  int glyph_width(uint32_t codepoint) const;
+
+  int size_;
+  int height_;
+  int baseline_;
+};
+
+}  // namespace font
+
+
+namespace image {
+
+enum ImageType {
+  IMAGE_TYPE_BINARY = 0,
+  IMAGE_TYPE_TRANSPARENT_BINARY = 1,
+};
+
+// Stand-in for a converted image. Contents are a generated outline
+// shape instead of the real icon.
+class Image : public display::BaseImage {
+public:
+  Image(int width, int height, ImageType type)
+    : width_(width), height_(height), type_(type) {}
+
+  void draw(int x, int y, display::Display* display,
+            Color color_on, Color color_off) override;
+  int get_width() const override { return width_; }
+  int get_height() const override { return height_; }
+
+private:
+  bool get_pixel(int x, int y) const;
+
+  int width_;
+  int height_;
+  ImageType type_;
+};
+
+}  // namespace image
+
+
+class GPIOPin {
+public:
+  virtual ~GPIOPin() = default;
+  virtual bool digital_read() = 0;
+  virtual void digital_write(bool value) = 0;
+};
+
+
+namespace waveshare_epaper {
+
+class WaveshareEPaper : public display::DisplayBuffer {
+public:
+  void update() {
+    this->do_update_();
+    this->display();
+  }
+  void fill(Color color) override;
+
+  virtual void display() = 0;
+  virtual void initialize() = 0;
+
+  // SPI, as in ESPHome. On the host, these go to spi_() of the
+  // simulated controller.
+  void command(uint8_t value);
+  void data(uint8_t value);
+  void write_array(const uint8_t* data, size_t length) {
+    spi_(true, data, length);
+  }
+
+protected:
+  virtual uint32_t get_buffer_length_() = 0;
+
+  void start_data_() {}
+  void end_data_() {}
+
+  // as in ESPHome
+  void reset_();
+  bool wait_until_idle_();
+
+  virtual void spi_(bool is_data, const uint8_t* data, size_t length) = 0;
+
+  GPIOPin* reset_pin_ = nullptr;
+  uint32_t reset_duration_ = 200;
+  GPIOPin* busy_pin_ = nullptr;
+};
+
+// Host only: model of the SSD1680 panel controller, written from its
+// datasheet rather than from the code that drives it, to check the
+// command sequences: RAM writes go through the address counters and
+// window, the shown image is latched on master activation, and
+// nothing is accepted in deep sleep (until a hardware reset) or while
+// BUSY. BUSY is in millis() time.
+class Ssd1680 {
+public:
+  static constexpr int RAM_X_BYTES = 176 / 8;  // sources
+  static constexpr int RAM_Y = 296;            // gates
+
+  // panel of width x height pixels on the first sources and gates
+  Ssd1680(int width, int height);
+
+  // reset pin, active low
+  void set_reset_pin(bool level);
+  bool busy() const { return int32_t(millis() - busy_until_) < 0; }
+  void command(uint8_t value);
+  void data(uint8_t value);
+
+  // true if the last refresh showed black plane then red plane of
+  // width x height bits, rows of width / 8 bytes
+  bool shows(const uint8_t* planes) const;
+
+  uint32_t refresh_ms = 15000;
+  unsigned refresh_count = 0;
+  // commands or data that were ignored, as sent in deep sleep, during
+  // reset or while BUSY
+  unsigned ignored = 0;
+
+private:
+  void reset_registers();
+  void write_ram(uint8_t value);
+  bool advance_x();  // true on wrap-around
+  bool advance_y();
+
+  int width_, height_;
+  std::vector<uint8_t> ram_[2];   // black/white, red: RAM_Y rows
+  std::vector<uint8_t> shown_[2];  // latched by master activation
+  bool in_reset_ = false;
+  bool asleep_ = false;
+  uint32_t busy_until_ = 0;
+  uint8_t command_ = 0;
+  int data_index_ = 0;  // data bytes since command_
+  uint8_t entry_mode_;
+  int x_start_, x_end_, y_start_, y_end_;
+  int x_, y_;  // address counters
+  uint8_t update_control_2_;
+};
+
+// Stand-in for the 2.90in3c (WeAct 2.9" red/black/white) model. The
+// buffer holds two planes of get_width_internal() x
+// get_height_internal() bits, MSB first: black plane (bit set =
+// white) followed by red plane (bit set = red).
+//
+// The panel is a Ssd1680 model. display() sends the frame and waits
+// for BUSY like the real driver, by advancing millis().
+class WaveshareEPaper2P9InBV4 : public WaveshareEPaper {
+public:
+  WaveshareEPaper2P9InBV4() : panel_(128, 296) {}
+
+  void initialize() override;
+  void display() override;
+
+  // Host only: true if the panel shows the frame buffer contents
+  bool panel_matches_buffer();
+
+  // Host only: commands and data the panel ignored
+  unsigned panel_ignored() const { return panel_.ignored; }
+
+  // Host only: how long the panel stays BUSY after a refresh
+  void set_panel_refresh_ms(uint32_t ms) { panel_.refresh_ms = ms; }
+
+  // Host only: read back a pixel in rotated (logical) coordinates.
+  // Returns COLOR_OFF for white, COLOR_ON for black, or pure red.
+  Color get_pixel(int x, int y);
+
+  // Host only: write the current frame as a binary PPM image.
+  bool write_ppm(const char* path);
+
+protected:
+  int get_width_internal() override { return 128; }
+  int get_height_internal() override { return 296; }
+  uint32_t get_buffer_length_() override {
+    return get_width_internal() * get_height_internal() / 8u * 2u;
+  }
+  void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void spi_(bool is_data, const uint8_t* data, size_t length) override;
+
+private:
+  // the driver's initialize(), after waking from deep sleep
+  void init_panel_();
+
+  struct BusyPin : GPIOPin {
+    Ssd1680* panel;
+    bool digital_read() override { return panel->busy(); }
+    void digital_write(bool) override {}
+  };
+  struct ResetPin : GPIOPin {
+    Ssd1680* panel;
+    bool digital_read() override { return true; }
+    void digital_write(bool value) override { panel->set_reset_pin(value); }
+  };
+
+  Ssd1680 panel_;
+  BusyPin busy_pin_model_;
+  ResetPin reset_pin_model_;
+};
+
+}  // namespace waveshare_epaper
+
+
+namespace time {
+
+class RealTimeClock {
+public:
+  ESPTime now() { return ESPTime::from_epoch_local(now_); }
+  ESPTime utcnow() { return ESPTime::from_epoch_utc(now_); }
+
+  // Host only: the clock doesn't run; tools set it explicitly.
+  void set_epoch_time(time_t epoch) { now_ = epoch; }
+
+private:
+  time_t now_ = 0;
+};
+
+}  // namespace time
+
+namespace homeassistant {
+class HomeassistantTime : public time::RealTimeClock {};
+}  // namespace homeassistant
+
+
+namespace template_ {
+
+class TemplateNumber {
+public:
+  float state = NAN;
+};
+
+class TemplateSwitch {
+public:
+  bool state = false;
+};
+
+}  // namespace template_
+
+
+namespace globals {
+
+template<typename T> class GlobalsComponent {
+public:
+  T& value() { return value_; }
+
+private:
+  T value_{};
+};
+
+template<typename T> T& id(GlobalsComponent<T>* value) {
+  return value->value();
+}
+
+}  // namespace globals
+
+using globals::id;
+
+}  // namespace esphome
+
+
+using namespace esphome;
+using namespace esphome::display;
+
+
+// Stand-ins for the objects that ESPHome generates from
+// epaper-electricity-price.yaml. Keep in sync with the yaml file.
+
+// types used in globals (from esphome: includes:)
+#include "price.h"
+#include "prices.h"
+
+extern globals::GlobalsComponent<PriceStore>* price_store;
+extern globals::GlobalsComponent<ESPTime>* prices_start_date;
+extern globals::GlobalsComponent<bool>* update_on_time_sync;
+
+extern Color* red;
+extern font::Font* main_font;
+extern font::Font* cur_price_font;
+extern image::Image* no_data_icon;
+extern image::Image* price_alert_icon;
+extern waveshare_epaper::WaveshareEPaper2P9InBV4* epaper;
+extern template_::TemplateNumber* gradient_top;
+extern template_::TemplateNumber* gradient_bottom;
+extern template_::TemplateNumber* display_update_delay;
+extern template_::TemplateNumber* refresh_lead_time;
+extern template_::TemplateNumber* cheapest_window_hours;
+extern template_::TemplateNumber* cheapest_window_deadline;
+extern template_::TemplateSwitch* show_past_hours_switch;
+extern template_::TemplateSwitch* price_warning_switch;
+extern homeassistant::HomeassistantTime* homeassistant_time;
+
+// Host only: set the timezone to Europe/Helsinki, or to UTC, as on the
+// device before the time component's setup applies the configured
+// timezone.
+void host_set_local_timezone(bool local);
+
+// Host only: create the objects above with the settings from the yaml
+// file (gradient 20...40 c, both switches on, 3 h cheapest window
+// without deadline).
+void host_setup();
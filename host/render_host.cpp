@@ -0,0 +1,873 @@
+// Host harness: renders draw() from draw.h into the in-memory frame
+// buffer of the stand-in e-paper display, so that the exact drawing
+// code that runs on the device can be profiled with perf, valgrind,
+// callgrind etc.
+//
+// usage: render_host [options]
+//   -o FILE   write the rendered frame as PPM image
+//   -n N      render N frames and print timing (default 1), also of
+//             laying out and rasterizing the frame separately
+//   -t EPOCH  current time as Unix time (default 2024-06-20 14:30 local)
+//   -p        hide past hours (show past hours switch off)
+//   -e        no price data (shows the "no data" icon)
+//   -s MIN    price slot length in minutes: 15, 30 or 60 (default 60)
+//   -a SECS   then advance the clock by SECS and update once more, to
+//             see what changes (e.g. -a 3600 for the hourly update)
+//   -u        then replay a burst of update requests (two gradient
+//             changes, an hourly update and resent prices, which are
+//             dropped as unchanged) with and without the update
+//             scheduler, and compare refreshes; then send stale
+//             prices and check that the start date is kept
+//   -l        then simulate the start of the next price slot, with and
+//             without drawing the next slot in advance, and show when
+//             the refresh finishes
+//   -T        then let the panel stay BUSY for too long, and check
+//             that the refresh times out, isn't counted as done, and
+//             that the next update sends the whole frame
+//   -r        then save prices, simulate a reboot, restore them and
+//             check that the first frame after time sync is the same
+//   -w HOURS  length of the cheapest window (default 3, 0 = off)
+//   -d HOUR   deadline of the cheapest window (default -1 = none)
+//   -q        then check all range and cheapest window queries of the
+//             query_prices service against a brute force scan, and
+//             time them
+//   -P        then send the prices with set_prices and set_prices_packed
+//             (also with gaps), check that both store the same, and
+//             compare their peak heap use
+//   -g        first set a gradient of three stops with set_gradient,
+//             check its redness table against interpolation between
+//             the stops, and draw with it
+//   -D        then, a day later, receive only the prices of the day
+//             after, and check that the day's prices are kept and the
+//             previous day's expired
+//   -b        draw only 48 full-height dithered bars with BlackRedBars,
+//             instead of the whole frame, bar by bar
+//   -S        with -b, draw the bars row by row (draw_scanlines())
+//   -N        with -b, draw the bars in the panel's memory order
+//             (NativeBars)
+//   -v LEVEL  log level (1 = errors ... 7 = very verbose)
+//
+// Exits with status 1 if a check fails.
+
+#include <esphome.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <new>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "draw.h"
+#include "ingest.h"
+#include "persist.h"
+
+
+// Heap use, for -P, as allocated by malloc(). (Not inlined, so that
+// GCC doesn't take free() for a mismatched deallocation.)
+static size_t heap_in_use = 0;
+static size_t heap_peak = 0;
+
+__attribute__((noinline))
+void* operator new(size_t size) {
+  void* ptr = malloc(size);
+  if (!ptr)
+    throw std::bad_alloc();
+  heap_in_use += malloc_usable_size(ptr);
+  heap_peak = std::max(heap_peak, heap_in_use);
+  return ptr;
+}
+
+__attribute__((noinline))
+void operator delete(void* ptr) noexcept {
+  heap_in_use -= malloc_usable_size(ptr);
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+
+// draw() for the other layouts must compile too, even though the
+// stand-in display is only 296x128
+template void draw<Layout4in2, Display>(Display&);
+template void draw<Layout7in5, Display>(Display&);
+
+
+// 48 hours of plausible prices in cents: a daily double hump with an
+// expensive evening, a negative hour and some spread between days.
+// Shorter slots are interpolated between the hourly values, with
+// some zigzag so that they differ visibly.
+static void fill_example_prices(time_t now, int slot_minutes) {
+  static const float DAY[24] = {
+    4.1f, 3.6f, 3.2f, 2.9f, 3.0f, 3.8f, 6.5f, 11.2f,
+    14.8f, 13.1f, 9.7f, 7.4f, 6.2f, 5.9f, 6.8f, 8.9f,
+    15.6f, 27.3f, 38.9f, 31.2f, 18.4f, 10.1f, 7.7f, 5.2f,
+  };
+
+  auto hourly = [&](int i) {
+    return i == 27 ? -0.4f : DAY[i % 24] * (i < 24 ? 1.0f : 0.8f);
+  };
+  const int slots_per_hour = 60 / slot_minutes;
+  std::vector<float> prices;
+  for (int i = 0; i < 48; ++i)
+    for (int slot = 0; slot < slots_per_hour; ++slot) {
+      const float t = float(slot) / slots_per_hour;
+      const float next = i + 1 < 48 ? hourly(i + 1) : hourly(i);
+      prices.push_back(hourly(i) + t * (next - hourly(i)) +
+                       (slot % 2 ? 0.7f : 0.0f));
+    }
+
+  ESPTime start = ESPTime::from_epoch_local(now);
+  ESPTime& dest = id(prices_start_date);
+  dest = start;
+  dest.hour = dest.minute = dest.second = 0;
+  dest.recalc_timestamp_local(false);
+
+  id(price_store).clear(slot_minutes);
+  id(price_store).assign(PriceStore::slot_number(dest.timestamp, slot_minutes),
+                         prices, slot_minutes);
+}
+
+// Prices of the slots of store, by index
+static std::vector<price_t> stored_prices(const PriceStore& store) {
+  std::vector<price_t> prices;
+  for (int i = 0; i < store.size(); ++i)
+    prices.push_back(store[i]);
+  return prices;
+}
+
+// set_prices again with the stored prices, as Home Assistant does
+// after reconnecting. Returns false if dropped as unchanged.
+static bool resend_prices() {
+  const PriceStore& store = id(price_store);
+  const ESPTime& start = id(prices_start_date);
+  std::vector<float> prices;
+  for (int32_t slot = store.slot_at(start.timestamp);
+       store.at(slot) != PRICE_MISSING; ++slot)
+    prices.push_back(price_to_cents(store.at(slot)));
+  return receive_prices(prices, store.slot_minutes(),
+                        start.year, start.month, start.day_of_month);
+}
+
+// Pack prices for set_prices_packed (see PackedPrices), up to the
+// last one that isn't missing
+static std::string pack_prices(const price_t* begin, const price_t* end) {
+  while (end != begin && end[-1] == PRICE_MISSING)
+    --end;
+  std::string packed;
+  char hex[8];
+  int previous = 0;
+  for (const price_t* p = begin; p != end; ++p) {
+    const int change = *p - previous;
+    if (*p != PRICE_MISSING && change >= -127 && change <= 127)
+      snprintf(hex, sizeof(hex), "%02x", change & 0xff);
+    else
+      snprintf(hex, sizeof(hex), "80%04x", *p & 0xffff);
+    packed += hex;
+    if (*p != PRICE_MISSING)
+      previous = *p;
+  }
+  return packed;
+}
+
+// Receive prices like the API does, and return the peak heap use
+// above what was in use before. The API decodes each argument into a
+// message and passes a copy of it to the service: repeated floats
+// one by one into a vector, a string at once.
+static size_t set_prices_peak_heap(const std::vector<float>& payload,
+                                   int slot_minutes, const ESPTime& start)
+{
+  const size_t before = heap_in_use;
+  heap_peak = before;
+  {
+    std::vector<float> message;
+    for (float price : payload)
+      message.push_back(price);
+    const std::vector<float> prices = message;
+    receive_prices(prices, slot_minutes,
+                   start.year, start.month, start.day_of_month);
+  }
+  return heap_peak - before;
+}
+
+static size_t set_prices_packed_peak_heap(const std::string& payload,
+                                          int slot_minutes, time_t start)
+{
+  const size_t before = heap_in_use;
+  heap_peak = before;
+  {
+    const std::string message(payload.data(), payload.size());
+    const std::string prices = message;
+    receive_packed_prices(prices, start, slot_minutes);
+  }
+  return heap_peak - before;
+}
+
+const int BARS_BASE_Y = 106;
+
+// gradient from black at BARS_BASE_Y to red at the top, with "prices"
+// in pixels above BARS_BASE_Y
+static const RednessTable<128>& bars_redness_table() {
+  static RednessTable<128> table;
+  if (!table.valid(1)) {
+    const GradientStop stops[] = {{0, 0}, {BARS_BASE_Y, 0xff}};
+    table.build(stops, 2, [](price_t h) { return BARS_BASE_Y - h; }, 1);
+  }
+  return table;
+}
+
+static const uint8_t* bars_redness() {
+  return bars_redness_table().get();
+}
+
+// bars spanning the whole gradient, the expensive case for
+// dithering, one bar at a time
+static void draw_bars_only(Display& it) {
+  const int base_y = BARS_BASE_Y;
+  BlackRedBars bars(bars_redness(), base_y, it.get_height(), 3);
+  for (int hour = 0; hour < 48; ++hour)
+    bars.draw_bar(77 + 4*hour, base_y, false, hour < 14);
+}
+
+// the same, row by row
+static void draw_bars_only_scanlines(Display& it) {
+  const int base_y = BARS_BASE_Y;
+  BlackRedBars bars(bars_redness(), base_y, it.get_height(), 3);
+  BarColumns<48 * 4> columns;
+  for (int hour = 0; hour < 48; ++hour)
+    for (int col = 0; col < 3; ++col)
+      bars.set_column(columns, 4*hour + col, base_y, false, hour < 14);
+  bars.draw_scanlines(77, columns);
+}
+
+// the same, in the panel's memory order
+static void draw_bars_only_native(Display& it) {
+  const int base_y = BARS_BASE_Y;
+  BlackRedBars bars(bars_redness(), base_y, it.get_height(), 3);
+  BarColumns<48 * 4> columns;
+  for (int hour = 0; hour < 48; ++hour)
+    for (int col = 0; col < 3; ++col)
+      bars.set_column(columns, 4*hour + col, base_y, false, hour < 14);
+  static NativeBars<128> native_bars;
+  native_bars.draw(77, columns, bars_redness_table());
+}
+
+// Time lay_out_frame() and rasterize() of the current frame, each
+// iterations times, and print them per frame
+static void time_display_list(long iterations) {
+  auto& display = id(epaper);
+  static DisplayList<Layout2in9::GRAPH_WIDTH> list;
+  static RednessTable<Layout2in9::SCREEN_HEIGHT> redness_table;
+  const ESPTime now = display_now();
+  const FrameInputs inputs = frame_inputs(now);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; ++i)
+    lay_out_frame<Layout2in9>(display, now, inputs, list, redness_table);
+  const auto laid_out = std::chrono::steady_clock::now();
+  // (over the same frame, so the pixels don't change)
+  for (long i = 0; i < iterations; ++i)
+    rasterize<Layout2in9>(display, list, redness_table);
+  const auto end = std::chrono::steady_clock::now();
+
+  printf("layout:          %.1f us per frame, %d operations (%zu bytes)\n",
+         std::chrono::duration<double, std::micro>(
+           laid_out - start).count() / iterations,
+         list.size(), sizeof(list));
+  printf("rasterize:       %.1f us per frame\n",
+         std::chrono::duration<double, std::micro>(
+           end - laid_out).count() / iterations);
+}
+
+// Set a gradient of three stops, out of order and with redness going
+// down again, as the set_gradient service does, and check the redness
+// table built for it: each stop's redness at its row, linear in
+// between (to rounding), and the outermost stops' redness beyond them.
+// Returns the number of wrong rows.
+static int check_gradient() {
+  const std::vector<float> prices = {20.0f, 0.0f, 10.0f};
+  const std::vector<int32_t> redness = {0x40, 0, 0x1ff};  // 0x1ff -> 0xff
+  receive_gradient_stops(prices, redness);
+
+  // stops sorted by price, at rows 110, 60, 10
+  const int ys[] = {110, 60, 10};
+  const int reds[] = {0, 0xff, 0x40};
+  auto price_to_y = [](price_t price) { return 110 - price / 2; };
+  RednessTable<128> table;
+  GradientStop stops[MAX_GRADIENT_STOPS];
+  const int n = current_gradient_stops(stops);
+  table.build(stops, n, price_to_y, 1);
+
+  int wrong = n == 3 ? 0 : 128;
+  for (int y = 0; y < 128; ++y) {
+    double expected;
+    if (y >= ys[0])
+      expected = reds[0];
+    else if (y <= ys[2])
+      expected = reds[2];
+    else {
+      const int i = y > ys[1] ? 0 : 1;
+      const double t = double(ys[i] - y) / (ys[i] - ys[i + 1]);
+      expected = reds[i] + t * (reds[i + 1] - reds[i]);
+    }
+    if (std::fabs(table.get()[y] - expected) > 1) {
+      if (wrong < 3)
+        printf("  row %d: redness %d, expected %.1f\n",
+               y, table.get()[y], expected);
+      ++wrong;
+    }
+  }
+  return wrong;
+}
+
+// Check range and cheapest window queries of price_index for every
+// range of prices against a brute force scan
+static void check_queries(const PriceStore& prices,
+                          long* count, long* wrong, double* us)
+{
+  const int n = prices.size();
+  for (int begin = 0; begin < n; ++begin) {
+    for (int end = begin + 1; end <= n; ++end) {
+      const int length = end - begin > 4 ? 4 : 1;
+      const auto start = std::chrono::steady_clock::now();
+      const RangeStats stats = price_index.range(begin, end);
+      const PriceWindow window =
+        price_index.cheapest_window(begin, end, length);
+      *us += std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+
+      const ColumnStats expected = aggregate_slots(
+        prices, prices.first_slot() + begin, prices.first_slot() + end);
+      PriceWindow expected_window = {-1, length, PRICE_MISSING};
+      int best_sum = 0;
+      for (int i = begin; i + length <= end; ++i) {
+        int sum = 0, present = 0;
+        for (int j = i; j < i + length; ++j)
+          if (prices[j] != PRICE_MISSING) {
+            sum += prices[j];
+            ++present;
+          }
+        if (present == length &&
+            (expected_window.start < 0 || sum < best_sum)) {
+          expected_window.start = i;
+          expected_window.mean = div_round(sum, length);
+          best_sum = sum;
+        }
+      }
+
+      ++*count;
+      if (stats.min != expected.min || stats.max != expected.max ||
+          stats.mean != expected.mean ||
+          window.start != expected_window.start ||
+          window.mean != expected_window.mean)
+        ++*wrong;
+    }
+  }
+}
+
+// Main loop while a non-blocking refresh is in progress: poll every
+// 20 ms, like the interval in the yaml file, in simulated time
+struct LoopStats {
+  long polls = 0;
+  double longest_poll_us = 0;
+};
+
+static LoopStats finish_refresh() {
+  LoopStats stats;
+  while (display_refresh_in_progress) {
+    host_advance_millis(20);
+    const auto start = std::chrono::steady_clock::now();
+    poll_display_update();
+    const double us = std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - start).count();
+    ++stats.polls;
+    stats.longest_poll_us = std::max(stats.longest_poll_us, us);
+  }
+  return stats;
+}
+
+int main(int argc, char** argv) {
+  const char* output = nullptr;
+  long iterations = 1;
+  time_t now = 1718883000;  // 2024-06-20 14:30 EEST
+  bool no_data = false;
+  bool show_past_hours = true;
+  bool bars_only = false;
+  bool scanlines = false;
+  bool native = false;
+  int slot_minutes = 60;
+  float window_hours = 3;
+  float window_deadline = -1;
+  long advance = 0;
+  bool reboot = false;
+  bool queries = false;
+  bool packed = false;
+  bool rollover = false;
+  bool requests = false;
+  bool hour_change = false;
+  bool stuck_busy = false;
+  bool gradient = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:n:t:pes:a:ulTrqPgDw:d:bSNv:")) != -1) {
+    switch (opt) {
+    case 'o': output = optarg; break;
+    case 'n': iterations = std::atol(optarg); break;
+    case 't': now = std::atoll(optarg); break;
+    case 'p': show_past_hours = false; break;
+    case 'e': no_data = true; break;
+    case 's': slot_minutes = std::atoi(optarg); break;
+    case 'a': advance = std::atol(optarg); break;
+    case 'u': requests = true; break;
+    case 'l': hour_change = true; break;
+    case 'T': stuck_busy = true; break;
+    case 'r': reboot = true; break;
+    case 'q': queries = true; break;
+    case 'P': packed = true; break;
+    case 'g': gradient = true; break;
+    case 'D': rollover = true; break;
+    case 'w': window_hours = std::atof(optarg); break;
+    case 'd': window_deadline = std::atof(optarg); break;
+    case 'b': bars_only = true; break;
+    case 'S': scanlines = true; break;
+    case 'N': native = true; break;
+    case 'v': esphome::host_log_level = std::atoi(optarg); break;
+    default:
+      fprintf(stderr,
+              "usage: %s [-o FILE] [-n N] [-t EPOCH] [-p] [-e] [-s MIN] [-a SECS] [-u] [-l] [-T] [-r] [-q] [-P] [-g] [-D] [-w HOURS] [-d HOUR] [-b] [-S] [-N] [-v LEVEL]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  host_setup();
+  id(homeassistant_time).set_epoch_time(now);
+  id(show_past_hours_switch).state = show_past_hours;
+  id(cheapest_window_hours).state = window_hours;
+  id(cheapest_window_deadline).state = window_deadline;
+  if (!no_data)
+    fill_example_prices(now, slot_minutes);
+  // as in set_prices
+  price_index.build(id(price_store));
+  if (gradient) {
+    const int wrong = check_gradient();
+    printf("gradient:        3 stops, %d of 128 rows wrong\n", wrong);
+    if (wrong)
+      return 1;
+  }
+  const auto window_start = std::chrono::steady_clock::now();
+  update_cheapest_window();
+  const double window_us = std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - window_start).count();
+
+  auto& display = id(epaper);
+  if (bars_only)
+    display.set_writer(native ? draw_bars_only_native :
+                       scanlines ? draw_bars_only_scanlines :
+                       draw_bars_only);
+  else
+    display.set_writer([](Display& it) { draw(it); });
+
+  // The first frame is refreshed without blocking; finish_refresh()
+  // stands in for the main loop until the panel is idle. The timed
+  // frames are unchanged, so they're rendered but not refreshed.
+  update_display();
+  const LoopStats loop_stats = finish_refresh();
+  const bool panel_matches = display.panel_matches_buffer();
+  const unsigned panel_ignored = display.panel_ignored();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; ++i)
+    update_display();
+  const auto end = std::chrono::steady_clock::now();
+
+  const double us = std::chrono::duration<double, std::micro>(
+    end - start).count();
+  printf("frames:          %ld\n", iterations);
+  printf("time per frame:  %.1f us\n", us / iterations);
+  printf("pixel calls:     %llu per frame\n",
+         (unsigned long long) (display.pixel_calls / iterations));
+  if (!bars_only)
+    time_display_list(iterations);
+  printf("refreshes:       %u done, %u skipped\n",
+         display_refreshes_done, display_refreshes_skipped);
+  printf("price store:     %zu bytes\n", sizeof(PriceStore));
+  printf("price index:     %zu bytes\n", sizeof(PriceIndex));
+  if (cheapest_window.start >= 0)
+    printf("cheapest window: %g h from %s, %.1f c (found in %.1f us)\n",
+           window_hours, cheapest_window_start_iso().c_str(),
+           price_to_cents(cheapest_window.mean), window_us);
+  if (display_refreshes_done) {
+    // time display() would have blocked, for comparison
+    const uint32_t blocking_start = millis();
+    display.display();
+    const uint32_t blocked = millis() - blocking_start;
+    printf("async refresh:   transfer %u ms + busy %u ms (simulated),"
+           " panel %s, %u commands ignored\n",
+           (unsigned) panel_refresh.transfer_ms,
+           (unsigned) panel_refresh.busy_ms,
+           panel_matches ? "matches frame" : "DIFFERS", panel_ignored);
+    printf("main loop:       %ld polls, longest %.1f us"
+           " (blocking display(): %u ms)\n",
+           loop_stats.polls, loop_stats.longest_poll_us,
+           (unsigned) blocked);
+  }
+  // (also without prices or a clock: the "no data" frame)
+  if (!display_refreshes_done || !panel_matches || panel_ignored)
+    return 1;
+
+  if (advance) {
+    id(homeassistant_time).set_epoch_time(now + advance);
+    update_display();
+    finish_refresh();
+    printf("after %+ld s:     %.0f%% of screen changed\n",
+           advance, display_dirty_percent);
+  }
+
+  if (requests) {
+    const time_t time = id(homeassistant_time).now().timestamp;
+    uint32_t refreshes[2];
+    for (int scheduled = 0; scheduled < 2; ++scheduled) {
+      id(homeassistant_time).set_epoch_time(time);
+      id(gradient_top).state = 40;
+      id(gradient_bottom).state = 20;
+      invalidate_gradient();
+      update_display();
+      finish_refresh();
+      const uint32_t refreshes_before = display_refreshes_done;
+      const uint32_t runs_before = display_updates_run;
+      int requested = 0;
+
+      // (ms, event), like they come from Home Assistant
+      for (uint32_t ms = 0; ms <= 60000; ms += 100, host_advance_millis(100)) {
+        UpdatePriority priority;
+        switch (ms) {
+        case 1000:  // gradient numbers edited one after the other
+          id(gradient_top).state = 30;
+          invalidate_gradient();  // on_value
+          priority = UPDATE_COSMETIC;
+          break;
+        case 4000:
+          id(gradient_bottom).state = 10;
+          invalidate_gradient();
+          priority = UPDATE_COSMETIC;
+          break;
+        case 30000:  // hour changes, and prices are resent
+          id(homeassistant_time).set_epoch_time(time + 3600);
+          priority = UPDATE_DATA;
+          break;
+        case 30300:
+          if (!resend_prices()) {
+            if (scheduled)
+              poll_display_update();
+            continue;
+          }
+          priority = UPDATE_DATA;
+          break;
+        default:
+          if (scheduled)
+            poll_display_update();
+          continue;
+        }
+        ++requested;
+        if (scheduled) {
+          request_display_update(priority);
+        }
+        else {
+          // as before the scheduler: blocks until refreshed
+          update_display();
+          finish_refresh();
+        }
+      }
+      finish_refresh();
+      refreshes[scheduled] = display_refreshes_done - refreshes_before;
+      if (scheduled)
+        printf("scheduler:       %d requests, %u updates run\n",
+               requested, display_updates_run - runs_before);
+    }
+    printf("refreshes:       %u direct, %u with scheduler\n",
+           refreshes[0], refreshes[1]);
+    printf("set_prices:      %u dropped as unchanged\n",
+           (unsigned) set_prices_dropped);
+
+    // a day of prices older than the stored ones, which are ignored
+    const ESPTime start_date = id(prices_start_date);
+    const PriceStore& store = id(price_store);
+    const ESPTime stale = ESPTime::from_epoch_local(
+      store.slot_start(store.first_slot()) - 36 * 3600);
+    receive_prices(std::vector<float>(store.slots_per_day(), 1.0f),
+                   store.slot_minutes(),
+                   stale.year, stale.month, stale.day_of_month);
+    const bool kept = id(prices_start_date).timestamp == start_date.timestamp;
+    printf("stale prices:    start date %s\n", kept ? "kept" : "MOVED");
+    if (!kept || refreshes[1] >= refreshes[0])
+      return 1;
+    id(homeassistant_time).set_epoch_time(time);
+    id(gradient_top).state = 40;
+    id(gradient_bottom).state = 20;
+    invalidate_gradient();
+    update_display();
+    finish_refresh();
+  }
+
+  if (hour_change) {
+    const time_t time = id(homeassistant_time).now().timestamp;
+    const time_t slot_seconds = id(price_store).slot_minutes() * 60;
+    const time_t next_slot = time - time % slot_seconds + slot_seconds;
+    for (int advance = 1; advance >= 0; --advance) {
+      // lead time too short to ever trigger = no drawing in advance
+      id(refresh_lead_time).state = advance ? 0 : 0.001f;
+
+      // from 1 min before the slot, with the clock running in step
+      // with millis()
+      const time_t sim_start = next_slot - 60;
+      const uint32_t sim_start_ms = millis();
+      const uint32_t refreshes = display_refreshes_done;
+      const uint32_t skipped = display_refreshes_skipped;
+      bool finished = false;
+      long finished_ms = 0;
+      time_t last_second = 0;
+      for (;;) {
+        host_advance_millis(20);
+        const uint32_t elapsed = millis() - sim_start_ms;
+        const time_t second = sim_start + elapsed / 1000;
+        id(homeassistant_time).set_epoch_time(second);
+        if (second != last_second && second % slot_seconds == 0)  // on_time
+          request_display_update(UPDATE_DATA);
+        last_second = second;
+
+        poll_display_update();
+        if (!finished && display_refreshes_done != refreshes) {
+          finished = true;
+          finished_ms = long(elapsed) - 60000;
+        }
+        if (elapsed > 120000 && !display_refresh_in_progress)
+          break;
+      }
+      printf("next slot:       %s: refreshed %+.1f s from its start,"
+             " %u refresh, %u skipped\n",
+             advance ? "drawn in advance" : "drawn at its start",
+             finished_ms / 1000.0,
+             display_refreshes_done - refreshes,
+             display_refreshes_skipped - skipped);
+      // drawn in advance, the refresh must be done by the slot start
+      if (!finished || (advance && finished_ms > 0))
+        return 1;
+
+      id(homeassistant_time).set_epoch_time(time);
+      update_display();
+      finish_refresh();
+    }
+    printf("measured:        render %u ms, refresh %u ms\n",
+           (unsigned) display_render_ms, (unsigned) display_refresh_ms);
+  }
+
+  if (stuck_busy) {
+    const uint32_t refreshes = display_refreshes_done;
+    display.set_panel_refresh_ms(PANEL_BUSY_TIMEOUT_MS + 10000);
+    const uint32_t start_ms = millis();
+    update_display(true);
+    finish_refresh();
+    const uint32_t gave_up_ms = millis() - start_ms;
+    const bool counted = display_refreshes_done != refreshes;
+    const bool forgotten = displayed_bands == 0;
+
+    // the same frame again, on a working panel
+    display.set_panel_refresh_ms(15000);
+    update_display();
+    finish_refresh();
+    const bool resent = display_refreshes_done != refreshes &&
+                        display.panel_matches_buffer();
+    printf("stuck panel:     gave up after %u ms, %s, next frame %s\n",
+           (unsigned) gave_up_ms, counted ? "COUNTED as done" : "not done",
+           resent ? "sent" : "NOT sent");
+    if (counted || !forgotten || !resent)
+      return 1;
+  }
+
+  if (reboot) {
+    save_prices();
+    save_prices();  // unchanged, shouldn't be written again
+    const uint32_t writes = global_preferences->writes(PRICES_RECORD_KEY);
+    const auto shown = displayed_band_hashes;
+    const PriceStore saved = id(price_store);
+
+    // RAM is lost, the timezone isn't set until the time component's
+    // setup, and the clock isn't set until Home Assistant connects
+    const ESPTime start_date = id(prices_start_date);
+    id(price_store).clear();
+    id(prices_start_date) = ESPTime::from_epoch_utc(0);
+    displayed_bands = 0;
+    const time_t time = id(homeassistant_time).now().timestamp;
+    id(homeassistant_time).set_epoch_time(0);
+    host_set_local_timezone(false);
+
+    const auto boot = std::chrono::steady_clock::now();
+    const bool restored = restore_prices();
+    price_index.build(id(price_store));
+    update_cheapest_window();
+    host_set_local_timezone(true);
+    update_display();  // deferred
+    id(homeassistant_time).set_epoch_time(time);
+    // on_time_sync
+    localize_prices_start_date();
+    update_cheapest_window();
+    if (id(update_on_time_sync)) {
+      id(update_on_time_sync) = false;
+      update_display();
+    }
+    const auto shown_at = std::chrono::steady_clock::now();
+    finish_refresh();
+
+    printf("reboot:          %s, %u flash writes for 2 saves,"
+           " record %zu bytes, start date %s\n",
+           restored ? "restored" : "NOT restored", writes,
+           sizeof(PricesRecord),
+           id(prices_start_date).timestamp == start_date.timestamp
+           ? "same" : "DIFFERS");
+    // restored slots are at least PRICES_SAVE_SLOT_MINUTES long, with
+    // the mean of the shorter slots saved
+    const PriceStore& store = id(price_store);
+    const int factor = store.slot_minutes() / saved.slot_minutes();
+    int wrong = 0;
+    for (int i = 0; i < store.size(); ++i) {
+      const int32_t first = (store.first_slot() + i) * factor;
+      if (store[i] != aggregate_slots(saved, first, first + factor).mean)
+        ++wrong;
+    }
+    printf("restored prices: %d min slots, %d of %d wrong\n",
+           store.slot_minutes(), wrong, store.size());
+    const bool same_frame = displayed_band_hashes == shown;
+    printf("restore + frame: %.1f us, frame %s\n",
+           std::chrono::duration<double, std::micro>(
+             shown_at - boot).count(),
+           same_frame ? "same as before"
+           : factor > 1 ? "of saved means" : "DIFFERS");
+    if (!restored || writes != 1 || wrong ||
+        id(prices_start_date).timestamp != start_date.timestamp ||
+        (!same_frame && factor == 1))
+      return 1;
+  }
+
+  if (queries) {
+    // as received, and with gaps
+    PriceStore& store = id(price_store);
+    const PriceStore received = store;
+    std::vector<price_t> gaps = stored_prices(received);
+    for (size_t i = 0; i < gaps.size(); ++i)
+      if (i % 7 == 3 || i >= gaps.size() * 3 / 4)
+        gaps[i] = PRICE_MISSING;
+    long count = 0, wrong = 0;
+    double us = 0;
+    for (int pass = 0; pass < 2; ++pass) {
+      if (pass == 1)
+        store.assign(received.first_slot(), gaps.data(), gaps.size(),
+                     received.slot_minutes());
+      price_index.build(store);
+      check_queries(store, &count, &wrong, &us);
+    }
+    store = received;
+    price_index.build(store);
+    printf("queries:         %ld ranges, %.2f us per range + window query,"
+           " %ld wrong\n", count, us / count, wrong);
+    if (wrong)
+      return 1;
+  }
+
+  if (packed) {
+    // as received, and with gaps and a price spike
+    const PriceStore received = id(price_store);
+    const ESPTime received_start = id(prices_start_date);
+    const std::vector<price_t> as_received = stored_prices(received);
+    std::vector<price_t> gaps = as_received;
+    for (size_t i = 0; i < gaps.size(); ++i)
+      if (i % 7 == 3 || i >= gaps.size() * 3 / 4)
+        gaps[i] = PRICE_MISSING;
+    gaps[received.slots_per_hour() * 5] = price_from_cents(300);
+
+    bool same = true;
+    for (int pass = 0; pass < 2; ++pass) {
+      const price_t* begin = pass ? gaps.data() : as_received.data();
+      const price_t* end = begin + received.size();
+      std::vector<float> payload;
+      for (const price_t* p = begin; p != end; ++p)
+        payload.push_back(price_to_cents(*p));
+      const std::string packed_payload = pack_prices(begin, end);
+
+      // forget the stored prices, so that neither is dropped
+      id(price_store).clear();
+      id(prices_start_date) = ESPTime::from_epoch_utc(0);
+      const size_t heap = set_prices_peak_heap(
+        payload, received.slot_minutes(), received_start);
+      const std::vector<price_t> stored = stored_prices(id(price_store));
+      id(price_store).clear();
+      id(prices_start_date) = ESPTime::from_epoch_utc(0);
+      const size_t packed_heap = set_prices_packed_peak_heap(
+        packed_payload, received.slot_minutes(), received_start.timestamp);
+      same = same && stored_prices(id(price_store)) == stored;
+
+      if (pass == 0) {
+        printf("set_prices:      %zu prices, peak heap %zu bytes\n",
+               payload.size(), heap);
+        printf("packed:          %zu bytes, peak heap %zu bytes\n",
+               packed_payload.size(), packed_heap);
+      }
+    }
+    printf("packed stored:   %s\n", same ? "same" : "DIFFERENT");
+
+    id(price_store) = received;
+    id(prices_start_date) = received_start;
+    price_index.build(received);
+    update_cheapest_window();
+    if (!same)
+      return 1;
+  }
+
+  if (rollover && !no_data) {
+    PriceStore& store = id(price_store);
+    const PriceStore before = store;
+    const time_t time = id(homeassistant_time).now().timestamp;
+    const ESPTime day_after = ESPTime::from_epoch_local(time + 2 * 86400);
+    const int day_slots = store.slots_per_day();
+    const int32_t first = store.slot_at(id(prices_start_date).timestamp);
+    std::vector<float> payload;
+    for (int i = 0; i < day_slots; ++i)
+      payload.push_back(5.0f + i % 7);
+
+    id(homeassistant_time).set_epoch_time(time + 86400);
+    const auto start = std::chrono::steady_clock::now();
+    receive_prices(payload, store.slot_minutes(), day_after.year,
+                   day_after.month, day_after.day_of_month);
+    const double us = std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - start).count();
+
+    // first day expired, second kept, third added
+    int expired = 0, kept = 0, added = 0;
+    for (int i = 0; i < day_slots; ++i) {
+      expired += store.at(first + i) == PRICE_MISSING;
+      kept += store.at(first + day_slots + i) ==
+        before.at(first + day_slots + i);
+      added += store.at(first + 2 * day_slots + i) ==
+        price_from_cents(payload[i]);
+    }
+    update_display();
+    finish_refresh();
+    printf("day rollover:    %d/%d slots expired, %d/%d kept,"
+           " %d/%d added (%.1f us)\n",
+           expired, day_slots, kept, day_slots, added, day_slots, us);
+    if (expired != day_slots || kept != day_slots || added != day_slots)
+      return 1;
+  }
+
+  if (output && !display.write_ppm(output)) {
+    perror(output);
+    return 1;
+  }
+  return 0;
+}
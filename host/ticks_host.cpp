@@ -0,0 +1,122 @@
+// Checks pleasing_ticks() and TickLabels in ticks.h against the
+// original floating point, std::vector and std::to_string based
+// implementation for every max value from 0 to 100000, and compares
+// their speed.
+//
+// usage: ticks_host [-n ROUNDS]
+// Exits with status 1 if any result differs.
+
+#include <esphome.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "ticks.h"
+
+
+// pleasing_ticks() as it was before the fixed-capacity version
+static std::vector<int> reference_ticks(int max_val) {
+  if (max_val <= 1)
+    return {1};
+
+  float order_of_magnitude = std::floor(std::log10((float)max_val));
+  int first_digit = std::ceil(max_val / std::pow(10, order_of_magnitude));
+  int top = first_digit * std::pow(10, order_of_magnitude);
+
+  switch (first_digit) {
+  case 1: case 10:
+  case 5:
+    return {top, (top*4)/5, (top*3)/5, (top*2)/5, top/5};
+  case 2:
+    return {top, top/2};
+  case 3:
+  case 6:
+    return {top, (top*2)/3, top/3};
+  case 4:
+  case 8:
+    return {top, (top*3)/4, top/2, top/4};
+  case 7:
+    return {top, (top*5)/7};
+  case 9:
+    return {top, (top*5)/9};
+  default:
+    return {top};
+  }
+}
+
+static const int MAX_CHECKED = 100000;
+
+static int check() {
+  int failures = 0;
+  for (int max_val = 0; max_val <= MAX_CHECKED; ++max_val) {
+    const std::vector<int> expected = reference_ticks(max_val);
+    const Ticks ticks = pleasing_ticks(max_val);
+    const TickLabels labels(ticks);
+
+    bool ok = ticks.size() == int(expected.size());
+    for (int i = 0; ok && i < ticks.size(); ++i)
+      ok = ticks[i] == expected[i] &&
+        std::to_string(expected[i]) == labels[i];
+
+    if (!ok && ++failures <= 10) {
+      printf("mismatch at max_val = %d: expected", max_val);
+      for (int v : expected)
+        printf(" %d", v);
+      printf(", got");
+      for (int i = 0; i < ticks.size(); ++i)
+        printf(" %d (\"%s\")", ticks[i], labels[i]);
+      printf("\n");
+    }
+  }
+  printf("checked max values 0...%d: %d mismatches\n",
+         MAX_CHECKED, failures);
+  return failures;
+}
+
+template<typename F> static double time_per_call(int rounds, F f) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round)
+    for (int max_val = 0; max_val <= MAX_CHECKED; ++max_val)
+      f(max_val);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+    (double(rounds) * (MAX_CHECKED + 1));
+}
+
+int main(int argc, char** argv) {
+  int rounds = 10;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "n:")) != -1) {
+    switch (opt) {
+    case 'n': rounds = std::atoi(optarg); break;
+    default:
+      fprintf(stderr, "usage: %s [-n ROUNDS]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (check() != 0)
+    return 1;
+
+  // ticks and labels, as used by draw()
+  volatile size_t sink = 0;
+  double reference_ns = time_per_call(rounds, [&](int max_val) {
+    for (int tick : reference_ticks(max_val))
+      sink = sink + std::to_string(tick).size();
+  });
+  double fixed_ns = time_per_call(rounds, [&](int max_val) {
+    const Ticks ticks = pleasing_ticks(max_val);
+    const TickLabels labels(ticks);
+    for (int i = 0; i < ticks.size(); ++i)
+      sink = sink + strlen(labels[i]);
+  });
+  printf("vector + to_string:    %.1f ns per call\n", reference_ns);
+  printf("Ticks + TickLabels:    %.1f ns per call\n", fixed_ns);
+  return 0;
+}
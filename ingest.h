@@ -0,0 +1,281 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <string>
+#include <vector>
+
+#include <esphome.h>
+
+#include "graphday.h"
+#include "price.h"
+#include "prices.h"
+#include "priceindex.h"
+#include "persist.h"
+#include "cheapest.h"
+#include "scheduler.h"
+
+
+// Prices received with the set_prices and set_prices_packed services.
+// They are added to price_store by slot, replacing stored prices of
+// the same slots.
+//
+// The Home Assistant automation sends all prices whenever tomorrow's
+// prices change and whenever the device reconnects, so on flaky WiFi
+// the same prices arrive over and over. Each payload is compared, as
+// it would be stored, with the prices already stored in its slots,
+// and if they match, it is dropped without touching the store, flash
+// or display.
+
+// counter, exposed as a diagnostic sensor
+uint32_t set_prices_dropped = 0;
+
+
+// Compares received prices, one at a time as they would be stored,
+// with the stored prices of the same slots
+class StoredPricesComparison {
+  const PriceStore& store_;
+  int32_t slot_;
+  bool same_;
+
+public:
+  StoredPricesComparison(int slot_minutes, int32_t first_slot)
+    : store_(id(price_store)), slot_(first_slot),
+      same_(id(prices_start_date).is_valid() &&
+            store_.slot_minutes() == slot_minutes) {}
+
+  void add(price_t price) {
+    same_ = same_ && store_.at(slot_) == price;
+    ++slot_;
+  }
+
+  bool same() const { return same_; }
+};
+
+// Number of slots of a payload that fit in price_store
+inline int received_slots(int count, int slot_minutes) {
+  return std::min(count, PriceStore::DAYS * 24 * 60 / slot_minutes);
+}
+
+// True if prices in cents, once stored, would be the same as the
+// stored ones
+inline bool received_prices_unchanged(
+  const std::vector<float>& prices, int slot_minutes, int32_t first)
+{
+  StoredPricesComparison comparison(slot_minutes, first);
+  const int count = received_slots(prices.size(), slot_minutes);
+  for (int i = 0; i < count && comparison.same(); ++i)
+    comparison.add(price_from_cents(prices[i]));
+  return comparison.same();
+}
+
+
+// Slot length to use for slot_minutes received from Home Assistant
+inline int received_slot_minutes(int slot_minutes) {
+  if (!PriceStore::supports_slot_minutes(slot_minutes)) {
+    ESP_LOGE("prices", "Unsupported slot length: %d min", slot_minutes);
+    ESP_LOGW("set_prices", "Assuming hourly prices.");
+    return 60;
+  }
+  return slot_minutes;
+}
+
+// True (and counted) if a payload is unchanged, i.e. the same as the
+// stored prices
+inline bool drop_unchanged_prices(bool unchanged) {
+  if (!unchanged)
+    return false;
+  ++set_prices_dropped;
+  ESP_LOGI("set_prices", "Prices unchanged. Dropped (%u so far).",
+           (unsigned) set_prices_dropped);
+  return true;
+}
+
+// Set prices_start_date to start (midnight of the day of the first
+// received price), and update everything that depends on price_store.
+// If the first received prices were older than the store's window and
+// ignored, the date is that of the oldest stored slot instead, so it
+// never moves back to prices that aren't there.
+inline void prices_stored(const ESPTime& start) {
+  const PriceStore& store = id(price_store);
+  const ESPTime oldest =
+    ESPTime::from_epoch_local(store.slot_start(store.first_slot()));
+  if (oldest.timestamp > start.timestamp)
+    id(prices_start_date) =
+      local_midnight(oldest.year, oldest.month, oldest.day_of_month);
+  else
+    id(prices_start_date) = start;
+  save_prices();
+  price_index.build(id(price_store));
+  update_cheapest_window();
+  // (deferred to time synchronization if clock not yet set)
+  request_display_update(UPDATE_DATA);
+}
+
+
+inline void log_received_prices(const std::vector<float>& prices,
+                                int slot_minutes)
+{
+  ESP_LOGI("set_prices", "New prices received: %u items, %d min",
+           (unsigned) prices.size(), slot_minutes);
+  ESP_LOGV(
+    "set_prices", "Received prices: %s",
+    [&]() {
+      std::string str;
+      for (float price : prices) {
+        str += ", ";
+        str += std::to_string(price);
+      }
+      return str;
+    }().c_str() + 2);
+}
+
+// Store prices in cents, starting at midnight of the given date, and
+// update everything that depends on them. Returns false if they were
+// dropped as identical to the stored ones.
+inline bool receive_prices(const std::vector<float>& prices,
+                           int slot_minutes,
+                           int start_year, int start_month, int start_day)
+{
+  slot_minutes = received_slot_minutes(slot_minutes);
+  const ESPTime start = local_midnight(start_year, start_month, start_day);
+  const int32_t first = PriceStore::slot_number(start.timestamp, slot_minutes);
+
+  if (drop_unchanged_prices(
+        received_prices_unchanged(prices, slot_minutes, first)))
+    return false;
+
+  id(price_store).assign(first, prices, slot_minutes);
+  prices_stored(start);
+  return true;
+}
+
+
+// Prices of the set_prices_packed service, as hex digits (API strings
+// must be UTF-8, and Home Assistant templates can format hex). Each
+// slot is the change from the previous price (0 before the first) in
+// tenths of a cent, as a two's complement byte: "00"..."7f",
+// "81"..."ff". If the change doesn't fit, the slot is "80" followed
+// by the price as a two's complement 16-bit word, where "8000" is a
+// missing price. Missing prices don't change the previous price.
+//
+// With 15 minute slots, a day of prices takes ~200 bytes instead of
+// the 400 bytes of float[] (plus the copies the API makes of it), and
+// it is decoded straight into price_store.
+class PackedPrices {
+  const char* pos_;
+  const char* end_;
+  price_t previous_ = 0;
+  bool error_ = false;
+
+  static int hex_digit(char c) {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+    if (c >= 'a' && c <= 'f')
+      return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+      return c - 'A' + 10;
+    return -1;
+  }
+
+  bool read_hex(int digits, int& value) {
+    if (end_ - pos_ < digits) {
+      error_ = true;
+      return false;
+    }
+    value = 0;
+    for (int i = 0; i < digits; ++i) {
+      const int digit = hex_digit(*pos_++);
+      if (digit < 0) {
+        error_ = true;
+        return false;
+      }
+      value = value << 4 | digit;
+    }
+    return true;
+  }
+
+public:
+  explicit PackedPrices(const std::string& packed)
+    : pos_(packed.data()), end_(packed.data() + packed.size()) {}
+
+  // Decode the next price. Returns false at the end, or if the rest
+  // is malformed (then error() is true).
+  bool next(price_t& price) {
+    int byte;
+    if (pos_ == end_ || !read_hex(2, byte))
+      return false;
+    if (byte == 0x80) {
+      int word;
+      if (!read_hex(4, word))
+        return false;
+      price = price_t(uint16_t(word));
+    }
+    else {
+      price = price_t(std::max(std::min(previous_ + int8_t(byte),
+                                        int(PRICE_MAX)),
+                               int(PRICE_MIN)));
+    }
+    if (price != PRICE_MISSING)
+      previous_ = price;
+    return true;
+  }
+
+  bool error() const { return error_; }
+};
+
+// Call f(i, price) for each of the first max_count packed prices.
+// Returns the number of them, or -1 if packed is malformed. more is
+// set if there are more.
+template<typename F>
+int for_each_packed_price(const std::string& packed, int max_count,
+                          bool& more, F f)
+{
+  PackedPrices decoder(packed);
+  int count = 0;
+  price_t price;
+  for (; count < max_count && decoder.next(price); ++count)
+    f(count, price);
+  more = count == max_count && decoder.next(price);
+  return decoder.error() ? -1 : count;
+}
+
+// Store packed prices (see PackedPrices) of slots from start_time
+// (Unix time) on, and update everything that depends on them. Returns
+// false if they were dropped as identical to the stored ones or
+// malformed.
+inline bool receive_packed_prices(const std::string& packed, int start_time,
+                                  int slot_minutes)
+{
+  slot_minutes = received_slot_minutes(slot_minutes);
+  const int32_t first = PriceStore::slot_number(start_time, slot_minutes);
+  const int max_count = received_slots(INT_MAX, slot_minutes);
+
+  // decoded twice: once to compare, once to store
+  StoredPricesComparison comparison(slot_minutes, first);
+  bool more;
+  const int count = for_each_packed_price(
+    packed, max_count, more, [&](int, price_t price) {
+      comparison.add(price);
+    });
+  if (count < 0) {
+    ESP_LOGE("set_prices", "Malformed packed prices. Ignored.");
+    return false;
+  }
+  if (more)
+    ESP_LOGW("prices", "More than %d items received. Discarding rest.",
+             max_count);
+  if (drop_unchanged_prices(comparison.same()))
+    return false;
+
+  PriceStore& store = id(price_store);
+  if (store.slot_minutes() != slot_minutes)
+    store.clear(slot_minutes);
+  for_each_packed_price(packed, max_count, more, [&](int i, price_t price) {
+    store.set(first + i, price);
+  });
+
+  const ESPTime start = ESPTime::from_epoch_local(start_time);
+  prices_stored(local_midnight(start.year, start.month, start.day_of_month));
+  return true;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+
+// Screen layout of draw(), resolved at compile time.
+//
+// Parameters are the screen size after rotation, the number of hours
+// in the graph, and the horizontal space per hour (bar width + 1 px
+// gap for hourly prices; sub-hour prices use all of it). Everything
+// that doesn't depend on fonts is derived from them. ROTATION is the
+// rotation of the display in the yaml file; with 90°, bars are drawn
+// directly in the panel's memory order (see NativeBars).
+template<int SCREEN_WIDTH_, int SCREEN_HEIGHT_, int HOURS_, int BAR_WIDTH_,
+         int ROTATION_ = 0>
+struct GraphLayout {
+  static constexpr int ROTATION = ROTATION_;
+  static constexpr int SCREEN_WIDTH = SCREEN_WIDTH_;
+  static constexpr int SCREEN_HEIGHT = SCREEN_HEIGHT_;
+  static constexpr int HOURS = HOURS_;
+  static constexpr int BAR_WIDTH = BAR_WIDTH_;
+  // rows of the panel's memory (the screen before rotation)
+  static constexpr int NATIVE_HEIGHT =
+    ROTATION == 90 || ROTATION == 270 ? SCREEN_WIDTH : SCREEN_HEIGHT;
+
+  static constexpr int GRAPH_MARGIN_TOP = 6;  // space for topmost axis label
+  // space for x-axis ticks and labels
+  static constexpr int GRAPH_MIN_MARGIN_BOTTOM = 22;
+
+  // This should be divisible by as many of 2, 3, 4, and 5 as
+  // possible (and also 7 and 9 as a secondary objective). Use the
+  // available height rounded down to a multiple of 10 (100 on the
+  // 2.9" display).
+  static constexpr int GRAPH_YGRID_HEIGHT =
+    (SCREEN_HEIGHT - GRAPH_MARGIN_TOP - GRAPH_MIN_MARGIN_BOTTOM) / 10 * 10;
+
+  static constexpr int HOUR_INDICATOR_HEIGHT = 4;
+
+  static constexpr int CUR_PRICE_TOP = 3;
+  static constexpr int CUR_PRICE_WIDTH = 48;
+
+  static constexpr int GRAPH_WIDTH = HOURS * BAR_WIDTH;
+  static constexpr int GRAPH_HEIGHT = GRAPH_YGRID_HEIGHT + GRAPH_MARGIN_TOP;
+  static constexpr int GRAPH_LEFT =
+    CUR_PRICE_WIDTH + (SCREEN_WIDTH - CUR_PRICE_WIDTH - GRAPH_WIDTH)/2;
+  static constexpr int GRAPH_MARGIN_BOTTOM = SCREEN_HEIGHT - GRAPH_HEIGHT;
+
+  static_assert(GRAPH_WIDTH <= SCREEN_WIDTH - CUR_PRICE_WIDTH,
+                "graph doesn't fit on screen");
+  static_assert(GRAPH_YGRID_HEIGHT > 0, "screen too low");
+  // with sub-hour prices, all BAR_WIDTH columns are used
+  static_assert(BAR_WIDTH >= 2 && BAR_WIDTH <= 32,
+                "BlackRedBars supports up to 32 columns per hour");
+};
+
+
+// WeAct / Waveshare 2.9" (296x128), rotated to landscape
+typedef GraphLayout<296, 128, 48, 4, 90> Layout2in9;
+// Waveshare 4.2" (400x300)
+typedef GraphLayout<400, 300, 48, 6> Layout4in2;
+// Waveshare 7.5" (800x480)
+typedef GraphLayout<800, 480, 48, 14> Layout7in5;
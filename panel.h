@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include <esphome.h>
+
+#include "epaperaccess.h"
+
+
+// Non-blocking refresh of the 3-colour panel.
+//
+// WaveshareEPaper::display() sends the frame and then waits on the
+// BUSY pin for the whole ~15 s refresh, which stalls the main loop:
+// API, OTA and WiFi keepalives queue up, and Home Assistant may mark
+// the device unavailable. PanelRefresh does the same in steps from
+// poll(): the frame is sent in chunks, the refresh is started, and
+// BUSY is checked on later polls.
+//
+// The commands are those of the SSD1680 controller of the WeAct 2.9"
+// panel, in the order of the driver's display(): the panel is put to
+// deep sleep after each refresh, so it's woken with a hardware reset
+// and initialized again, the RAM address counters are set to the
+// start of the window, and the frame buffer planes are sent as they
+// are.
+
+const uint8_t SSD1680_DRIVER_OUTPUT_CONTROL = 0x01;
+const uint8_t SSD1680_DEEP_SLEEP_MODE = 0x10;
+const uint8_t SSD1680_DATA_ENTRY_MODE = 0x11;
+const uint8_t SSD1680_SW_RESET = 0x12;
+const uint8_t SSD1680_TEMPERATURE_SENSOR = 0x18;
+const uint8_t SSD1680_MASTER_ACTIVATION = 0x20;
+const uint8_t SSD1680_DISPLAY_UPDATE_CONTROL_1 = 0x21;
+const uint8_t SSD1680_DISPLAY_UPDATE_CONTROL_2 = 0x22;
+const uint8_t SSD1680_WRITE_RAM_BW = 0x24;
+const uint8_t SSD1680_WRITE_RAM_RED = 0x26;
+const uint8_t SSD1680_BORDER_WAVEFORM = 0x3C;
+const uint8_t SSD1680_RAM_X_WINDOW = 0x44;
+const uint8_t SSD1680_RAM_Y_WINDOW = 0x45;
+const uint8_t SSD1680_RAM_X_COUNTER = 0x4E;
+const uint8_t SSD1680_RAM_Y_COUNTER = 0x4F;
+
+// bytes sent per poll, ~1 ms at 4 MHz SPI
+const uint32_t PANEL_CHUNK_BYTES = 512;
+// give up waiting for BUSY after this, like the driver
+const uint32_t PANEL_BUSY_TIMEOUT_MS = 30000;
+// after releasing reset, before the controller takes commands
+const uint32_t PANEL_RESET_RECOVERY_MS = 20;
+
+
+// Displays that PanelRefresh knows how to drive
+template<typename D>
+struct supports_async_refresh : std::false_type {};
+template<>
+struct supports_async_refresh<
+  esphome::waveshare_epaper::WaveshareEPaper2P9InBV4> : std::true_type {};
+
+
+class PanelRefresh {
+public:
+  enum State : uint8_t {
+    IDLE,
+    RESETTING,   // holding reset to wake the panel from deep sleep
+    WAKING,      // waiting for the panel after reset
+    SW_RESETTING,  // waiting for the panel after software reset
+    SEND_BLACK,  // sending black plane
+    SEND_RED,    // sending red plane
+    REFRESHING,  // waiting for BUSY to go low
+  };
+
+  // Result of poll()
+  enum Result : uint8_t {
+    PENDING,    // no refresh, or not finished yet
+    DONE,       // the refresh finished during this call
+    TIMED_OUT,  // BUSY stayed high; the refresh was given up
+  };
+
+  State get_state() const { return state_; }
+  bool is_idle() const { return state_ == IDLE; }
+
+  // durations of the last refresh, ms: wake-up and frame transfer,
+  // and the refresh itself
+  uint32_t transfer_ms = 0;
+  uint32_t busy_ms = 0;
+
+  // Start sending the frame buffer of display. The buffer must not be
+  // drawn to until is_idle().
+  void start(esphome::waveshare_epaper::WaveshareEPaper& display,
+             uint32_t now = esphome::millis())
+  {
+    display_ = &display;
+    pos_ = 0;
+    started_ms_ = now;
+    state_since_ms_ = now;
+    EPaperAccess::set_reset(display, true);
+    state_ = RESETTING;
+  }
+
+  // Take the next step. Returns DONE or TIMED_OUT when the refresh
+  // ends during this call.
+  Result poll(uint32_t now = esphome::millis()) {
+    switch (state_) {
+    case IDLE:
+      return PENDING;
+
+    case RESETTING:
+      if (now - state_since_ms_ < EPaperAccess::reset_duration(*display_))
+        return PENDING;
+      EPaperAccess::set_reset(*display_, false);
+      enter(WAKING, now);
+      return PENDING;
+
+    case WAKING:
+      if (now - state_since_ms_ < PANEL_RESET_RECOVERY_MS)
+        return PENDING;
+      if (busy())
+        return busy_timeout(now);
+      display_->command(SSD1680_SW_RESET);
+      enter(SW_RESETTING, now);
+      return PENDING;
+
+    case SW_RESETTING:
+      if (busy())
+        return busy_timeout(now);
+      initialize();
+      set_ram_counters();
+      display_->command(SSD1680_WRITE_RAM_BW);
+      enter(SEND_BLACK, now);
+      return PENDING;
+
+    case SEND_BLACK:
+    case SEND_RED: {
+      const uint32_t half = EPaperAccess::buffer_length(*display_) / 2u;
+      const uint8_t* plane =
+        EPaperAccess::buffer(*display_) + (state_ == SEND_RED ? half : 0);
+      const uint32_t n = std::min(PANEL_CHUNK_BYTES, half - pos_);
+      EPaperAccess::write_data(*display_, plane + pos_, n);
+      pos_ += n;
+      if (pos_ < half)
+        return PENDING;
+
+      pos_ = 0;
+      if (state_ == SEND_BLACK) {
+        set_ram_counters();
+        display_->command(SSD1680_WRITE_RAM_RED);
+        state_ = SEND_RED;
+      }
+      else {
+        display_->command(SSD1680_DISPLAY_UPDATE_CONTROL_2);
+        display_->data(0xF7);
+        display_->command(SSD1680_MASTER_ACTIVATION);
+        transfer_ms = now - started_ms_;
+        enter(REFRESHING, now);
+      }
+      return PENDING;
+    }
+
+    case REFRESHING:
+      busy_ms = now - state_since_ms_;
+      if (busy())
+        return busy_timeout(now);
+      ESP_LOGD("panel", "Refreshed: transfer %u ms, busy %u ms.",
+               (unsigned) transfer_ms, (unsigned) busy_ms);
+      display_->command(SSD1680_DEEP_SLEEP_MODE);
+      display_->data(0x01);
+      state_ = IDLE;
+      return DONE;
+    }
+    return PENDING;
+  }
+
+private:
+  void enter(State state, uint32_t now) {
+    state_ = state;
+    state_since_ms_ = now;
+  }
+
+  bool busy() const { return EPaperAccess::busy(*display_); }
+
+  // While BUSY is high: PENDING, or TIMED_OUT once it has been high
+  // for too long, giving up the refresh (IDLE)
+  Result busy_timeout(uint32_t now) {
+    if (now - state_since_ms_ < PANEL_BUSY_TIMEOUT_MS)
+      return PENDING;
+    ESP_LOGE("panel", "Timeout while displaying image!");
+    state_ = IDLE;
+    return TIMED_OUT;
+  }
+
+  // The driver's initialize() after the software reset: gates, RAM
+  // window of the whole panel with X (bytes) first, border, and the
+  // built-in temperature sensor
+  void initialize() {
+    const int width = EPaperAccess::width_internal(*display_);
+    const int height = EPaperAccess::height_internal(*display_);
+    display_->command(SSD1680_DRIVER_OUTPUT_CONTROL);
+    display_->data((height - 1) % 256);
+    display_->data((height - 1) / 256);
+    display_->data(0x00);
+    display_->command(SSD1680_DATA_ENTRY_MODE);
+    display_->data(0x03);  // X and Y increment, X first
+    display_->command(SSD1680_RAM_X_WINDOW);
+    display_->data(0x00);
+    display_->data(width / 8 - 1);
+    display_->command(SSD1680_RAM_Y_WINDOW);
+    display_->data(0x00);
+    display_->data(0x00);
+    display_->data((height - 1) % 256);
+    display_->data((height - 1) / 256);
+    display_->command(SSD1680_BORDER_WAVEFORM);
+    display_->data(0x05);
+    display_->command(SSD1680_DISPLAY_UPDATE_CONTROL_1);
+    display_->data(0x00);
+    display_->data(0x80);
+    display_->command(SSD1680_TEMPERATURE_SENSOR);
+    display_->data(0x80);
+  }
+
+  // Address the start of the RAM window
+  void set_ram_counters() {
+    display_->command(SSD1680_RAM_X_COUNTER);
+    display_->data(0x00);
+    display_->command(SSD1680_RAM_Y_COUNTER);
+    display_->data(0x00);
+    display_->data(0x00);
+  }
+
+  esphome::waveshare_epaper::WaveshareEPaper* display_ = nullptr;
+  State state_ = IDLE;
+  uint32_t pos_ = 0;  // bytes of current plane sent
+  uint32_t started_ms_ = 0;
+  uint32_t state_since_ms_ = 0;
+};
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include <esphome.h>
+
+#include "price.h"
+#include "prices.h"
+
+
+// Received prices are saved to flash, so that after a reboot the
+// display can be redrawn as soon as the clock is set, instead of
+// waiting for Home Assistant to send the prices again.
+//
+// The record is fixed size (preferences can't grow), and kept compact:
+// fixed point prices and a packed date. ESP8266 keeps all preferences
+// saved to flash in PREFERENCES_FLASH_WORDS words, each taking a word
+// more than its size. Besides the prices, those are the restore_value
+// numbers and switches (2 words each) and the WiFi settings saved by
+// the captive portal (26 words). So on ESP8266, prices are saved in
+// hourly slots by default: shorter slots are saved as the mean of each
+// hour, and shown so after a reboot until Home Assistant sends the
+// prices again. The record then takes 108 bytes (28 words); with 15
+// minute slots it would take 396 bytes (100 words), more than fits
+// next to everything else.
+
+#ifndef PRICES_SAVE_SLOT_MINUTES
+#ifdef USE_ESP8266
+#define PRICES_SAVE_SLOT_MINUTES 60
+#else
+#define PRICES_SAVE_SLOT_MINUTES PRICES_MIN_SLOT_MINUTES
+#endif
+#endif
+
+const int PRICES_SAVE_MIN_SLOT_MINUTES =
+  PRICES_SAVE_SLOT_MINUTES > PRICES_MIN_SLOT_MINUTES
+  ? PRICES_SAVE_SLOT_MINUTES : PRICES_MIN_SLOT_MINUTES;
+static_assert(PriceStore::supports_slot_minutes(PRICES_SAVE_MIN_SLOT_MINUTES),
+              "unsupported PRICES_SAVE_SLOT_MINUTES");
+
+const int PREFERENCES_FLASH_WORDS = 128;  // ESP8266
+// share of them for the prices
+const int PRICES_RECORD_MAX_WORDS = PREFERENCES_FLASH_WORDS / 2;
+
+struct PricesRecord {
+  static constexpr int SLOTS =
+    PriceStore::DAYS * 24 * 60 / PRICES_SAVE_MIN_SLOT_MINUTES;
+
+  uint16_t crc;  // CRC-16 of everything after this field
+  uint16_t start_year;
+  uint8_t start_month;
+  uint8_t start_day;
+  uint8_t slot_minutes;
+  uint8_t reserved;
+  int32_t first_slot;  // PriceStore::first_slot()
+  price_t prices[SLOTS];  // from first_slot on
+
+  uint16_t calc_crc() const {
+    return esphome::crc16(
+      reinterpret_cast<const uint8_t*>(this) + sizeof(crc),
+      sizeof(*this) - sizeof(crc));
+  }
+};
+
+#ifdef USE_ESP8266
+static_assert((sizeof(PricesRecord) + 3) / 4 + 1 <= PRICES_RECORD_MAX_WORDS,
+              "saved prices take too much of the flash preferences;"
+              " increase PRICES_SAVE_SLOT_MINUTES");
+#endif
+
+// preference key; change if PricesRecord changes
+const uint32_t PRICES_RECORD_KEY = 0x50524332 ^ PricesRecord::SLOTS;
+
+// CRC of the record in flash, to avoid rewriting identical data
+uint16_t saved_prices_crc = 0;
+bool have_saved_prices = false;
+
+
+inline ESPPreferenceObject& get_prices_pref() {
+  static ESPPreferenceObject pref =
+    global_preferences->make_preference<PricesRecord>(
+      PRICES_RECORD_KEY, true);  // in flash, survives power loss
+  return pref;
+}
+
+
+// Save price_store and prices_start_date, if they differ from what
+// is already saved, in slots of at least PRICES_SAVE_SLOT_MINUTES.
+// (ESPHome writes preferences to flash in batches, see
+// flash_write_interval.)
+inline void save_prices() {
+  const PriceStore& store = id(price_store);
+  const ESPTime& start = id(prices_start_date);
+
+  PricesRecord record;
+  memset(&record, 0, sizeof(record));
+  record.start_year = start.year;
+  record.start_month = start.month;
+  record.start_day = start.day_of_month;
+  const int slot_minutes =
+    std::max(store.slot_minutes(), PRICES_SAVE_MIN_SLOT_MINUTES);
+  // store slots per saved slot
+  const int factor = slot_minutes / store.slot_minutes();
+  record.slot_minutes = slot_minutes;
+  // (absolute slots are from the epoch, so longer ones contain whole
+  // shorter ones)
+  record.first_slot = store.first_slot() / factor;
+  const int slots = PriceStore::DAYS * 24 * 60 / slot_minutes;
+  for (int i = 0; i < slots; ++i) {
+    const int32_t first = (record.first_slot + i) * factor;
+    record.prices[i] = aggregate_slots(store, first, first + factor).mean;
+  }
+  record.crc = record.calc_crc();
+
+  if (have_saved_prices && record.crc == saved_prices_crc) {
+    ESP_LOGD("persist", "Prices unchanged. Not saving.");
+    return;
+  }
+
+  if (!get_prices_pref().save(&record)) {
+    ESP_LOGE("persist", "Saving prices failed. Out of preference space?");
+    return;
+  }
+  saved_prices_crc = record.crc;
+  have_saved_prices = true;
+  ESP_LOGD("persist", "Saved %d prices of %d min (%u bytes).",
+           slots, slot_minutes, (unsigned) sizeof(record));
+}
+
+
+// Restore price_store and prices_start_date from flash. Returns false
+// (and leaves them as they are) if nothing valid was saved.
+//
+// This runs before the time component sets the timezone, so the start
+// date's timestamp is that of midnight UTC until
+// localize_prices_start_date() is called.
+inline bool restore_prices() {
+  PricesRecord record;
+  if (!get_prices_pref().load(&record)) {
+    ESP_LOGD("persist", "No saved prices.");
+    return false;
+  }
+  if (record.crc != record.calc_crc()) {
+    ESP_LOGW("persist", "Saved prices are corrupt. Ignoring.");
+    return false;
+  }
+
+  PriceStore& store = id(price_store);
+  if (!store.assign(record.first_slot, record.prices,
+                    PricesRecord::SLOTS, record.slot_minutes))
+  {
+    ESP_LOGW("persist", "Saved prices have unsupported slot length.");
+    return false;
+  }
+
+  ESPTime& start = id(prices_start_date);
+  start.year = record.start_year;
+  start.month = record.start_month;
+  start.day_of_month = record.start_day;
+  start.hour = start.minute = start.second = 0;
+  start.recalc_timestamp_local(false);
+
+  saved_prices_crc = record.crc;
+  have_saved_prices = true;
+  ESP_LOGI("persist", "Restored prices starting at %04u-%02u-%02u.",
+           start.year, start.month, start.day_of_month);
+  return true;
+}
+
+// Recompute the timestamp of prices_start_date from its date, in the
+// timezone that is now set. Call on time sync.
+inline void localize_prices_start_date() {
+  ESPTime& start = id(prices_start_date);
+  if (start.is_valid())
+    start.recalc_timestamp_local(false);
+}
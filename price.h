@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+
+// Prices are stored as fixed point, in tenths of a cent, so that
+// drawing doesn't need floating point arithmetic (ESP8266 has no
+// FPU). The range, ±3276.7 c, is well beyond the Nord Pool price
+// limits.
+typedef int16_t price_t;
+
+const int PRICE_SCALE = 10;  // price_t units per cent
+
+// Missing value. Smaller than any actual price, so that a plain max()
+// ignores it.
+const price_t PRICE_MISSING = INT16_MIN;
+const price_t PRICE_MAX = INT16_MAX;
+const price_t PRICE_MIN = -INT16_MAX;
+
+
+// Convert price in cents. Non-finite values become PRICE_MISSING, and
+// values out of range are clamped.
+inline price_t price_from_cents(float cents) {
+  if (!std::isfinite(cents))
+    return PRICE_MISSING;
+  float scaled = cents * PRICE_SCALE;
+  if (scaled >= PRICE_MAX)
+    return PRICE_MAX;
+  if (scaled <= PRICE_MIN)
+    return PRICE_MIN;
+  return (price_t) std::lround(scaled);
+}
+
+inline float price_to_cents(price_t price) {
+  return price == PRICE_MISSING ? NAN : float(price) / PRICE_SCALE;
+}
+
+// True if price is at least threshold cents. Like comparing floats,
+// it's false if either is missing (NaN), e.g. a number that has no
+// value yet.
+inline bool price_at_least(price_t price, float threshold) {
+  const price_t fixed = price_from_cents(threshold);
+  return price != PRICE_MISSING && fixed != PRICE_MISSING && price >= fixed;
+}
+
+
+// Integer division rounding half away from zero, like std::round().
+// Divisor must be positive.
+inline int div_round(int dividend, int divisor) {
+  return dividend >= 0
+    ? (dividend + divisor/2) / divisor
+    : -((-dividend + divisor/2) / divisor);
+}
+
+// Integer division rounding towards positive infinity, like
+// std::ceil(). Divisor must be positive.
+inline int div_ceil(int dividend, int divisor) {
+  return dividend >= 0
+    ? (dividend + divisor - 1) / divisor
+    : -(-dividend / divisor);
+}
+
+
+// Format price for display: one decimal if |price| < 10 c, otherwise
+// whole cents. Decimal separator is given as argument.
+inline void format_price(char* str, size_t size, price_t price,
+                         char decimal_separator)
+{
+  if (price == PRICE_MISSING) {
+    snprintf(str, size, "?");
+    return;
+  }
+
+  int value = price;
+  const char* sign = "";
+  if (value < 0) {
+    value = -value;
+    sign = "-";
+  }
+
+  if (value < 10 * PRICE_SCALE)
+    snprintf(str, size, "%s%d%c%d", sign,
+             value / PRICE_SCALE, decimal_separator, value % PRICE_SCALE);
+  else
+    snprintf(str, size, "%s%d", sign, div_round(value, PRICE_SCALE));
+}
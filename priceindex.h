@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <string>
+
+#include <esphome.h>
+
+#include "price.h"
+#include "prices.h"
+
+
+// Index over the prices in PriceStore for range queries (the
+// query_prices service, the cheapest window), built whenever prices
+// are received. Slots are PriceStore indexes, relative to its
+// first_slot():
+// - prefix sums and counts of the prices that aren't missing, for the
+//   mean of any range or window in O(1)
+// - a sparse table of minimums and maximums of power of two lengths,
+//   for the min and max of any range in O(1)
+//
+// The sparse table takes 4 * MAX_SLOTS bytes per level above 0, 5.3
+// kB with 15 minute slots and all levels (2.3 kB with
+// -DPRICES_MIN_SLOT_MINUTES=60). PRICE_INDEX_LEVELS caps the levels:
+// ranges longer than the top level are then covered by its blocks one
+// by one, in O(length / 2^(PRICE_INDEX_LEVELS - 1)). On ESP8266 the
+// top level is 16 slots by default, which takes 3 kB with 15 minute
+// slots, and at most 12 blocks per range.
+
+#ifndef PRICE_INDEX_LEVELS
+#ifdef USE_ESP8266
+#define PRICE_INDEX_LEVELS 5
+#else
+#define PRICE_INDEX_LEVELS 32
+#endif
+#endif
+static_assert(PRICE_INDEX_LEVELS >= 2, "PRICE_INDEX_LEVELS must be >= 2");
+
+// Stats of a range of slots. If all are missing, min, max and mean
+// are PRICE_MISSING.
+struct RangeStats {
+  price_t min;
+  price_t max;
+  price_t mean;  // rounded
+  int count;  // slots that aren't missing
+};
+
+// Window of contiguous slots
+struct PriceWindow {
+  int start;  // index to PriceStore, -1 if none
+  int slots;
+  price_t mean;  // rounded
+};
+
+
+constexpr int floor_log2(int n) {
+  return n <= 1 ? 0 : 1 + floor_log2(n / 2);
+}
+
+
+class PriceIndex {
+public:
+  static constexpr int MAX_SLOTS = PriceStore::MAX_SLOTS;
+  // level k covers 2^k slots; level 0 is the prices themselves
+  static constexpr int LEVELS =
+    std::min(floor_log2(MAX_SLOTS) + 1, PRICE_INDEX_LEVELS);
+
+  int size() const { return size_; }
+  // incremented by each build(), to invalidate what is derived from
+  // the prices
+  uint32_t build_count() const { return builds_; }
+
+  void build(const PriceStore& prices) {
+    prices_ = &prices;
+    size_ = prices.size();
+
+    sums_[0] = 0;
+    counts_[0] = 0;
+    for (int i = 0; i < size_; ++i) {
+      const price_t price = prices[i];
+      const bool missing = price == PRICE_MISSING;
+      sums_[i + 1] = sums_[i] + (missing ? 0 : price);
+      counts_[i + 1] = counts_[i] + (missing ? 0 : 1);
+    }
+
+    // missing values are PRICE_MISSING, which max() ignores, and
+    // PRICE_MAX for min()
+    for (int level = 1; level < LEVELS; ++level) {
+      const int half = 1 << (level - 1);
+      for (int i = 0; i + (1 << level) <= size_; ++i) {
+        mins_[level - 1][i] =
+          std::min(min_at(level - 1, i), min_at(level - 1, i + half));
+        maxs_[level - 1][i] =
+          std::max(max_at(level - 1, i), max_at(level - 1, i + half));
+      }
+    }
+    ++builds_;
+  }
+
+  // Stats of slots [begin, end), clipped to the prices.
+  RangeStats range(int begin, int end) const {
+    begin = std::max(begin, 0);
+    end = std::min(end, size_);
+    const int count = end > begin ? counts_[end] - counts_[begin] : 0;
+    if (count == 0)
+      return {PRICE_MISSING, PRICE_MISSING, PRICE_MISSING, 0};
+
+    // Power of two blocks from begin on, the last one ending at end,
+    // cover [begin, end). Unless the levels are capped, that's two
+    // (overlapping) blocks.
+    const int level = std::min(floor_log2_fast(end - begin), LEVELS - 1);
+    const int last = end - (1 << level);
+    price_t min = PRICE_MAX, max = PRICE_MISSING;
+    for (int i = begin; ; i += 1 << level) {
+      const int block = std::min(i, last);
+      min = std::min(min, min_at(level, block));
+      max = std::max(max, max_at(level, block));
+      if (block == last)
+        break;
+    }
+    return {
+      min,
+      max,
+      price_t(div_round(sums_[end] - sums_[begin], count)),
+      count,
+    };
+  }
+
+  // The window of length slots within [begin, end) with the lowest
+  // mean, skipping windows with missing prices. Of equally cheap
+  // windows, the earliest wins. O(end - begin), each window in O(1).
+  PriceWindow cheapest_window(int begin, int end, int length) const {
+    PriceWindow best = {-1, length, PRICE_MISSING};
+    begin = std::max(begin, 0);
+    end = std::min(end, size_);
+    if (length <= 0)
+      return best;
+
+    int32_t best_sum = 0;
+    for (int i = begin; i + length <= end; ++i) {
+      if (counts_[i + length] - counts_[i] != length)
+        continue;
+      const int32_t sum = sums_[i + length] - sums_[i];
+      if (best.start < 0 || sum < best_sum) {
+        best.start = i;
+        best_sum = sum;
+      }
+    }
+    if (best.start >= 0)
+      best.mean = div_round(best_sum, length);
+    return best;
+  }
+
+private:
+  static int floor_log2_fast(int n) {
+    return 31 - __builtin_clz(unsigned(n));
+  }
+
+  price_t min_at(int level, int i) const {
+    if (level > 0)
+      return mins_[level - 1][i];
+    const price_t price = (*prices_)[i];
+    return price == PRICE_MISSING ? PRICE_MAX : price;
+  }
+
+  price_t max_at(int level, int i) const {
+    return level > 0 ? maxs_[level - 1][i] : (*prices_)[i];
+  }
+
+  const PriceStore* prices_ = nullptr;
+  int size_ = 0;
+  uint32_t builds_ = 0;
+  int32_t sums_[MAX_SLOTS + 1] = {0};
+  uint16_t counts_[MAX_SLOTS + 1] = {0};
+  price_t mins_[LEVELS - 1][MAX_SLOTS];
+  price_t maxs_[LEVELS - 1][MAX_SLOTS];
+};
+
+PriceIndex price_index;
+
+
+// Index to PriceStore of the slot at time t, or INT_MIN if no prices
+inline int price_slot_at(time_t t) {
+  if (!id(prices_start_date).is_valid())
+    return INT_MIN;
+  const PriceStore& prices = id(price_store);
+  return prices.slot_at(t) - prices.first_slot();
+}
+
+
+// Start time of slot (index to PriceStore) in ISO 8601 UTC, or "" if
+// slot < 0
+inline std::string slot_start_iso(int slot) {
+  if (slot < 0)
+    return "";
+  const PriceStore& prices = id(price_store);
+  const time_t start = prices.slot_start(prices.first_slot() + slot);
+  return ESPTime::from_epoch_utc(start).strftime(std::string("%FT%TZ"));
+}
+
+
+// Result of the query_prices service, sent to Home Assistant as an
+// esphome.electricity_price_query event
+struct PriceQuery {
+  RangeStats range;
+  PriceWindow cheapest;
+};
+
+PriceQuery last_price_query = {
+  {PRICE_MISSING, PRICE_MISSING, PRICE_MISSING, 0},
+  {-1, 0, PRICE_MISSING},
+};
+
+// Stats of prices from start_time until end_time (Unix time; 0 = now
+// and end of prices), and the cheapest window of window_minutes
+// within that (rounded up to whole slots; 0 = none).
+inline void query_prices(int start_time, int end_time, int window_minutes) {
+  const int slot_minutes = id(price_store).slot_minutes();
+  int begin = 0, end = price_index.size();
+  if (start_time != 0)
+    begin = price_slot_at(start_time);
+  else if (id(homeassistant_time).now().is_valid())
+    begin = price_slot_at(id(homeassistant_time).now().timestamp);
+  if (end_time != 0)  // slots ending by end_time
+    end = price_slot_at(end_time);
+
+  const int length = window_minutes > 0
+    ? (window_minutes + slot_minutes - 1) / slot_minutes
+    : 0;
+  last_price_query.range = price_index.range(begin, end);
+  last_price_query.cheapest = price_index.cheapest_window(begin, end, length);
+  ESP_LOGD("query", "Slots %d...%d: min/mean/max = %d/%d/%d,"
+           " cheapest %d slots at %d",
+           begin, end, last_price_query.range.min,
+           last_price_query.range.mean, last_price_query.range.max,
+           length, last_price_query.cheapest.start);
+}
+
+// Price in cents for event data, or "" if missing
+inline std::string price_cents_string(price_t price) {
+  if (price == PRICE_MISSING)
+    return "";
+  char str[16];
+  snprintf(str, sizeof(str), "%.1f", price_to_cents(price));
+  return str;
+}
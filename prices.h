@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+#include <esphome.h>
+
+#include "price.h"
+
+
+// Shortest supported price slot. Nord Pool day-ahead prices have 15
+// minute resolution since October 2025. Can be set as a build option
+// (-DPRICES_MIN_SLOT_MINUTES=60) to save RAM if only hourly prices are
+// used.
+#ifndef PRICES_MIN_SLOT_MINUTES
+#define PRICES_MIN_SLOT_MINUTES 15
+#endif
+
+
+// Prices of the last 2 days' worth of slots of 15, 30 or 60 minutes,
+// in a ring buffer indexed by absolute slot number (Unix time / slot
+// length). Setting a slot beyond the newest one moves the window
+// forward, and the slots that fall out of it (yesterday's, usually)
+// expire. So tomorrow's prices can be added to today's without
+// resending them, and looking up the price at a time is integer
+// arithmetic, without dates.
+//
+// Slots are also indexed relative to the oldest slot in the window,
+// first_slot(): index i is slot first_slot() + i, for 0 <= i < size().
+class PriceStore {
+public:
+  static constexpr int DAYS = 2;
+  static constexpr int MAX_SLOTS = DAYS * 24 * 60 / PRICES_MIN_SLOT_MINUTES;
+
+  static_assert(60 % PRICES_MIN_SLOT_MINUTES == 0,
+                "slot length must divide an hour");
+
+  int slot_minutes() const { return slot_minutes_; }
+  int slots_per_hour() const { return 60 / slot_minutes_; }
+  int slots_per_day() const { return 24 * slots_per_hour(); }
+  int size() const { return DAYS * slots_per_day(); }
+
+  // Absolute slot number of index 0
+  int32_t first_slot() const { return first_; }
+
+  // Absolute number of the slot at Unix time t
+  int32_t slot_at(time_t t) const { return slot_number(t, slot_minutes_); }
+  static int32_t slot_number(time_t t, int slot_minutes) {
+    return int32_t(t / (slot_minutes * 60));
+  }
+  // Unix time of the start of absolute slot
+  time_t slot_start(int32_t slot) const {
+    return time_t(slot) * (slot_minutes_ * 60);
+  }
+
+  // Price at index i, 0 <= i < size()
+  price_t operator[](int i) const {
+    int pos = head_ + i;
+    if (pos >= size())
+      pos -= size();
+    return prices_[pos];
+  }
+
+  // Price of absolute slot, PRICE_MISSING if not in the window
+  price_t at(int32_t slot) const {
+    const int32_t i = slot - first_;
+    return i >= 0 && i < size() ? (*this)[i] : PRICE_MISSING;
+  }
+
+  // Set all slots of given length to PRICE_MISSING.
+  void clear(int slot_minutes = 60) {
+    slot_minutes_ = slot_minutes;
+    first_ = 0;
+    head_ = 0;
+    prices_.fill(PRICE_MISSING);
+  }
+
+  // Set absolute slot. Slots older than the window are ignored. A
+  // slot newer than the window moves the window forward so that it's
+  // the newest slot (unless the price is missing, then it's ignored
+  // too).
+  void set(int32_t slot, price_t price) {
+    if (slot < first_)
+      return;
+    if (slot - first_ >= size()) {
+      if (price == PRICE_MISSING)
+        return;
+      advance(slot - size() + 1);
+    }
+    int pos = head_ + (slot - first_);
+    if (pos >= size())
+      pos -= size();
+    prices_[pos] = price;
+  }
+
+  // Store prices in cents of consecutive slots from absolute slot
+  // first on. Slots of a different length than the stored ones
+  // replace them all. Returns false if slot_minutes is not supported.
+  bool assign(int32_t first, const std::vector<float>& prices,
+              int slot_minutes)
+  {
+    if (!supports_slot_minutes(slot_minutes)) {
+      ESP_LOGE("prices", "Unsupported slot length: %d min", slot_minutes);
+      return false;
+    }
+    if (slot_minutes != slot_minutes_)
+      clear(slot_minutes);
+
+    if (int(prices.size()) > size())
+      ESP_LOGW("prices", "More than %d items received. Discarding rest.",
+               size());
+    const int n = std::min(int(prices.size()), size());
+    for (int i = 0; i < n; ++i)
+      set(first + i, price_from_cents(prices[i]));
+    return true;
+  }
+
+  // Replace contents with n fixed point prices of slots from absolute
+  // slot first on, e.g. saved ones.
+  bool assign(int32_t first, const price_t* prices, int n,
+              int slot_minutes)
+  {
+    if (!supports_slot_minutes(slot_minutes))
+      return false;
+    clear(slot_minutes);
+    first_ = first;
+    std::copy(prices, prices + std::min(n, size()), prices_.begin());
+    return true;
+  }
+
+  static constexpr bool supports_slot_minutes(int slot_minutes) {
+    return slot_minutes >= PRICES_MIN_SLOT_MINUTES &&
+      60 % slot_minutes == 0 &&
+      slot_minutes % PRICES_MIN_SLOT_MINUTES == 0;
+  }
+
+private:
+  // Move the window to start at absolute slot first, expiring the
+  // slots before it. O(1) per expired slot.
+  void advance(int32_t first) {
+    const int32_t expired = std::min(first - first_, int32_t(size()));
+    for (int32_t i = 0; i < expired; ++i) {
+      prices_[head_] = PRICE_MISSING;
+      if (++head_ == size())
+        head_ = 0;
+    }
+    first_ = first;
+  }
+
+  std::array<price_t, MAX_SLOTS> prices_;
+  int32_t first_ = 0;  // absolute slot number of index 0
+  int16_t head_ = 0;  // position of index 0 in prices_
+  uint8_t slot_minutes_ = 60;
+};
+
+
+// Aggregate of the slots shown in one pixel column
+struct ColumnStats {
+  price_t min;
+  price_t max;
+  price_t mean;  // rounded
+};
+
+// Calculate stats of absolute slots [begin, end), skipping missing
+// values. If all are missing, all stats are PRICE_MISSING.
+inline ColumnStats aggregate_slots(const PriceStore& prices,
+                                   int32_t begin, int32_t end)
+{
+  ColumnStats stats = {PRICE_MAX, PRICE_MISSING, PRICE_MISSING};
+  int sum = 0, count = 0;
+  for (int32_t slot = begin; slot != end; ++slot) {
+    const price_t price = prices.at(slot);
+    if (price == PRICE_MISSING)
+      continue;
+    if (price < stats.min)
+      stats.min = price;
+    if (price > stats.max)
+      stats.max = price;
+    sum += price;
+    ++count;
+  }
+  if (count == 0)
+    return {PRICE_MISSING, PRICE_MISSING, PRICE_MISSING};
+  stats.mean = div_round(sum, count);
+  return stats;
+}
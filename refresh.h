@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include <esphome.h>
+
+#include "displaylist.h"
+#include "framebuffer.h"
+#include "layout.h"
+#include "panel.h"
+
+
+// A full refresh of the e-paper display takes about 15 seconds,
+// flashes the screen and draws a lot of current. Updates are
+// requested whenever something that might affect the picture
+// changes, but often nothing visible does (e.g. Home Assistant
+// resending identical prices). So, render the frame first, and only
+// refresh the display if the frame differs from what is shown.
+//
+// To find out what changed, the frame is hashed in bands of
+// FRAME_BAND_ROWS native rows. With rotation 90, native rows are
+// screen columns, so the hourly update dirties just the bands around
+// the previous and current hour and the price text.
+
+const int FRAME_BAND_ROWS = 8;
+// bands of the layout draw() uses
+const int FRAME_BANDS =
+  (Layout2in9::NATIVE_HEIGHT + FRAME_BAND_ROWS - 1) / FRAME_BAND_ROWS;
+
+// counters, exposed as diagnostic sensors
+uint32_t display_refreshes_done = 0;
+uint32_t display_refreshes_skipped = 0;
+// area changed by last refresh (sum of changed bands), percent of
+// screen
+float display_dirty_percent = NAN;
+// time from boot to the first refresh (0 = not yet refreshed)
+uint32_t display_first_refresh_ms = 0;
+// Durations of the last refresh: rendering and hashing the frame, and
+// everything from the start of rendering until the panel is done
+// (0 = not yet measured)
+uint32_t display_render_ms = 0;
+uint32_t display_refresh_ms = 0;
+uint32_t display_update_started_ms = 0;
+// true while the display is being refreshed
+bool display_refresh_in_progress = false;
+
+PanelRefresh panel_refresh;
+// update_display() called during refresh; run it after
+bool display_update_deferred = false;
+bool display_update_deferred_force = false;
+
+// band hashes of the frame currently on the display, the first
+// displayed_bands of them (0 if none)
+std::array<uint32_t, FRAME_BANDS> displayed_band_hashes;
+int displayed_bands = 0;
+// display_list_frames after drawing the frame currently on the display
+uint32_t displayed_list_frames = 0;
+
+
+// Time shown on the display. Normally the current time, but the
+// frame for the next price slot is drawn in advance (see scheduler.h).
+time_t display_time_override = 0;  // 0 = current time
+
+inline ESPTime display_now() {
+  return display_time_override
+    ? ESPTime::from_epoch_local(display_time_override)
+    : id(homeassistant_time).now();
+}
+
+
+// True if the display driver can refresh just a part of the screen,
+// i.e. has display_window(x, y, width, height) in rotated
+// coordinates. waveshare_epaper doesn't, at least for 3-colour
+// panels, which have no partial refresh waveform.
+template<typename D, typename = void>
+struct supports_window_update : std::false_type {};
+template<typename D>
+struct supports_window_update<
+  D, std::void_t<decltype(std::declval<D&>().display_window(0, 0, 0, 0))>>
+  : std::true_type {};
+
+
+// Refresh area of display if supported. Returns false if not.
+template<typename D>
+bool display_window_if_supported(D& display, const FrameBuffer::Rect& area) {
+  if constexpr (supports_window_update<D>::value) {
+    display.display_window(area.x, area.y, area.width, area.height);
+    return true;
+  }
+  else {
+    return false;
+  }
+}
+
+
+inline void on_display_refreshed() {
+  ++display_refreshes_done;
+  display_refresh_ms = millis() - display_update_started_ms;
+  if (display_first_refresh_ms == 0) {
+    display_first_refresh_ms = millis();
+    ESP_LOGI("refresh", "First refresh %u ms after boot.",
+             (unsigned) display_first_refresh_ms);
+  }
+}
+
+
+// Start a non-blocking refresh if supported. Returns false if not.
+template<typename D>
+bool start_refresh_if_supported(D& display) {
+  if constexpr (supports_async_refresh<D>::value) {
+    panel_refresh.start(display);
+    return true;
+  }
+  else {
+    return false;
+  }
+}
+
+
+// Use this instead of id(epaper).update(). If force is true, refresh
+// the whole display even if the frame hasn't changed.
+//
+// Without a clock, the graph can't be drawn. Then the update is
+// deferred to time synchronization if there are prices to show. The
+// "no data" frame doesn't need the clock, and is drawn right away.
+inline void update_display(bool force = false) {
+  if (display_refresh_in_progress) {
+    // the frame buffer is being sent, don't draw over it
+    ESP_LOGD("refresh", "Refresh in progress. Deferring display update.");
+    display_update_deferred = true;
+    display_update_deferred_force |= force;
+    return;
+  }
+
+  if (!id(homeassistant_time).now().is_valid() &&
+      id(prices_start_date).is_valid()) {
+    ESP_LOGD("refresh", "Clock not yet set. Deferring display update.");
+    id(update_on_time_sync) = true;
+    return;
+  }
+
+  auto& display = id(epaper);
+  display_update_started_ms = millis();
+
+  FrameBuffer::render(display);
+  FrameBuffer frame_buffer(display);
+
+  // compare band hashes with displayed frame
+  const int rows = frame_buffer.get_native_height();
+  const int bands = (rows + FRAME_BAND_ROWS - 1) / FRAME_BAND_ROWS;
+  // (a bigger display than the layout's is always refreshed; draw()
+  // doesn't draw on it either)
+  const bool fits = bands <= FRAME_BANDS;
+  const bool have_previous = fits && displayed_bands == bands;
+  // If the frame on the display was the last one drawn, draw()
+  // compared their display lists. When those draw the same, so do the
+  // frames, without hashing.
+  const bool same_list = have_previous &&
+    display_list_frames == displayed_list_frames + 1 &&
+    display_list_changed.width == 0;
+  displayed_list_frames = display_list_frames;
+  displayed_bands = fits ? bands : 0;
+  int dirty_begin = rows, dirty_end = 0;  // native rows, bounding range
+  int dirty_rows = 0;
+  for (int band = 0; band < bands && !same_list; ++band) {
+    const int begin = band * FRAME_BAND_ROWS;
+    const int end = std::min(begin + FRAME_BAND_ROWS, rows);
+    const uint32_t hash = frame_buffer.hash_native_rows(begin, end);
+    if (!have_previous || hash != displayed_band_hashes[band]) {
+      dirty_begin = std::min(dirty_begin, begin);
+      dirty_end = end;
+      dirty_rows += end - begin;
+      if (fits)
+        displayed_band_hashes[band] = hash;
+    }
+  }
+
+  display_render_ms = millis() - display_update_started_ms;
+
+  if (dirty_begin >= dirty_end && !force) {
+    ++display_refreshes_skipped;
+    ESP_LOGD("refresh", "Frame unchanged. Skipping refresh.");
+    return;
+  }
+
+  if (dirty_begin >= dirty_end) {
+    ESP_LOGD("refresh", "Frame unchanged. Forced refresh.");
+    display_dirty_percent = 0;
+  }
+  else {
+    const auto dirty =
+      frame_buffer.native_rows_to_rect(dirty_begin, dirty_end);
+    display_dirty_percent = 100.0f * dirty_rows / rows;
+    ESP_LOGD("refresh",
+             "Changed: %.0f%% of screen, within x=%d y=%d w=%d h=%d",
+             display_dirty_percent,
+             dirty.x, dirty.y, dirty.width, dirty.height);
+
+    if (!force) {
+      display_refresh_in_progress = true;
+      const bool done = display_window_if_supported(display, dirty);
+      display_refresh_in_progress = false;
+      if (done) {
+        on_display_refreshed();
+        return;
+      }
+    }
+  }
+
+  display_refresh_in_progress = true;
+  if (start_refresh_if_supported(display))
+    return;  // finished by poll_display_refresh()
+  display.display();
+  display_refresh_in_progress = false;
+  on_display_refreshed();
+}
+
+
+// Advance a non-blocking refresh started by update_display(). Call
+// this often, from the main loop.
+inline void poll_display_refresh(uint32_t now = millis()) {
+  const PanelRefresh::Result result = panel_refresh.poll(now);
+  if (result == PanelRefresh::PENDING)
+    return;
+
+  display_refresh_in_progress = false;
+  if (result == PanelRefresh::DONE) {
+    on_display_refreshed();
+  }
+  else {
+    // The panel may show anything; send the whole next frame
+    ESP_LOGW("refresh", "Display refresh timed out.");
+    displayed_bands = 0;
+  }
+
+  if (display_update_deferred) {
+    const bool force = display_update_deferred_force;
+    display_update_deferred = false;
+    display_update_deferred_force = false;
+    update_display(force);
+  }
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <esphome.h>
+
+#include "cheapest.h"
+#include "refresh.h"
+
+
+// Many things can ask for a display update: new prices, time sync,
+// the start of each price slot, gradient numbers and switches changed from Home
+// Assistant. A refresh takes ~15 s, so instead of calling
+// update_display() directly, they request an update, and requests are
+// coalesced. poll_display_update() is called often (from an interval
+// in the yaml file), advances the refresh in progress, and runs at
+// most one update per coalescing window.
+//
+// Data updates (new prices, new slot) run DATA_UPDATE_DELAY_MS after
+// the first request. Cosmetic updates (settings) wait until there
+// have been no new requests for the configured delay, so that editing
+// several settings causes just one refresh.
+
+enum UpdatePriority {
+  UPDATE_COSMETIC,
+  UPDATE_DATA,
+};
+
+const uint32_t DATA_UPDATE_DELAY_MS = 1000;
+
+// counters, exposed as diagnostic sensors
+uint32_t display_updates_requested = 0;
+uint32_t display_updates_run = 0;
+
+// pending update, if any
+bool display_update_pending = false;
+bool display_update_forced = false;
+UpdatePriority display_update_priority = UPDATE_COSMETIC;
+uint32_t display_update_first_request_ms = 0;
+uint32_t display_update_last_request_ms = 0;
+
+
+// Coalescing window for cosmetic updates
+inline uint32_t display_update_delay_ms() {
+  float seconds = id(display_update_delay).state;
+  return std::isnan(seconds) || seconds < 0 ? 0 : uint32_t(seconds * 1000);
+}
+
+
+// Request a display update. If force is true, the display is
+// refreshed even if the frame doesn't change (see update_display()).
+inline void request_display_update(UpdatePriority priority,
+                                   bool force = false,
+                                   uint32_t now = millis())
+{
+  ++display_updates_requested;
+  if (!display_update_pending) {
+    display_update_pending = true;
+    display_update_priority = priority;
+    display_update_first_request_ms = now;
+  }
+  else if (priority > display_update_priority) {
+    display_update_priority = priority;
+  }
+  display_update_forced |= force;
+  display_update_last_request_ms = now;
+}
+
+
+// The current price, bar and warning change at the start of each price
+// slot (every hour, or every 15 or 30 minutes). A refresh takes ~15 s,
+// so if it starts when the slot does, the previous slot's price is
+// shown for the first seconds of it. Instead, the next slot's frame is
+// drawn and refreshed in advance, so that the refresh finishes when
+// the slot starts. The lead time is the "Hourly refresh lead time"
+// setting, or if that is 0, the measured duration of the last
+// refresh.
+
+// estimate until a refresh has been measured
+const uint32_t DEFAULT_REFRESH_MS = 20000;
+
+inline uint32_t slot_refresh_lead_ms() {
+  const float seconds = id(refresh_lead_time).state;
+  if (!std::isnan(seconds) && seconds > 0)
+    return uint32_t(seconds * 1000);
+  // Also wait for the data update delay, and 1 s for the resolution
+  // of the clock.
+  return (display_refresh_ms ? display_refresh_ms : DEFAULT_REFRESH_MS) +
+    DATA_UPDATE_DELAY_MS + 1000;
+}
+
+// Request the next slot's frame when it's time. Also ends the time
+// override after the slot has started.
+inline void poll_slot_refresh() {
+  const ESPTime now = id(homeassistant_time).now();
+  if (!now.is_valid())
+    return;
+
+  if (display_time_override && now.timestamp >= display_time_override) {
+    display_time_override = 0;
+    return;
+  }
+  if (display_time_override || !id(prices_start_date).is_valid())
+    return;
+
+  const PriceStore& prices = id(price_store);
+  const time_t next_slot =
+    prices.slot_start(prices.slot_at(now.timestamp) + 1);
+  if (uint32_t(next_slot - now.timestamp) * 1000 > slot_refresh_lead_ms())
+    return;
+
+  ESP_LOGD("scheduler", "Drawing next slot %u s in advance.",
+           (unsigned) (next_slot - now.timestamp));
+  display_time_override = next_slot;
+  request_display_update(UPDATE_DATA);
+}
+
+
+// Find the cheapest window again when the slot shown changes, so that
+// it doesn't start in the past and the deadline moves on. With the next
+// slot drawn in advance, that's the next slot. Requests an
+// update if the window moved.
+inline void poll_cheapest_window() {
+  const ESPTime now = display_now();
+  if (!now.is_valid() || !id(prices_start_date).is_valid() ||
+      id(price_store).slot_at(now.timestamp) == cheapest_window_found_slot)
+    return;
+
+  const PriceWindow previous = cheapest_window;
+  update_cheapest_window(now);
+  if (cheapest_window.start != previous.start ||
+      cheapest_window.slots != previous.slots)
+    request_display_update(UPDATE_DATA);
+}
+
+
+// Advance refresh in progress, and run pending update if it's due.
+// Returns true if an update was run.
+inline bool poll_display_update(uint32_t now = millis()) {
+  poll_display_refresh(now);
+  poll_slot_refresh();
+  poll_cheapest_window();
+  if (!display_update_pending || display_refresh_in_progress)
+    return false;
+
+  const uint32_t delay = display_update_delay_ms();
+  const bool due = display_update_priority == UPDATE_DATA
+    ? now - display_update_first_request_ms >=
+        std::min(delay, DATA_UPDATE_DELAY_MS)
+    : now - display_update_last_request_ms >= delay;
+  if (!due)
+    return false;
+
+  const bool force = display_update_forced;
+  display_update_pending = false;
+  display_update_forced = false;
+  ++display_updates_run;
+  ESP_LOGD("scheduler", "Running %s update (%u requested, %u run).",
+           display_update_priority == UPDATE_DATA ? "data" : "cosmetic",
+           display_updates_requested, display_updates_run);
+  update_display(force);
+  return true;
+}
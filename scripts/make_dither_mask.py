@@ -1,13 +1,21 @@
 #!/usr/bin/env python3
 
-import sys
+# Usage:
+#   make_dither_mask.py MASK.png
+#     Print the initializer of DITHER_MASK in dithermask.h.
+#   make_dither_mask.py --levels N MASK.png
+#     Print the initializer of DITHER_PLANES in ditherplanes.h: the
+#     mask pre-thresholded at N redness levels (N a power of two),
+#     packed 32 pixels per word.
+
+import argparse
 
 from PIL import Image
 
 
-print("{")
-line = "   "
-with Image.open(sys.argv[1]) as img:
+def print_mask(img):
+    print("{")
+    line = "   "
     for y in range(img.height):
         for x in range(img.width):
             val = img.getpixel((x, y))
@@ -16,5 +24,48 @@ with Image.open(sys.argv[1]) as img:
             if len(line) > 70:
                 print(old_line)
                 line = "    %d," % val
-print(line[:-1])
-print("};")
+    print(line[:-1])
+    print("};")
+
+
+def print_planes(img, levels):
+    if img.width % 32 != 0:
+        raise SystemExit("mask width must be a multiple of 32")
+
+    print("{")
+    for level in range(1, levels + 1):
+        # Redness value represented by this level. Levels are spaced so
+        # that every (levels / n)th level gives the same values as a
+        # table generated with n levels. This lets DITHER_LEVELS select
+        # a subset at build time.
+        value = min(level * 256 // levels, 255)
+        print("#if DITHER_PLANE_SELECTED(%d)" % level)
+        print("  {  // level %d: redness %d" % (level, value))
+        for y in range(img.height):
+            words = []
+            for x0 in range(0, img.width, 32):
+                word = 0
+                for bit in range(32):
+                    if value > img.getpixel((x0 + bit, y)):
+                        word |= 1 << bit
+                words.append("0x%08x" % word)
+            print("    {%s}," % ", ".join(words))
+        print("  },")
+        print("#endif")
+    print("};")
+
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--levels", type=int)
+parser.add_argument("mask")
+args = parser.parse_args()
+
+if args.levels is not None and (
+        args.levels < 1 or args.levels & (args.levels - 1)):
+    parser.error("--levels must be a power of two")
+
+with Image.open(args.mask) as img:
+    if args.levels is None:
+        print_mask(img)
+    else:
+        print_planes(img, args.levels)
@@ -1,44 +1,101 @@
 #pragma once
 
-#include <vector>
-#include <cmath>
+#include <stddef.h>
 
 
-static std::vector<int> pleasing_ticks(int max_val) {
+// Tick values in descending order. Fixed capacity, so that
+// pleasing_ticks() doesn't need to allocate.
+struct Ticks {
+  static constexpr int MAX_COUNT = 5;
+
+  int values[MAX_COUNT];
+  int count;
+
+  constexpr const int* begin() const { return values; }
+  constexpr const int* end() const { return values + count; }
+  constexpr int size() const { return count; }
+  constexpr int operator[](int i) const { return values[i]; }
+};
+
+
+static constexpr int POWERS_OF_10[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+
+static constexpr Ticks pleasing_ticks(int max_val) {
   // Handle max_val <= 1 as a special case. We return ints, which
   // means we can't return fractional values, but there is little
   // point in supporting such small values anyway, so let's just use 1
   // as the only tick.
   if (max_val <= 1)
-    return {1};
+    return {{1}, 1};
 
-  float order_of_magnitude = std::floor(std::log10((float)max_val));
-  int first_digit = std::ceil(max_val / std::pow(10, order_of_magnitude));
-  int top = first_digit * std::pow(10, order_of_magnitude);
-  ESP_LOGV("ticks", "first digit = %d  top = %d", first_digit, top);
+  // largest power of 10 <= max_val
+  int order_of_magnitude = 0;
+  while (order_of_magnitude + 1 <
+         int(sizeof(POWERS_OF_10) / sizeof(*POWERS_OF_10)) &&
+         POWERS_OF_10[order_of_magnitude + 1] <= max_val)
+    ++order_of_magnitude;
+  const int power = POWERS_OF_10[order_of_magnitude];
+  int first_digit = (max_val + power - 1) / power;  // rounded up
+  int top = first_digit * power;
 
   switch (first_digit) {
   case 1: case 10:  // 10 8 6 4 2
-    // return {top, top/2};  // 10 5
+    // return {{top, top/2}, 2};  // 10 5
   case 5:  // 5 4 3 2 1
-    return {top, (top*4)/5, (top*3)/5, (top*2)/5, top/5};
+    return {{top, (top*4)/5, (top*3)/5, (top*2)/5, top/5}, 5};
   case 2:  // 2 1
-    return {top, top/2};
+    return {{top, top/2}, 2};
   case 3:  // 3 2 1
   case 6:  // 6 4 2
-    return {top, (top*2)/3, top/3};
+    return {{top, (top*2)/3, top/3}, 3};
   case 4:  // 4 3 2 1
   case 8:  // 8 6 4 2
-    return {top, (top*3)/4, top/2, top/4};
+    return {{top, (top*3)/4, top/2, top/4}, 4};
 
   // These are inconvenient. Let's use some kind of uneven spacing.
   case 7:  // 7 5
-    return {top, (top*5)/7};
+    return {{top, (top*5)/7}, 2};
   case 9:  // 9 5
-    return {top, (top*5)/9};
+    return {{top, (top*5)/9}, 2};
 
   default:
     // we should never get here
-    return {top};
+    return {{top}, 1};
   }
 }
+
+static_assert(pleasing_ticks(40)[0] == 40 && pleasing_ticks(40).size() == 4,
+              "pleasing_ticks() should be usable at compile time");
+
+
+// Tick values formatted as decimal strings, without allocation.
+struct TickLabels {
+  char labels[Ticks::MAX_COUNT][12];
+
+  explicit TickLabels(const Ticks& ticks) {
+    for (int i = 0; i < ticks.size(); ++i)
+      format(labels[i], ticks[i]);
+  }
+
+  const char* operator[](int i) const { return labels[i]; }
+
+private:
+  static void format(char* str, int value) {
+    char digits[11];
+    int n = 0;
+    unsigned u = value < 0 ? -(unsigned) value : value;
+    do {
+      digits[n++] = '0' + u % 10;
+      u /= 10;
+    } while (u);
+
+    if (value < 0)
+      *str++ = '-';
+    while (n)
+      *str++ = digits[--n];
+    *str = '\0';
+  }
+};